@@ -41,11 +41,14 @@
 #include "kernel/service/MemoryService.h"
 #include "kernel/service/SchedulerService.h"
 #include "kernel/memory/MemoryStatusNode.h"
+#include "kernel/process/SchedulerStatusNode.h"
 #include "device/power/apm/ApmMachine.h"
 #include "kernel/service/PowerManagementService.h"
 #include "device/pci/Pci.h"
 #include "device/storage/floppy/FloppyController.h"
 #include "device/storage/ide/IdeController.h"
+#include "device/storage/ide/IdeNode.h"
+#include "device/storage/cache/BlockCacheNode.h"
 #include "kernel/service/StorageService.h"
 #include "filesystem/fat/FatDriver.h"
 #include "device/sound/speaker/PcSpeakerNode.h"
@@ -53,6 +56,7 @@
 #include "filesystem/memory/ZeroNode.h"
 #include "filesystem/memory/RandomNode.h"
 #include "filesystem/process/ProcessDriver.h"
+#include "filesystem/pipe/PipeDriver.h"
 #include "device/hid/Mouse.h"
 #include "device/hid/Ps2Controller.h"
 #include "filesystem/memory/MountsNode.h"
@@ -84,6 +88,10 @@
 #include "lib/util/time/Timestamp.h"
 #include "lib/util/async/Thread.h"
 #include "kernel/service/TimeService.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/process/BinaryLoader.h"
+#include "kernel/process/Thread.h"
+#include "lib/util/async/FunctionPointerRunnable.h"
 
 namespace Device {
 class Machine;
@@ -166,6 +174,12 @@ void GatesOfHell::enter() {
 
     printBanner();
 
+    if (Kernel::Multiboot::hasKernelOption("loader_benchmark") && Kernel::Multiboot::getKernelOption("loader_benchmark") == "true") {
+        auto &processService = Kernel::System::getService<Kernel::ProcessService>();
+        auto &benchmarkThread = Kernel::Thread::createKernelThread("Loader-Benchmark", processService.getKernelProcess(), new Util::Async::FunctionPointerRunnable(benchmarkBinaryLoading));
+        Kernel::System::getService<Kernel::SchedulerService>().ready(benchmarkThread);
+    }
+
     Util::Async::Process::execute(Util::Io::File("/initrd/bin/shell"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), Util::Io::File("/device/terminal"), "shell", Util::Array<Util::String>(0));
 
     log.info("Starting scheduler!");
@@ -292,19 +306,33 @@ void GatesOfHell::initializeFilesystem() {
     filesystemService.createDirectory("/process");
     filesystemService.getFilesystem().mountVirtualDriver("/process", processDriver);
 
+    filesystemService.createDirectory("/pipe");
+    filesystemService.getFilesystem().mountVirtualDriver("/pipe", &filesystemService.getPipeDriver());
+
     filesystemService.createFile("/device/log");
     deviceDriver->addNode("/", new Filesystem::Memory::NullNode());
     deviceDriver->addNode("/", new Filesystem::Memory::ZeroNode());
     deviceDriver->addNode("/", new Filesystem::Memory::RandomNode());
     deviceDriver->addNode("/", new Filesystem::Memory::MountsNode());
     deviceDriver->addNode("/", new Kernel::MemoryStatusNode("memory"));
+    deviceDriver->addNode("/", new Kernel::SchedulerStatusNode("scheduler"));
     deviceDriver->addNode("/", new Device::Sound::PcSpeakerNode("speaker"));
+    deviceDriver->addNode("/", new Device::Storage::IdeNode("ide"));
+    deviceDriver->addNode("/", new Device::Storage::BlockCacheNode("cache"));
 
     if (Kernel::Multiboot::isModuleLoaded("initrd")) {
         log.info("Initial ramdisk detected -> Mounting [%s]", "/initrd");
         auto module = Kernel::Multiboot::getModule("initrd");
+        auto &timeService = Kernel::System::getService<Kernel::TimeService>();
         auto *tarArchive = new Util::Io::Tar::Archive(module.start);
+        auto indexStart = timeService.getSystemTime().toMilliseconds();
         auto *tarDriver = new Filesystem::Tar::ArchiveDriver(*tarArchive);
+        auto indexTime = timeService.getSystemTime().toMilliseconds() - indexStart;
+        log.info("Indexed [%u] files of initial ramdisk in [%u ms]", tarDriver->getIndex().getFileCount(), indexTime);
+
+        if (Kernel::Multiboot::hasKernelOption("initrd_benchmark") && Kernel::Multiboot::getKernelOption("initrd_benchmark") == "true") {
+            benchmarkInitrdLookups(*tarArchive, *tarDriver, indexTime);
+        }
 
         filesystemService.createDirectory("/initrd");
         filesystemService.getFilesystem().mountVirtualDriver("/initrd", tarDriver);
@@ -318,6 +346,81 @@ void GatesOfHell::initializeFilesystem() {
     }
 }
 
+void GatesOfHell::benchmarkInitrdLookups(Util::Io::Tar::Archive &archive, Filesystem::Tar::ArchiveDriver &driver, uint32_t indexTime) {
+    static const constexpr uint32_t ROUNDS = 64;
+    auto &timeService = Kernel::System::getService<Kernel::TimeService>();
+    auto headers = archive.getFileHeaderReferences();
+    if (headers.length() == 0) {
+        return;
+    }
+
+    auto paths = Util::Array<Util::String>(headers.length());
+    for (uint32_t i = 0; i < headers.length(); i++) {
+        paths[i] = headers[i]->filename;
+    }
+
+    // Linear scan over all headers, as done by the archive driver before it had an index
+    auto start = timeService.getSystemTime().toMilliseconds();
+    for (uint32_t round = 0; round < ROUNDS; round++) {
+        for (const auto &path : paths) {
+            archive.getFile(path);
+        }
+    }
+    auto scanTime = timeService.getSystemTime().toMilliseconds() - start;
+
+    start = timeService.getSystemTime().toMilliseconds();
+    for (uint32_t round = 0; round < ROUNDS; round++) {
+        for (const auto &path : paths) {
+            delete driver.getNode(path);
+        }
+    }
+    auto lookupTime = timeService.getSystemTime().toMilliseconds() - start;
+
+    // Nanoseconds per lookup, calculated with 32-bit arithmetic (64-bit divisions are not available without libgcc)
+    log.info("Initial ramdisk lookup benchmark: [%u] lookups, header scan: [%u ns/lookup], index: [%u ns/lookup] (index built in [%u ms])",
+             ROUNDS * paths.length(), scanTime * (1000000 / ROUNDS) / paths.length(), lookupTime * (1000000 / ROUNDS) / paths.length(), indexTime);
+}
+
+void GatesOfHell::benchmarkBinaryLoading() {
+    auto binaryDirectory = Util::Io::File("/initrd/bin");
+    if (!binaryDirectory.exists() || !binaryDirectory.isDirectory()) {
+        return;
+    }
+
+    uint32_t eagerTotal = 0;
+    uint32_t lazyTotal = 0;
+    for (const auto &name : binaryDirectory.getChildren()) {
+        auto path = binaryDirectory.getCanonicalPath() + "/" + name;
+        auto eagerTime = measureBinaryLoading(path, false);
+        auto lazyTime = measureBinaryLoading(path, true);
+        eagerTotal += eagerTime;
+        lazyTotal += lazyTime;
+
+        log.info("Time to first instruction of [%s]: eager [%u us], lazy [%u us]", static_cast<const char*>(name), eagerTime, lazyTime);
+    }
+
+    log.info("Time to first instruction of all binaries: eager [%u us], lazy [%u us]", eagerTotal, lazyTotal);
+}
+
+uint32_t GatesOfHell::measureBinaryLoading(const Util::String &path, bool lazy) {
+    auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
+    auto &processService = Kernel::System::getService<Kernel::ProcessService>();
+    auto &schedulerService = Kernel::System::getService<Kernel::SchedulerService>();
+
+    // Each run gets a fresh process, whose loader exits the process after touching the entry point
+    auto result = Kernel::BinaryLoader::BenchmarkResult{0, false};
+    auto nullFile = Util::Io::File("/device/null");
+    auto &process = processService.createProcess(memoryService.createAddressSpace(), path, Util::Io::File("/"), nullFile, nullFile, nullFile);
+    auto &loaderThread = Kernel::Thread::createKernelThread("Loader", process, new Kernel::BinaryLoader(path, lazy, result));
+    schedulerService.ready(loaderThread);
+
+    while (!result.finished) {
+        schedulerService.yield();
+    }
+
+    return result.time;
+}
+
 void GatesOfHell::initializePs2Devices() {
     auto *ps2Controller = Device::Ps2Controller::initialize();
     auto *keyboard = Device::Keyboard::initialize(*ps2Controller);
@@ -18,10 +18,24 @@
 #ifndef __KernelEntry_include__
 #define __KernelEntry_include__
 
+#include <cstdint>
+
 namespace Kernel {
 class Logger;
 }  // namespace Kernel
 
+namespace Util::Io::Tar {
+class Archive;
+}  // namespace Util::Io::Tar
+
+namespace Util {
+class String;
+}  // namespace Util
+
+namespace Filesystem::Tar {
+class ArchiveDriver;
+}  // namespace Filesystem::Tar
+
 /**
  * Represents the entry point for the operating system.
  */
@@ -61,6 +75,8 @@ private:
 
     static void initializeFilesystem();
 
+    static void benchmarkInitrdLookups(Util::Io::Tar::Archive &archive, Filesystem::Tar::ArchiveDriver &driver, uint32_t indexTime);
+
     static void initializePs2Devices();
 
     static void initializePorts();
@@ -79,6 +95,10 @@ private:
 
     static void printDefaultBanner();
 
+    static void benchmarkBinaryLoading();
+
+    static uint32_t measureBinaryLoading(const Util::String &path, bool lazy);
+
     static Kernel::Logger log;
 };
 
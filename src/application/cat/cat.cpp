@@ -29,6 +29,7 @@ int32_t main(int32_t argc, char *argv[]) {
     auto argumentParser = Util::ArgumentParser();
     argumentParser.setHelpText("Concatenate multiple files on stdout.\n"
                                "Usage: cat [FILE]...\n"
+                               "Without files, standard input is copied to stdout.\n"
                                "Options:\n"
                                "  -h, --help: Show this help message");
 
@@ -39,8 +40,18 @@ int32_t main(int32_t argc, char *argv[]) {
 
     auto arguments = argumentParser.getUnnamedArguments();
     if (arguments.length() == 0) {
-        Util::System::error << "cat: No arguments provided!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
-        return -1;
+        auto c = Util::System::in.read();
+        while (c != -1) {
+            Util::System::out << static_cast<char>(c);
+            if (c == '\n') {
+                Util::System::out << Util::Io::PrintStream::flush;
+            }
+
+            c = Util::System::in.read();
+        }
+
+        Util::System::out << Util::Io::PrintStream::flush;
+        return 0;
     }
 
     for (const auto &path : arguments) {
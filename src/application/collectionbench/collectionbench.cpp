@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/interface.h"
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/base/Move.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/collection/ArrayBlockingQueue.h"
+#include "lib/util/collection/ArrayListBlockingQueue.h"
+#include "lib/util/collection/HashMap.h"
+#include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/time/Timestamp.h"
+
+static const constexpr uint32_t ITERATIONS = 100;
+static const constexpr uint32_t ELEMENTS = 256;
+
+/**
+ * A string, that is too long to be stored inline, so that every copy needs its own buffer.
+ */
+static const char *LONG_STRING = "/initrd/bin/collectionbench";
+
+uint32_t listAddCopy() {
+    auto list = Util::ArrayList<Util::String>();
+    const auto string = Util::String(LONG_STRING);
+    for (uint32_t i = 0; i < ELEMENTS; i++) {
+        list.add(string);
+    }
+
+    return list.size();
+}
+
+uint32_t listAddTemporary() {
+    auto list = Util::ArrayList<Util::String>();
+    for (uint32_t i = 0; i < ELEMENTS; i++) {
+        list.add(Util::String(LONG_STRING));
+    }
+
+    return list.size();
+}
+
+uint32_t listEmplace() {
+    auto list = Util::ArrayList<Util::String>();
+    for (uint32_t i = 0; i < ELEMENTS; i++) {
+        list.emplace(LONG_STRING);
+    }
+
+    return list.size();
+}
+
+uint32_t listIterate() {
+    auto list = Util::ArrayList<uint32_t>();
+    for (uint32_t i = 0; i < ELEMENTS; i++) {
+        list.add(i);
+    }
+
+    uint32_t result = 0;
+    for (const auto element : list) {
+        result += element;
+    }
+
+    return result;
+}
+
+uint32_t listRemoveFront() {
+    auto list = Util::ArrayList<Util::String>();
+    for (uint32_t i = 0; i < ELEMENTS; i++) {
+        list.emplace(LONG_STRING);
+    }
+
+    uint32_t result = 0;
+    while (!list.isEmpty()) {
+        result += list.removeIndex(0).length();
+    }
+
+    return result;
+}
+
+uint32_t listQueue() {
+    auto queue = Util::ArrayListBlockingQueue<Util::String>();
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < ELEMENTS; i++) {
+        queue.offer(Util::String(LONG_STRING));
+        if (i % 2 == 1) {
+            result += queue.poll().length();
+        }
+    }
+
+    return result;
+}
+
+uint32_t ringQueue() {
+    auto queue = Util::ArrayBlockingQueue<Util::String>(16);
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < ELEMENTS; i++) {
+        queue.offer(Util::String(LONG_STRING));
+        result += queue.poll().length();
+    }
+
+    return result;
+}
+
+uint32_t mapPut() {
+    auto map = Util::HashMap<Util::String, Util::String>();
+    for (uint32_t i = 0; i < ELEMENTS; i++) {
+        map.put(Util::String::format("%s/%u", LONG_STRING, i), Util::String(LONG_STRING));
+    }
+
+    uint32_t result = map.size();
+    for (uint32_t i = 0; i < ELEMENTS; i += 2) {
+        result += map.remove(Util::String::format("%s/%u", LONG_STRING, i)).length();
+    }
+
+    return result;
+}
+
+uint32_t arrayCopy() {
+    auto array = Util::Array<Util::String>(ELEMENTS);
+    auto copy = array;
+    return copy.length();
+}
+
+uint32_t arrayMove() {
+    auto array = Util::Array<Util::String>(ELEMENTS);
+    auto moved = Util::move(array);
+    return moved.length();
+}
+
+void benchmark(const char *name, uint32_t (*function)()) {
+    auto startCount = getHeapAllocationCount();
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    uint32_t result = 0;
+
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        result += function();
+    }
+
+    auto time = static_cast<uint32_t>(Util::Time::getSystemTime().toMilliseconds() - start);
+    auto allocations = getHeapAllocationCount() - startCount;
+
+    Util::System::out << name << allocations / ITERATIONS << " allocations/run, " << time << " ms for " << ITERATIONS
+                      << " runs (checksum " << result << ")" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Collection benchmark.\n"
+                               "Counts heap allocations of common container operations on 256 elements.\n"
+                               "Usage: collectionbench\n"
+                               "Options:\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    benchmark("List add (copy):      ", listAddCopy);
+    benchmark("List add (temporary): ", listAddTemporary);
+    benchmark("List emplace:         ", listEmplace);
+    benchmark("List iterate:         ", listIterate);
+    benchmark("List remove front:    ", listRemoveFront);
+    benchmark("List queue:           ", listQueue);
+    benchmark("Ring queue:           ", ringQueue);
+    benchmark("Map put/remove:       ", mapPut);
+    benchmark("Array copy:           ", arrayCopy);
+    benchmark("Array move:           ", arrayMove);
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/time/Timestamp.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/stream/FileInputStream.h"
+#include "lib/util/io/stream/FileOutputStream.h"
+#include "lib/util/io/stream/ByteArrayOutputStream.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+static const constexpr uint32_t BUFFER_SIZE = 64 * 1024;
+static const constexpr char *IDE_NODE = "/device/ide";
+static const constexpr char *CACHE_NODE = "/device/cache";
+
+void writeNode(const char *path, const char *command) {
+    auto file = Util::Io::File(path);
+    auto outputStream = Util::Io::FileOutputStream(file);
+    auto printStream = Util::Io::PrintStream(outputStream);
+    printStream << command << Util::Io::PrintStream::flush;
+}
+
+bool isDmaEnabled() {
+    auto ideFile = Util::Io::File(IDE_NODE);
+    auto status = Util::Io::FileInputStream(ideFile).readString(ideFile.getLength());
+    return status.beginsWith("Mode: dma");
+}
+
+void dropCache() {
+    // Make sure, that the file is actually read from disk and not served by the block cache
+    if (Util::Io::File(CACHE_NODE).exists()) {
+        writeNode(CACHE_NODE, "drop");
+    }
+}
+
+uint32_t benchmark(Util::Io::File &file, uint32_t iterations, uint8_t *buffer) {
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        dropCache();
+
+        auto start = Util::Time::getSystemTime().toMilliseconds();
+        auto stream = Util::Io::FileInputStream(file);
+        while (stream.read(buffer, 0, BUFFER_SIZE) > 0) {}
+        result += Util::Time::getSystemTime().toMilliseconds() - start;
+    }
+
+    return result;
+}
+
+Util::String formatThroughput(uint32_t bytes, uint32_t milliseconds) {
+    if (milliseconds == 0) {
+        milliseconds = 1;
+    }
+
+    auto throughput = (static_cast<double>(bytes) / (1024 * 1024)) / (static_cast<double>(milliseconds) / 1000);
+    return Util::String::format("%u.%02u MB/s", static_cast<uint32_t>(throughput), static_cast<uint32_t>((throughput - static_cast<uint32_t>(throughput)) * 100));
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Disk throughput benchmark comparing programmed I/O and DMA transfers of IDE drives.\n"
+                               "The given file (should be located on an IDE drive) is read sequentially in both modes (Default: 1 iteration).\n"
+                               "Usage: diskbench [FILE] [ITERATIONS]\n"
+                               "Options:\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    if (arguments.length() == 0) {
+        Util::System::error << "diskbench: No arguments provided!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto file = Util::Io::File(arguments[0]);
+    if (!file.exists() || !file.isFile()) {
+        Util::System::error << "diskbench: '" << arguments[0] << "' could not be opened!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    if (!Util::Io::File(IDE_NODE).exists()) {
+        Util::System::error << "diskbench: '" << IDE_NODE << "' not found!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto iterations = static_cast<uint32_t>(arguments.length() < 2 ? 1 : Util::String::parseInt(arguments[1]));
+    auto bytes = file.getLength() * iterations;
+    auto *buffer = new uint8_t[BUFFER_SIZE];
+    auto dmaWasEnabled = isDmaEnabled();
+    Util::Io::ByteArrayOutputStream resultStream;
+    Util::Io::PrintStream resultWriter(resultStream);
+
+    Util::System::out << "Reading '" << arguments[0] << "' via programmed I/O..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    writeNode(IDE_NODE, "pio");
+    auto pioResult = benchmark(file, iterations, buffer);
+    resultWriter << "PIO: " << pioResult << "ms (" << formatThroughput(bytes, pioResult) << ")" << Util::Io::PrintStream::endl;
+
+    Util::System::out << "Reading '" << arguments[0] << "' via DMA..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    writeNode(IDE_NODE, "dma");
+    auto dmaResult = benchmark(file, iterations, buffer);
+    resultWriter << "DMA: " << dmaResult << "ms (" << formatThroughput(bytes, dmaResult) << ")" << Util::Io::PrintStream::endl;
+
+    writeNode(IDE_NODE, dmaWasEnabled ? "dma" : "pio");
+    delete[] buffer;
+
+    Util::System::out << Util::Io::PrintStream::endl << resultStream.getContent() << Util::Io::PrintStream::flush;
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/collection/ChainedHashMap.h"
+#include "lib/util/collection/HashMap.h"
+#include "lib/util/base/String.h"
+#include "lib/util/time/Timestamp.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+struct Result {
+    uint32_t insertTime;
+    uint32_t lookupTime;
+    uint32_t removeTime;
+    uint32_t errors;
+};
+
+template<typename M, typename K>
+Result benchmark(const Util::Array<K> &keys) {
+    M map;
+    Result result{};
+
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    for (uint32_t i = 0; i < keys.length(); i++) {
+        map.put(keys[i], i);
+    }
+    result.insertTime = Util::Time::getSystemTime().toMilliseconds() - start;
+
+    start = Util::Time::getSystemTime().toMilliseconds();
+    for (uint32_t i = 0; i < keys.length(); i++) {
+        if (map.get(keys[i]) != i) {
+            result.errors++;
+        }
+    }
+    result.lookupTime = Util::Time::getSystemTime().toMilliseconds() - start;
+
+    start = Util::Time::getSystemTime().toMilliseconds();
+    for (uint32_t i = 0; i < keys.length(); i++) {
+        if (map.remove(keys[i]) != i) {
+            result.errors++;
+        }
+    }
+    result.removeTime = Util::Time::getSystemTime().toMilliseconds() - start;
+
+    if (map.size() != 0) {
+        result.errors++;
+    }
+
+    return result;
+}
+
+void printResult(const char *name, const Result &result) {
+    Util::System::out << "  " << name << " insert: " << result.insertTime << " ms, lookup: " << result.lookupTime
+                      << " ms, remove: " << result.removeTime << " ms" << Util::Io::PrintStream::endl;
+}
+
+template<typename K>
+uint32_t compare(const char *name, const Util::Array<K> &keys) {
+    Util::System::out << name << " keys:" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+
+    auto chained = benchmark<Util::ChainedHashMap<K, uint32_t>, K>(keys);
+    printResult("Chained:         ", chained);
+    Util::System::out << Util::Io::PrintStream::flush;
+
+    auto openAddressing = benchmark<Util::HashMap<K, uint32_t>, K>(keys);
+    printResult("Open addressing: ", openAddressing);
+    Util::System::out << Util::Io::PrintStream::flush;
+
+    return chained.errors + openAddressing.errors;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("Hash map benchmark.\n"
+                               "Compares the open addressing HashMap with the chained hash map it replaced,\n"
+                               "using integer keys, page aligned addresses and strings as keys.\n"
+                               "Usage: hashbench [ENTRIES] (Default: 10000 entries)\n"
+                               "Options:\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    auto entries = static_cast<uint32_t>(arguments.length() == 0 ? 10000 : Util::String::parseInt(arguments[0]));
+    if (entries == 0) {
+        Util::System::error << "hashbench: Entries must be greater than 0!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto integerKeys = Util::Array<uint32_t>(entries);
+    auto addressKeys = Util::Array<uint32_t>(entries);
+    auto stringKeys = Util::Array<Util::String>(entries);
+    for (uint32_t i = 0; i < entries; i++) {
+        integerKeys[i] = i;
+        addressKeys[i] = 0x40000000 + i * 0x1000;
+        stringKeys[i] = Util::String::format("/initrd/bin/file%u", i);
+    }
+
+    Util::System::out << "Running benchmark with " << entries << " entries..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    auto errors = compare("Integer", integerKeys);
+    errors += compare("Address", addressKeys);
+    errors += compare("String", stringKeys);
+
+    if (errors > 0) {
+        Util::System::out << errors << " lookups returned wrong values!" << Util::Io::PrintStream::endl;
+    }
+
+    Util::System::out << Util::Io::PrintStream::flush;
+    return errors == 0 ? 0 : -1;
+}
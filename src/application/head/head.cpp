@@ -24,14 +24,43 @@
 #include "lib/util/base/String.h"
 #include "lib/util/io/stream/BufferedInputStream.h"
 #include "lib/util/io/stream/FileInputStream.h"
+#include "lib/util/io/stream/InputStream.h"
 #include "lib/util/io/stream/PrintStream.h"
 
+void printHead(Util::Io::InputStream &stream, bool byteMode, uint32_t count) {
+    if (byteMode) {
+        auto c = stream.read();
+        for (uint32_t i = 0; i < count && c != -1; i++) {
+            Util::System::out << static_cast<char>(c) << Util::Io::PrintStream::flush;
+            if (i + 1 < count) {
+                c = stream.read();
+            }
+        }
+    } else {
+        uint32_t lineCount = 0;
+        auto c = stream.read();
+        while (lineCount < count && c != -1) {
+            Util::System::out << static_cast<char>(c) << Util::Io::PrintStream::flush;
+            if (c == '\n') {
+                lineCount++;
+            }
+
+            if (lineCount < count) {
+                c = stream.read();
+            }
+        }
+    }
+
+    Util::System::out << Util::Io::PrintStream::flush;
+}
+
 int32_t main(int32_t argc, char *argv[]) {
     auto argumentParser = Util::ArgumentParser();
     argumentParser.addArgument("bytes", false, "c");
     argumentParser.addArgument("lines", false, "n");
     argumentParser.setHelpText("Print the first 10 lines of each file.\n"
                                "Usage: head [OPTION]... [FILE]...\n"
+                               "Without files, standard input is read.\n"
                                "Options:\n"
                                "  -c, --bytes [COUNT]: Print the first COUNT bytes.\n"
                                "  -n, --lines [COUNT]: Print the first COUNT lines.\n"
@@ -43,11 +72,6 @@ int32_t main(int32_t argc, char *argv[]) {
     }
 
     auto arguments = argumentParser.getUnnamedArguments();
-    if (arguments.length() == 0) {
-        Util::System::error << "head: No arguments provided!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
-        return -1;
-    }
-
     bool byteMode = false;
     uint32_t count = 10;
     if (argumentParser.hasArgument("bytes")) {
@@ -57,6 +81,11 @@ int32_t main(int32_t argc, char *argv[]) {
         count = Util::String::parseInt(argumentParser.getArgument("lines"));
     }
 
+    if (arguments.length() == 0) {
+        printHead(Util::System::in, byteMode, count);
+        return 0;
+    }
+
     for (const auto &path : arguments) {
         auto file = Util::Io::File(path);
         if (!file.exists()) {
@@ -75,26 +104,7 @@ int32_t main(int32_t argc, char *argv[]) {
 
         auto stream = Util::Io::FileInputStream(file);
         auto bufferedStream = Util::Io::BufferedInputStream(stream);
-
-        if (byteMode) {
-            auto c = bufferedStream.read();
-            for (uint32_t i = 0; i < count && c != -1; i++) {
-                Util::System::out << static_cast<char>(c) << Util::Io::PrintStream::flush;
-                c = bufferedStream.read();
-            }
-        } else {
-            uint32_t lineCount = 0;
-            auto c = bufferedStream.read();
-            while (lineCount < count && c != -1) {
-                Util::System::out << static_cast<char>(c) << Util::Io::PrintStream::flush;
-                if (c == '\n') {
-                    lineCount++;
-                }
-                c = bufferedStream.read();
-            }
-        }
-
-        Util::System::out << Util::Io::PrintStream::flush;
+        printHead(bufferedStream, byteMode, count);
     }
 
     return 0;
@@ -23,7 +23,9 @@
 #include "lib/util/collection/Array.h"
 #include "lib/util/io/file/File.h"
 #include "lib/util/base/String.h"
+#include "lib/interface.h"
 #include "lib/util/io/stream/BufferedInputStream.h"
+#include "lib/util/io/stream/ByteArrayInputStream.h"
 #include "lib/util/io/stream/FileInputStream.h"
 #include "lib/util/io/stream/PrintStream.h"
 
@@ -82,8 +84,23 @@ int32_t main(int32_t argc, char *argv[]) {
         return -1;
     }
 
-    auto stream = Util::Io::FileInputStream(file);
-    auto bufferedStream = Util::Io::BufferedInputStream(stream);
+    // Regular files are mapped into memory, instead of being copied through stream buffers
+    Util::Io::InputStream *stream;
+    Util::Io::FileInputStream *fileStream = nullptr;
+    uint8_t *mappedFile = nullptr;
+    if (file.getType() == Util::Io::File::REGULAR) {
+        auto fileDescriptor = Util::Io::File::open(file.getCanonicalPath());
+        auto fileLength = file.getLength();
+        mappedFile = static_cast<uint8_t*>(mapFile(fileDescriptor, 0, fileLength, Util::Io::File::READ_ONLY));
+        Util::Io::File::close(fileDescriptor);
+
+        stream = new Util::Io::ByteArrayInputStream(mappedFile, mappedFile == nullptr ? 0 : fileLength);
+    } else {
+        fileStream = new Util::Io::FileInputStream(file);
+        stream = new Util::Io::BufferedInputStream(*fileStream);
+    }
+
+    auto &bufferedStream = *stream;
 
     Util::System::out << Util::Io::PrintStream::hex << HEXDUMP_HEADER << Util::Io::PrintStream::endl;
     printSeparationLine();
@@ -132,5 +149,11 @@ int32_t main(int32_t argc, char *argv[]) {
         }
     }
 
+    delete stream;
+    delete fileStream;
+    if (mappedFile != nullptr) {
+        unmapFile(mappedFile);
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -34,9 +34,14 @@ void lsDirectory(const Util::String &path) {
 
     auto string = Util::String();
     if (file.isDirectory()) {
+        const auto directoryPath = file.getCanonicalPath() + "/";
         for (const auto &child : file.getChildren()) {
-            auto currentFile = Util::Io::File(file.getCanonicalPath() + "/" + child);
-            string += Util::Io::File::getTypeColor(currentFile) + currentFile.getName() + (currentFile.isDirectory() ? "/" : "") + Util::Graphic::Ansi::FOREGROUND_DEFAULT + " ";
+            auto currentFile = Util::Io::File(directoryPath + child);
+            string += Util::Io::File::getTypeColor(currentFile);
+            string += child;
+            string += currentFile.isDirectory() ? "/" : "";
+            string += Util::Graphic::Ansi::FOREGROUND_DEFAULT;
+            string += " ";
         }
 
         string = string.substring(0, string.length() - 1);
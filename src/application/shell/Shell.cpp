@@ -120,9 +120,11 @@ void Shell::parseInput() {
     const auto rest = pipeSplit[0].substring(currentLine.indexOf(" "), currentLine.length());
     auto arguments = rest.split(" ");
 
-    const auto targetFile = pipeSplit.length() == 1 ? "/device/terminal" : pipeSplit[1].split(" ")[0];
+    const auto targetFile = pipeSplit.length() == 1 ? TERMINAL_PATH : pipeSplit[1].split(" ")[0];
 
-    if (command == "cd") {
+    if (pipeSplit[0].indexOf("|") != UINT32_MAX) {
+        executePipeline(pipeSplit[0].split("|"), targetFile, async);
+    } else if (command == "cd") {
         cd(arguments);
     } else if (command == "exit") {
         isRunning = false;
@@ -198,30 +200,95 @@ void Shell::cd(const Util::Array<Util::String> &arguments) {
     }
 }
 
+void Shell::executePipeline(const Util::Array<Util::String> &commands, const Util::String &outputPath, bool async) const {
+    Util::ArrayList<uint32_t> processIds;
+    Util::ArrayList<int32_t> pipeFileDescriptors;
+    Util::String inputPath = TERMINAL_PATH;
+
+    for (uint32_t i = 0; i < commands.length(); i++) {
+        const auto words = commands[i].split(" ");
+        if (words.length() == 0) {
+            Util::System::out << "Missing command in pipeline!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+            break;
+        }
+
+        const auto &command = words[0];
+        Util::Array<Util::String> arguments(words.length() - 1);
+        for (uint32_t j = 0; j < arguments.length(); j++) {
+            arguments[j] = words[j + 1];
+        }
+
+        auto stageOutputPath = outputPath;
+        auto stageErrorPath = outputPath;
+        Util::String nextInputPath;
+        if (i < commands.length() - 1) {
+            int32_t readFileDescriptor, writeFileDescriptor;
+            auto id = Util::Io::File::createPipe(readFileDescriptor, writeFileDescriptor);
+            if (id < 0) {
+                Util::System::out << "Failed to create pipe!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+                break;
+            }
+
+            pipeFileDescriptors.add(readFileDescriptor);
+            pipeFileDescriptors.add(writeFileDescriptor);
+            stageOutputPath = Util::String::format("/pipe/%d/write", id);
+            stageErrorPath = TERMINAL_PATH;
+            nextInputPath = Util::String::format("/pipe/%d/read", id);
+        }
+
+        auto binaryPath = checkPath(command);
+        if (!startBinary(binaryPath.isEmpty() ? command : binaryPath, command, arguments, inputPath, stageOutputPath, stageErrorPath, processIds)) {
+            break;
+        }
+
+        inputPath = nextInputPath;
+    }
+
+    // The started processes have opened their own ends by now. The shell's ends need to be closed,
+    // so that each process sees end of file, once its predecessor has exited.
+    for (uint32_t i = 0; i < pipeFileDescriptors.size(); i++) {
+        Util::Io::File::close(pipeFileDescriptors.get(i));
+    }
+
+    if (!async) {
+        for (uint32_t i = 0; i < processIds.size(); i++) {
+            Util::Async::Process(processIds.get(i)).join();
+        }
+    }
+}
+
 void Shell::executeBinary(const Util::String &path, const Util::String &command, const Util::Array<Util::String> &arguments, const Util::String &outputPath, bool async) {
+    Util::ArrayList<uint32_t> processIds;
+    if (startBinary(path, command, arguments, TERMINAL_PATH, outputPath, outputPath, processIds) && !async) {
+        Util::Async::Process(processIds.get(0)).join();
+    }
+}
+
+bool Shell::startBinary(const Util::String &path, const Util::String &command, const Util::Array<Util::String> &arguments, const Util::String &inputPath,
+                        const Util::String &outputPath, const Util::String &errorPath, Util::ArrayList<uint32_t> &processIds) {
     auto binaryFile = Util::Io::File(path);
-    auto inputFile = Util::Io::File("/device/terminal");
+    auto inputFile = Util::Io::File(inputPath);
     auto outputFile = Util::Io::File(outputPath);
+    auto errorFile = Util::Io::File(errorPath);
 
     if (!binaryFile.exists()) {
         Util::System::out << "'" << path << "' not found!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
-        return;
+        return false;
     }
 
     if (binaryFile.isDirectory()) {
         Util::System::out << "'" << path << "' is a directory!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
-        return;
+        return false;
     }
 
     if (!outputFile.exists() && !outputFile.create(Util::Io::File::REGULAR)) {
         Util::System::out << "Failed to execute file '" << path << "'!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
-        return;
+        return false;
     }
 
-    auto process = Util::Async::Process::execute(binaryFile, inputFile, outputFile, outputFile, command, arguments);
-    if (!async) {
-        process.join();
-    }
+    auto process = Util::Async::Process::execute(binaryFile, inputFile, outputFile, errorFile, command, arguments);
+    processIds.add(process.getId());
+    return true;
 }
 
 void Shell::handleUpKey() {
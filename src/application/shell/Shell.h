@@ -86,8 +86,17 @@ private:
 
     static void cd(const Util::Array<Util::String> &arguments);
 
+    /**
+     * Run the commands of a pipeline (e.g. 'cat file | head') concurrently,
+     * connecting the output of each command to the input of the next one via a pipe.
+     */
+    void executePipeline(const Util::Array<Util::String> &commands, const Util::String &outputPath, bool async) const;
+
     static void executeBinary(const Util::String &path, const Util::String &command, const Util::Array<Util::String> &arguments, const Util::String &outputPath, bool async);
 
+    static bool startBinary(const Util::String &path, const Util::String &command, const Util::Array<Util::String> &arguments, const Util::String &inputPath,
+                            const Util::String &outputPath, const Util::String &errorPath, Util::ArrayList<uint32_t> &processIds);
+
     bool isRunning = true;
     Util::String startDirectory;
     Util::String currentLine;
@@ -98,6 +107,7 @@ private:
     uint32_t historyIndex = 0;
 
     static const constexpr char *PATH = "/initrd/bin:/bin";
+    static const constexpr char *TERMINAL_PATH = "/device/terminal";
 };
 
 
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/interface.h"
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/base/StringView.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/graphic/Ansi.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/time/Timestamp.h"
+
+static const constexpr uint32_t ITERATIONS = 100;
+
+/**
+ * Build the same output string as 'ls' does for a directory, without printing it.
+ */
+uint32_t listDirectory(const Util::String &path) {
+    auto file = Util::Io::File(path);
+    if (!file.exists() || !file.isDirectory()) {
+        return 0;
+    }
+
+    auto string = Util::String();
+    const auto directoryPath = file.getCanonicalPath() + "/";
+    for (const auto &child : file.getChildren()) {
+        auto currentFile = Util::Io::File(directoryPath + child);
+        string += Util::Io::File::getTypeColor(currentFile);
+        string += child;
+        string += currentFile.isDirectory() ? "/" : "";
+        string += Util::Graphic::Ansi::FOREGROUND_DEFAULT;
+        string += " ";
+    }
+
+    return string.length();
+}
+
+uint32_t canonicalizePath(const Util::String &path) {
+    return Util::Io::File::getCanonicalPath(path + "/./../" + path + "/..").length();
+}
+
+uint32_t shortStrings(const Util::String &path) {
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < 10; i++) {
+        auto string = Util::String("ls");
+        auto copy = string;
+        copy = Util::String('-') + 'l';
+        result += copy.length() + (string == "ls");
+    }
+
+    return result;
+}
+
+uint32_t append(const Util::String &path) {
+    Util::String string;
+    for (uint32_t i = 0; i < 1000; i++) {
+        string += static_cast<char>('a' + i % 26);
+    }
+
+    return string.length();
+}
+
+uint32_t split(const Util::String &path) {
+    auto tokens = Util::String("/initrd/bin/shell --verbose -l /user/books/alice.txt").split(" ");
+    uint32_t result = 0;
+    for (const auto &token : tokens) {
+        result += token.beginsWith("-") + token.substring(1).length();
+    }
+
+    return result;
+}
+
+uint32_t format(const Util::String &path) {
+    return Util::String::format("%s: %u entries, %x", static_cast<const char*>(path), 42, 0xcafe).length();
+}
+
+void benchmark(const char *name, uint32_t (*function)(const Util::String&), const Util::String &path) {
+    auto startCount = getHeapAllocationCount();
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    uint32_t result = 0;
+
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        result += function(path);
+    }
+
+    auto time = static_cast<uint32_t>(Util::Time::getSystemTime().toMilliseconds() - start);
+    auto allocations = getHeapAllocationCount() - startCount;
+
+    Util::System::out << name << allocations / ITERATIONS << " allocations/run, " << time << " ms for " << ITERATIONS
+                      << " runs (checksum " << result << ")" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("String benchmark.\n"
+                               "Counts heap allocations of common string operations, e.g. listing a directory like 'ls' does.\n"
+                               "Usage: stringbench [PATH] (Default: /initrd/bin)\n"
+                               "Options:\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    auto path = arguments.length() == 0 ? Util::String("/initrd/bin") : arguments[0];
+    if (!Util::Io::File(path).exists()) {
+        Util::System::error << "stringbench: '" << path << "' not found!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    benchmark("ls:             ", listDirectory, path);
+    benchmark("Canonical path: ", canonicalizePath, path);
+    benchmark("Short strings:  ", shortStrings, path);
+    benchmark("Append:         ", append, path);
+    benchmark("Split:          ", split, path);
+    benchmark("Format:         ", format, path);
+
+    return 0;
+}
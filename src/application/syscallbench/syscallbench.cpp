@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/base/SystemCallRing.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/base/String.h"
+#include "lib/util/time/Timestamp.h"
+#include "lib/util/io/stream/PrintStream.h"
+#include "lib/interface.h"
+
+static const constexpr uint32_t WRITE_SIZE = 16;
+
+uint32_t calculateRate(uint32_t operations, uint32_t milliseconds) {
+    // Applications are linked without libgcc, so 64-bit divisions are not available
+    if (milliseconds == 0) {
+        milliseconds = 1;
+    }
+
+    return operations < UINT32_MAX / 1000 ? operations * 1000 / milliseconds : operations / milliseconds * 1000;
+}
+
+uint32_t benchmarkSingleCalls(int32_t fileDescriptor, const uint8_t *buffer, uint32_t operations) {
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    for (uint32_t i = 0; i < operations; i++) {
+        writeToFile(fileDescriptor, buffer, WRITE_SIZE);
+    }
+
+    return Util::Time::getSystemTime().toMilliseconds() - start;
+}
+
+uint32_t benchmarkVectoredCalls(int32_t fileDescriptor, uint8_t *buffer, uint32_t operations, uint32_t batchSize) {
+    auto vectors = Util::Array<Util::Io::File::IoVector>(batchSize);
+    for (auto &vector : vectors) {
+        vector = Util::Io::File::IoVector{buffer, WRITE_SIZE};
+    }
+
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    for (uint32_t i = 0; i < operations; i += batchSize) {
+        auto count = operations - i < batchSize ? operations - i : batchSize;
+        writeToFileVectored(fileDescriptor, &vectors[0], count);
+    }
+
+    return Util::Time::getSystemTime().toMilliseconds() - start;
+}
+
+uint32_t benchmarkRing(int32_t fileDescriptor, const uint8_t *buffer, uint32_t operations, uint32_t batchSize, uint32_t &failed) {
+    auto ring = Util::SystemCallRing(batchSize);
+    auto written = Util::Array<uint64_t>(ring.getSize());
+    auto completion = Util::SystemCallRing::Completion{};
+
+    auto start = Util::Time::getSystemTime().toMilliseconds();
+    for (uint32_t i = 0; i < operations;) {
+        // Fill the ring (the slot is used as user data, to find the result of each write)
+        uint32_t slot = 0;
+        while (i < operations && ring.submit(slot, Util::System::WRITE_TO_FILE, 4, fileDescriptor, buffer, static_cast<uint64_t>(WRITE_SIZE), &written[slot])) {
+            slot++;
+            i++;
+        }
+
+        ring.enter();
+        while (ring.reap(completion)) {
+            if (!completion.result || written[completion.userData] != WRITE_SIZE) {
+                failed++;
+            }
+        }
+    }
+
+    return Util::Time::getSystemTime().toMilliseconds() - start;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.addArgument("batch", false, "b");
+    argumentParser.setHelpText("System call throughput benchmark.\n"
+                               "Writes small buffers to /device/null with single system calls, vectored writes and a system call ring.\n"
+                               "Usage: syscallbench [OPERATIONS] (Default: 100000 operations)\n"
+                               "Options:\n"
+                               "  -b, --batch [SIZE]: Operations per vectored write or ring trap (Default: 64)\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    auto operations = static_cast<uint32_t>(arguments.length() == 0 ? 100000 : Util::String::parseInt(arguments[0]));
+    auto batchSize = static_cast<uint32_t>(argumentParser.hasArgument("batch") ? Util::String::parseInt(argumentParser.getArgument("batch")) : 64);
+    if (operations == 0 || batchSize == 0) {
+        Util::System::error << "syscallbench: Operations and batch size must be greater than 0!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto fileDescriptor = openFile("/device/null");
+    if (fileDescriptor < 0) {
+        Util::System::error << "syscallbench: Unable to open '/device/null'!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    uint8_t buffer[WRITE_SIZE];
+    Util::Address<uint32_t>(buffer).setRange(0, WRITE_SIZE);
+    uint32_t failed = 0;
+
+    Util::System::out << "Running " << operations << " writes of " << WRITE_SIZE << " bytes (batch size " << batchSize << ")..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    auto singleTime = benchmarkSingleCalls(fileDescriptor, buffer, operations);
+    auto vectoredTime = benchmarkVectoredCalls(fileDescriptor, buffer, operations, batchSize);
+    auto ringTime = benchmarkRing(fileDescriptor, buffer, operations, batchSize, failed);
+    closeFile(fileDescriptor);
+
+    Util::System::out << "Single calls:   " << singleTime << " ms (" << calculateRate(operations, singleTime) << " calls/s)" << Util::Io::PrintStream::endl
+                      << "Vectored calls: " << vectoredTime << " ms (" << calculateRate(operations, vectoredTime) << " writes/s, " << calculateRate((operations + batchSize - 1) / batchSize, vectoredTime) << " traps/s)" << Util::Io::PrintStream::endl
+                      << "Ring:           " << ringTime << " ms (" << calculateRate(operations, ringTime) << " calls/s)" << Util::Io::PrintStream::endl;
+
+    if (failed > 0) {
+        Util::System::out << failed << " ring submissions failed!" << Util::Io::PrintStream::endl;
+    }
+
+    Util::System::out << Util::Io::PrintStream::flush;
+    return failed == 0 ? 0 : -1;
+}
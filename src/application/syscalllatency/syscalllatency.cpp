@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+#include "lib/util/base/ArgumentParser.h"
+#include "lib/util/base/String.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/hardware/CpuId.h"
+#include "lib/util/time/Timestamp.h"
+#include "lib/util/io/stream/PrintStream.h"
+
+uint64_t readTimestampCounter() {
+    uint64_t cycles;
+    asm volatile ("rdtsc" : "=A"(cycles));
+    return cycles;
+}
+
+static const constexpr uint32_t ROUND_SIZE = 1000;
+
+/**
+ * Run a system call in rounds of ROUND_SIZE calls and return the average cycles per call.
+ * Each round is measured separately, so that only 32-bit divisions are needed.
+ */
+template<typename T>
+uint32_t measure(uint32_t rounds, T call) {
+    uint32_t cycles = 0;
+    for (uint32_t round = 0; round < rounds; round++) {
+        auto start = readTimestampCounter();
+        for (uint32_t i = 0; i < ROUND_SIZE; i++) {
+            call();
+        }
+
+        cycles += static_cast<uint32_t>(readTimestampCounter() - start) / ROUND_SIZE;
+    }
+
+    return cycles / rounds;
+}
+
+uint32_t benchmarkNullCall(uint32_t rounds) {
+    return measure(rounds, []() {
+        Util::System::call(Util::System::NO_OPERATION, 0);
+    });
+}
+
+uint32_t benchmarkSystemTime(uint32_t rounds) {
+    return measure(rounds, []() {
+        Util::Time::Timestamp systemTime;
+        Util::System::call(Util::System::GET_SYSTEM_TIME, 1, &systemTime);
+    });
+}
+
+uint32_t benchmarkTimePage(uint32_t rounds) {
+    // Reads the time page, which the kernel maps into every process (no system call)
+    return measure(rounds, []() {
+        Util::Time::getSystemTime();
+    });
+}
+
+void runBenchmark(const char *name, uint32_t rounds) {
+    // Warm up caches and TLB, before measuring
+    benchmarkNullCall(1);
+
+    auto nullCycles = benchmarkNullCall(rounds);
+    auto timeCycles = benchmarkSystemTime(rounds);
+    Util::System::out << name << nullCycles << " cycles/call (null), " << timeCycles << " cycles/call (get system time)" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+}
+
+int32_t main(int32_t argc, char *argv[]) {
+    auto argumentParser = Util::ArgumentParser();
+    argumentParser.setHelpText("System call latency benchmark.\n"
+                               "Measures the cycles needed for a null system call and for reading the system time,\n"
+                               "entering the kernel via 'int 0x86' and via 'sysenter' (if supported by the CPU).\n"
+                               "Reading the system time from the time page is measured for comparison.\n"
+                               "Usage: syscalllatency [ITERATIONS] (Default: 100000 iterations)\n"
+                               "Options:\n"
+                               "  -h, --help: Show this help message");
+
+    if (!argumentParser.parse(argc, argv)) {
+        Util::System::error << argumentParser.getErrorString() << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    if (!Util::Hardware::CpuId::isAvailable() || (Util::Hardware::CpuId::getCpuFeatureBits() & Util::Hardware::CpuId::TSC) == 0) {
+        Util::System::error << "syscalllatency: The CPU does not support the time stamp counter!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto arguments = argumentParser.getUnnamedArguments();
+    auto iterations = static_cast<uint32_t>(arguments.length() == 0 ? 100000 : Util::String::parseInt(arguments[0]));
+    if (iterations < ROUND_SIZE) {
+        Util::System::error << "syscalllatency: Iterations must be at least " << ROUND_SIZE << "!" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+        return -1;
+    }
+
+    auto rounds = iterations / ROUND_SIZE;
+
+    auto defaultMethod = Util::System::getEntryMethod();
+    Util::System::out << "Running " << rounds * ROUND_SIZE << " iterations per system call..." << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+
+    Util::System::setEntryMethod(Util::System::INTERRUPT);
+    runBenchmark("int 0x86: ", rounds);
+
+    if (Util::System::setEntryMethod(Util::System::SYSENTER) == Util::System::SYSENTER) {
+        runBenchmark("sysenter: ", rounds);
+    } else {
+        Util::System::out << "sysenter: Not supported by this CPU" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    }
+
+    Util::System::setEntryMethod(defaultMethod);
+    Util::System::out << "time page: " << benchmarkTimePage(rounds) << " cycles/call (get system time)" << Util::Io::PrintStream::endl << Util::Io::PrintStream::flush;
+    return 0;
+}
@@ -28,6 +28,7 @@
 #include "kernel/process/ThreadState.h"
 #include "kernel/service/SchedulerService.h"
 #include "kernel/system/TaskStateSegment.h"
+#include "kernel/system/SystemCall.h"
 
 // Import functions
 extern "C" {
@@ -47,6 +48,7 @@ void bootstrap_paging(uint32_t*, uint32_t*);
 void enable_interrupts();
 void disable_interrupts();
 void dispatch_interrupt(Kernel::InterruptFrame*);
+void dispatch_fast_system_call(Kernel::InterruptFrame*);
 void set_tss_stack_entry(uint32_t);
 void flush_tss();
 void release_scheduler_lock();
@@ -102,6 +104,10 @@ void dispatch_interrupt(Kernel::InterruptFrame *frame) {
     }
 }
 
+void dispatch_fast_system_call(Kernel::InterruptFrame *frame) {
+    Kernel::SystemCall::dispatch(*frame);
+}
+
 void set_tss_stack_entry(uint32_t esp0) {
     Kernel::System::getTaskStateSegment().esp0 = esp0 + sizeof(Kernel::InterruptFrame);
     Kernel::System::getTaskStateSegment().ss0 = 0x10;
@@ -18,7 +18,8 @@
 #include "asm_interface.h"
 #include "lib/util/base/System.h"
 #include "Cpu.h"
-#include "lib/util/async/Atomic.h"
+#include "kernel/system/System.h"
+#include "kernel/service/InterruptService.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/collection/Collection.h"
 #include "lib/util/collection/Iterator.h"
@@ -42,32 +43,40 @@ const char *Cpu::softwareExceptions[]{
         "PagingError Exception", "UnsupportedOperation Exception"
 };
 
-int32_t Cpu::cliCount = 1; // Interrupts are disabled on startup
+// Interrupts are disabled on startup. Only the BSP (local APIC id 0) uses the counter before enabling them,
+// application processors enable their interrupts directly and start with a count of 0.
+int32_t Cpu::cliCount[MAX_CPU_COUNT] = {1};
 
 void Cpu::enableInterrupts() {
-    auto cliCountWrapper = Util::Async::Atomic<int32_t>(cliCount);
-    int count = cliCountWrapper.fetchAndDec();
+    // Interrupts are still disabled, so the executing thread cannot be moved to another CPU while the counter is changed
+    auto &count = cliCount[getCpuId()];
+    if (count < 1) {
+        // nmiCount would be decreased to a negative value -> Illegal state
+        Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "CPU: nmiCount is less than 0!");
+    }
 
-    if (count == 1) {
+    count = count - 1;
+    if (count == 0) {
         // nmiCount has been decreased to 0 -> Enable interrupts
         asm volatile ( "sti" );
-    } else if (count < 1) {
-        // nmiCount has been decreased to a negative value -> Illegal state
-        Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "CPU: nmiCount is less than 0!");
     }
 }
 
 void Cpu::disableInterrupts() {
-    auto cliCountWrapper = Util::Async::Atomic<int32_t>(cliCount);
-    int count = cliCountWrapper.fetchAndInc();
+    // Disable interrupts before looking up the counter, so that the executing thread cannot be moved to another CPU
+    asm volatile ( "cli" );
 
-    if (count == 0) {
-        // nmiCount has been increased from 0 to 1 -> Disable interrupts
-        asm volatile ( "cli" );
-    } else if (count < 0) {
+    auto &count = cliCount[getCpuId()];
+    if (count < 0) {
         // nmiCount is negative -> Illegal state
         Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "CPU: nmiCount is less than 0!");
     }
+
+    count = count + 1;
+}
+
+uint8_t Cpu::getCpuId() {
+    return Kernel::System::isServiceRegistered(Kernel::InterruptService::SERVICE_ID) ? Kernel::System::getService<Kernel::InterruptService>().getCpuId() : 0;
 }
 
 void Cpu::halt() {
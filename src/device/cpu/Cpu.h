@@ -78,12 +78,12 @@ public:
     ~Cpu() = delete;
 
     /**
-     * Enable hardware interrupts on CPU.
+     * Enable hardware interrupts on the executing CPU, if this call matches the outermost call to disableInterrupts().
      */
     static void enableInterrupts();
 
     /**
-     * Disable hardware interrupts on CPU.
+     * Disable hardware interrupts on the executing CPU. Interrupt handlers on other CPUs are not affected.
      */
     static void disableInterrupts();
 
@@ -148,11 +148,15 @@ private:
     static const char *hardwareExceptions[];
     static const char *softwareExceptions[];
 
+    [[nodiscard]] static uint8_t getCpuId();
+
+    static const constexpr uint32_t MAX_CPU_COUNT = 256;
+
     /**
-     * Keeps track of how often disableInterrupts() and enableInterrupts() have been called.
-     * Interrupts stay disabled, as long as this number is greater than zero.
+     * Keeps track of how often disableInterrupts() and enableInterrupts() have been called on each CPU (indexed by local APIC id).
+     * Interrupts stay disabled on a CPU, as long as its number is greater than zero.
      */
-    static int32_t cliCount;
+    static int32_t cliCount[MAX_CPU_COUNT];
 };
 
 }
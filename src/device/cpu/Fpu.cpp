@@ -36,17 +36,12 @@ namespace Device {
 
 Kernel::Logger Fpu::log = Kernel::Logger::get("FPU");
 
-Fpu::Fpu(const uint8_t *defaultFpuContext) {
-    disarmFpuMonitor();
+Fpu::Fpu(const uint8_t *defaultFpuContext, uint32_t cpuCount) : lastFpuThreads(cpuCount) {
+    for (auto *&thread : lastFpuThreads) {
+        thread = nullptr;
+    }
 
-    // Make sure FPU emulation is disabled
-    asm volatile (
-            "mov %%cr0, %%eax;"
-            "and $0xfffffffb, %%eax;"
-            "mov %%eax, %%cr0;"
-            : : :
-            "eax"
-            );
+    configureCurrentCpu();
 
     if (Device::Fpu::isFxsrAvailable()) {
         log.info("FXSR support detected -> Using FXSAVE/FXRSTR for FPU context switching");
@@ -58,13 +53,6 @@ Fpu::Fpu(const uint8_t *defaultFpuContext) {
 
         if (features.contains(Util::Hardware::CpuId::SSE)) {
             log.info("SSE support detected -> Activating OSFXSR and OSXMMEXCPT");
-            asm volatile (
-                    "mov %%cr4, %%eax;"
-                    "or $0x00000600, %%eax;"
-                    "mov %%eax, %%cr4;"
-                    : : :
-                    "eax"
-                    );
         }
 
         asm volatile (
@@ -84,6 +72,31 @@ Fpu::Fpu(const uint8_t *defaultFpuContext) {
     }
 }
 
+void Fpu::configureCurrentCpu() {
+    disarmFpuMonitor();
+
+    // Make sure FPU emulation is disabled
+    asm volatile (
+            "mov %%cr0, %%eax;"
+            "and $0xfffffffb, %%eax;"
+            "mov %%eax, %%cr0;"
+            : : :
+            "eax"
+            );
+
+    if (isFxsrAvailable() && Util::Hardware::CpuId::getCpuFeatures().contains(Util::Hardware::CpuId::SSE)) {
+        asm volatile (
+                "mov %%cr4, %%eax;"
+                "or $0x00000600, %%eax;"
+                "mov %%eax, %%cr4;"
+                : : :
+                "eax"
+                );
+    }
+
+    asm volatile ("fninit");
+}
+
 void Fpu::plugin() {
     Kernel::System::getService<Kernel::InterruptService>().assignInterrupt(Kernel::InterruptVector::DEVICE_NOT_AVAILABLE, *this);
 }
@@ -96,15 +109,16 @@ void Fpu::trigger(const Kernel::InterruptFrame &frame) {
     disarmFpuMonitor();
 
     auto &currentThread = schedulerService.getCurrentThread();
+    auto *&lastFpuThread = lastFpuThreads[Kernel::System::getService<Kernel::InterruptService>().getCpuId()];
     if (&currentThread == lastFpuThread) {
         schedulerService.unlockScheduler();
         return;
     }
 
     if (fxsrAvailable) {
-        switchContext(currentThread);
+        switchContext(lastFpuThread, currentThread);
     } else {
-        switchContextFpuOnly(currentThread);
+        switchContextFpuOnly(lastFpuThread, currentThread);
     }
 
     lastFpuThread = &currentThread;
@@ -112,8 +126,14 @@ void Fpu::trigger(const Kernel::InterruptFrame &frame) {
 }
 
 void Fpu::checkTerminatedThread(Kernel::Thread &thread) {
-    Util::Async::Atomic<uint32_t> wrapper(reinterpret_cast<uint32_t&>(lastFpuThread));
-    wrapper.compareAndSet(reinterpret_cast<uint32_t>(&thread), 0);
+    for (auto *&lastFpuThread : lastFpuThreads) {
+        Util::Async::Atomic<uint32_t> wrapper(reinterpret_cast<uint32_t&>(lastFpuThread));
+        wrapper.compareAndSet(reinterpret_cast<uint32_t>(&thread), 0);
+    }
+}
+
+bool Fpu::isContextLoaded(const Kernel::Thread &thread, uint8_t cpuId) const {
+    return lastFpuThreads[cpuId] == &thread;
 }
 
 bool Fpu::isAvailable() {
@@ -154,7 +174,7 @@ bool Fpu::probeFpu() {
     return fpuStatus == 0;
 }
 
-void Fpu::switchContext(Kernel::Thread &currentThread) {
+void Fpu::switchContext(Kernel::Thread *lastFpuThread, Kernel::Thread &currentThread) {
     if (lastFpuThread != nullptr) {
         asm volatile (
                 "fxsave (%0)"
@@ -170,7 +190,7 @@ void Fpu::switchContext(Kernel::Thread &currentThread) {
             );
 }
 
-void Fpu::switchContextFpuOnly(Kernel::Thread &currentThread) {
+void Fpu::switchContextFpuOnly(Kernel::Thread *lastFpuThread, Kernel::Thread &currentThread) {
     if (lastFpuThread != nullptr) {
         asm volatile (
                 "fnsave (%0)"
@@ -21,6 +21,7 @@
 #include <cstdint>
 
 #include "kernel/interrupt/InterruptHandler.h"
+#include "lib/util/collection/Array.h"
 
 namespace Kernel {
 class Logger;
@@ -35,8 +36,11 @@ class Fpu : public Kernel::InterruptHandler {
 public:
     /**
      * Constructor.
+     *
+     * @param defaultFpuContext Memory, in which the initial FPU context is stored
+     * @param cpuCount The amount of CPUs (one lazily switched FPU context per local APIC id)
      */
-    explicit Fpu(const uint8_t *defaultFpuContext);
+    Fpu(const uint8_t *defaultFpuContext, uint32_t cpuCount);
 
     /**
      * Copy Constructor.
@@ -59,6 +63,18 @@ public:
 
     void checkTerminatedThread(Kernel::Thread &thread);
 
+    /**
+     * Check, if the FPU context of a thread currently resides in the FPU registers of the given CPU.
+     * Such a thread must not be migrated to another CPU, since its saved context is outdated.
+     */
+    [[nodiscard]] bool isContextLoaded(const Kernel::Thread &thread, uint8_t cpuId) const;
+
+    /**
+     * Enable the FPU (and SSE, if available) on the executing CPU.
+     * This needs to be done once on every CPU, before threads are scheduled on it.
+     */
+    static void configureCurrentCpu();
+
     static bool isAvailable();
 
     static bool isFxsrAvailable();
@@ -69,14 +85,14 @@ public:
 
 private:
 
-    void switchContext(Kernel::Thread &currentThread);
+    void switchContext(Kernel::Thread *lastFpuThread, Kernel::Thread &currentThread);
 
-    void switchContextFpuOnly(Kernel::Thread &currentThread);
+    void switchContextFpuOnly(Kernel::Thread *lastFpuThread, Kernel::Thread &currentThread);
 
     static bool probeFpu();
 
     bool fxsrAvailable = isFxsrAvailable();
-    Kernel::Thread *lastFpuThread = nullptr;
+    Util::Array<Kernel::Thread*> lastFpuThreads;
 
     static Kernel::Logger log;
 };
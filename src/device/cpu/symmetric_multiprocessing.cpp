@@ -23,6 +23,11 @@
 #include "device/interrupt/apic/Apic.h"
 #include "kernel/system/System.h"
 #include "kernel/service/InterruptService.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/SystemCall.h"
+
+extern uint32_t scheduler_initialized;
 
 namespace Device {
 
@@ -36,16 +41,26 @@ Kernel::Logger log = Kernel::Logger::get("SMP");
     auto &apic = interruptService.getApic();
     apic.initializeCurrentLocalApic();
     apic.enableCurrentErrorHandler();
-    // Disabled, since it causes a memory allocation
-    // apic.startCurrentTimer();
+
+    // Each CPU has its own TSS and SYSENTER registers
+    Kernel::SystemCall::initializeFastEntry(Kernel::System::getTaskStateSegment());
 
     runningApplicationProcessors[apicId] = true; // Mark this AP as running
 
-    // Enable interrupts for this AP (usually results in a crash)
-    // asm volatile ("sti");
+    // Wait until the BSP has started the scheduler, before taking part in scheduling
+    while (!scheduler_initialized) {
+        asm volatile ("pause");
+    }
+
+    // Register this CPU at the memory service, so that it receives TLB shootdowns from now on
+    auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
+    memoryService.switchAddressSpace(memoryService.getKernelAddressSpace());
+    apic.startCurrentTimer();
 
-    // Bore the AP to death. Sadly we can't do anything here, as the paging is not designed to work with multiple CPUs.
-    while (true) {}
+    // Enable interrupts for this AP (its counter in Cpu::cliCount starts at 0, since interrupts are enabled directly)
+    // and start scheduling threads from the other CPUs' run queues
+    asm volatile ("sti");
+    Kernel::System::getService<Kernel::SchedulerService>().startApplicationProcessor();
 }
 
 }
\ No newline at end of file
@@ -128,6 +128,7 @@ void LinearFrameBufferTerminal::setCursor(bool enabled) {
 
         cursorRunnable = new CursorRunnable(*this, cursor);
         auto &cursorThread = Kernel::Thread::createKernelThread("Cursor", processService.getKernelProcess(), cursorRunnable);
+        schedulerService.setPriority(cursorThread, Util::Async::Thread::HIGH);
         schedulerService.ready(cursorThread);
     } else if (cursorRunnable != nullptr) {
         cursorRunnable->stop();
@@ -36,9 +36,7 @@ namespace Device {
 
 Kernel::Logger Keyboard::log = Kernel::Logger::get("Keyboard");
 
-Keyboard::Keyboard(Ps2Controller &controller) : Ps2Device(controller, Ps2Controller::FIRST), Util::Io::FilterInputStream(inputStream) {
-    outputStream.connect(inputStream);
-}
+Keyboard::Keyboard(Ps2Controller &controller) : Ps2Device(controller, Ps2Controller::FIRST), Util::Io::FilterInputStream(inputStream) {}
 
 Keyboard* Keyboard::initialize(Ps2Controller &controller) {
     auto *keyboard = new Keyboard(controller);
@@ -172,7 +170,8 @@ void Keyboard::trigger(const Kernel::InterruptFrame &frame) {
     }
 
     uint8_t data = controller.readDataByte();
-    outputStream.write(data);
+    // Never blocks -> If nobody reads the keyboard, further scancodes are dropped
+    inputStream.write(data);
 }
 
 }
\ No newline at end of file
@@ -21,10 +21,9 @@
 #include <cstdint>
 
 #include "kernel/interrupt/InterruptHandler.h"
-#include "lib/util/io/stream/PipedOutputStream.h"
 #include "Ps2Device.h"
 #include "lib/util/io/stream/FilterInputStream.h"
-#include "lib/util/io/stream/PipedInputStream.h"
+#include "lib/util/io/stream/RingBufferInputStream.h"
 
 namespace Kernel {
 class Logger;
@@ -132,8 +131,7 @@ private:
 
     uint8_t leds{};
 
-    Util::Io::PipedOutputStream outputStream;
-    Util::Io::PipedInputStream inputStream;
+    Util::Io::RingBufferInputStream inputStream;
 
     static Kernel::Logger log;
 };
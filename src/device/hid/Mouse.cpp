@@ -38,9 +38,7 @@ namespace Device {
 
 Kernel::Logger Mouse::log = Kernel::Logger::get("Mouse");
 
-Mouse::Mouse(Ps2Controller &controller) : Ps2Device(controller, Ps2Controller::SECOND), Util::Io::FilterInputStream(inputStream), qemuMode(FirmwareConfiguration::isAvailable()) {
-    outputStream.connect(inputStream);
-}
+Mouse::Mouse(Ps2Controller &controller) : Ps2Device(controller, Ps2Controller::SECOND), Util::Io::FilterInputStream(inputStream), qemuMode(FirmwareConfiguration::isAvailable()) {}
 
 Mouse* Mouse::initialize(Ps2Controller &controller) {
     auto *mouse = new Mouse(controller);
@@ -175,14 +173,13 @@ void Mouse::trigger(const Kernel::InterruptFrame &frame) {
             }
 
             // Write data: 1. button mask, 2. relative x-movement, 3. relative y-movement (inverted)
-            outputStream.write(flags & 0x07);
-
+            // The packet is written at once, so that a full buffer drops whole packets instead of single bytes
             if (qemuMode) {
-                outputStream.write(dy);
-                outputStream.write(-dx);
+                const uint8_t packet[3] = { static_cast<uint8_t>(flags & 0x07), static_cast<uint8_t>(dy), static_cast<uint8_t>(-dx) };
+                inputStream.write(packet, 0, 3);
             } else {
-                outputStream.write(dx);
-                outputStream.write(-dy);
+                const uint8_t packet[3] = { static_cast<uint8_t>(flags & 0x07), static_cast<uint8_t>(dx), static_cast<uint8_t>(-dy) };
+                inputStream.write(packet, 0, 3);
             }
 
             // Reset cycle
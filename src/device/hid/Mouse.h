@@ -23,8 +23,7 @@
 #include "kernel/interrupt/InterruptHandler.h"
 #include "lib/util/io/stream/FilterInputStream.h"
 #include "Ps2Device.h"
-#include "lib/util/io/stream/PipedInputStream.h"
-#include "lib/util/io/stream/PipedOutputStream.h"
+#include "lib/util/io/stream/RingBufferInputStream.h"
 
 namespace Kernel {
 class Logger;
@@ -99,8 +98,7 @@ private:
     int32_t dx = 0;
     int32_t dy = 0;
 
-    Util::Io::PipedOutputStream outputStream;
-    Util::Io::PipedInputStream inputStream;
+    Util::Io::RingBufferInputStream inputStream;
 
     static Kernel::Logger log;
 
@@ -33,10 +33,14 @@ namespace Device {
 
 Kernel::Logger Apic::log = Kernel::Logger::get("APIC");
 
-Apic::Apic(const Util::Array<LocalApic*> &localApics, IoApic *ioApic) : localApics(localApics), localTimers(localApics.length()), ioApic(ioApic) {
+Apic::Apic(const Util::Array<LocalApic*> &localApics, IoApic *ioApic) : localApics(localApics), localTimers(localApics.length()), taskStateSegments(localApics.length()), ioApic(ioApic) {
     for (auto *&localTimer : localTimers) {
         localTimer = nullptr;
     }
+
+    for (auto *&taskStateSegment : taskStateSegments) {
+        taskStateSegment = nullptr;
+    }
 }
 
 bool Apic::isAvailable() {
@@ -142,7 +146,8 @@ void Apic::sendEndOfInterrupt(Kernel::InterruptVector vector) {
 }
 
 bool Apic::isLocalInterrupt(Kernel::InterruptVector vector) {
-    return vector >= Kernel::InterruptVector::CMCI && vector <= Kernel::InterruptVector::ERROR;
+    // IPIs are delivered through the local APIC as well and need to be EOId there
+    return vector >= Kernel::InterruptVector::TLB_SHOOTDOWN && vector <= Kernel::InterruptVector::ERROR;
 }
 
 bool Apic::isExternalInterrupt(Kernel::InterruptVector vector) {
@@ -282,6 +287,14 @@ bool Apic::isSymmetricMultiprocessingSupported() const {
     return localApics.length() > 1;
 }
 
+uint32_t Apic::getCpuCount() const {
+    return localApics.length();
+}
+
+Kernel::TaskStateSegment* Apic::getCurrentTaskStateSegment() const {
+    return taskStateSegments[LocalApic::getId()];
+}
+
 void Apic::startupApplicationProcessors() {
     void *gdtPointers = prepareApplicationProcessorGdts();
     void *stackPointers = prepareApplicationProcessorStacks();
@@ -435,13 +448,13 @@ void *Apic::prepareApplicationProcessorGdts() {
             continue;
         }
 
-        gdts[i] = allocateApplicationProcessorGdt();
+        gdts[i] = allocateApplicationProcessorGdt(i);
     }
 
     return reinterpret_cast<void *>(gdts);
 }
 
-Cpu::Descriptor *Apic::allocateApplicationProcessorGdt() {
+Cpu::Descriptor *Apic::allocateApplicationProcessorGdt(uint8_t apicId) {
     // Allocate memory for the GDT and TSS. This is never freed, as its used as long as the system runs.
     auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
 
@@ -453,6 +466,7 @@ Cpu::Descriptor *Apic::allocateApplicationProcessorGdt() {
     // Zero everything
     Util::Address<uint32_t>(gdt).setRange(0, 48);
     Util::Address<uint32_t>(tss).setRange(0, tssSize);
+    taskStateSegments[apicId] = reinterpret_cast<Kernel::TaskStateSegment*>(tss);
 
     // Set up general GDT for the AP
     // First entry has to be null
@@ -30,6 +30,10 @@
 #include "device/time/ApicTimer.h"
 #include "device/cpu/Cpu.h"
 
+namespace Kernel {
+struct TaskStateSegment;
+}  // namespace Kernel
+
 namespace Device {
 
 class Apic {
@@ -127,6 +131,18 @@ public:
     ApicTimer &getCurrentTimer();
 
     [[nodiscard]] bool isSymmetricMultiprocessingSupported() const;
+
+    /**
+     * Get the amount of local APIC slots (highest local APIC id + 1).
+     * Slots of ids, that are not used by a processor, are counted as well.
+     */
+    [[nodiscard]] uint32_t getCpuCount() const;
+
+    /**
+     * Get the task state segment of the current CPU, which has been allocated during AP startup.
+     * The BSP uses the system's TSS, so nullptr is returned for it.
+     */
+    [[nodiscard]] Kernel::TaskStateSegment* getCurrentTaskStateSegment() const;
     
     void startupApplicationProcessors();
     
@@ -164,7 +180,7 @@ private:
      * This is basically a shorter and slightly modified version of System::InitializeGlobalDescriptorTables.
      * The main difference is that only a single GDT is used and its memory is allocated by this function.
      */
-    Cpu::Descriptor* allocateApplicationProcessorGdt();
+    Cpu::Descriptor* allocateApplicationProcessorGdt(uint8_t apicId);
 
     Kernel::GlobalSystemInterrupt getIrqOverride(InterruptRequest interruptRequest);
 
@@ -177,6 +193,7 @@ private:
     // Once the switch from PIC to APIC is done, it can't be switched back.
     Util::Array<LocalApic*> localApics;  // All LocalApic instances.
     Util::Array<ApicTimer*> localTimers; // All ApicTimer instances.
+    Util::Array<Kernel::TaskStateSegment*> taskStateSegments; // The TSS of each AP (nullptr for the BSP).
     IoApic *ioApic;                      // The IoApic instance responsible for the external interrupts.
     LocalApicErrorHandler errorHandler;  // The interrupt handler that gets triggered on an internal APIC error.
 
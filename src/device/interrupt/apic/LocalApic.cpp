@@ -274,6 +274,18 @@ void LocalApic::sendStartupInterProcessorInterrupt(uint8_t id, uint32_t startupC
     writeInterruptCommandRegister(icrEntry); // Writing ICR issues IPI
 }
 
+void LocalApic::sendFixedInterProcessorInterrupt(uint8_t id, Kernel::InterruptVector vector) {
+    InterruptCommandRegisterEntry icrEntry{};
+    icrEntry.vector = vector;
+    icrEntry.deliveryMode = InterruptCommandRegisterEntry::DeliveryMode::FIXED;
+    icrEntry.destinationMode = InterruptCommandRegisterEntry::DestinationMode::PHYSICAL;
+    icrEntry.level = InterruptCommandRegisterEntry::Level::ASSERT;
+    icrEntry.triggerMode = InterruptCommandRegisterEntry::TriggerMode::EDGE;
+    icrEntry.destinationShorthand = InterruptCommandRegisterEntry::DestinationShorthand::NO;
+    icrEntry.destination = id;
+    writeInterruptCommandRegister(icrEntry); // Writing ICR issues IPI
+}
+
 void LocalApic::waitForInterProcessorInterruptDispatch() {
     do {
         // Spinloop: Pause prevents speculative memory reads, memory prevents compiler memory reordering,
@@ -331,6 +331,16 @@ public:
      */
     static void sendStartupInterProcessorInterrupt(uint8_t id, uint32_t startupCodeAddress);
 
+    /**
+     * Send a FIXED IPI to another CPU.
+     *
+     * The target CPU handles the IPI like a regular interrupt, using the given vector number.
+     *
+     * @param id The local APIC id/CPU id of the target CPU
+     * @param vector The interrupt vector, that is triggered on the target CPU
+     */
+    static void sendFixedInterProcessorInterrupt(uint8_t id, Kernel::InterruptVector vector);
+
     /**
      * Poll the ICR until the delivery status bit is unset.
      */
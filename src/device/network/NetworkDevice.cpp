@@ -19,7 +19,6 @@
 
 #include "kernel/system/System.h"
 #include "kernel/service/ProcessService.h"
-#include "lib/util/async/Thread.h"
 #include "device/network/PacketReader.h"
 #include "device/network/PacketWriter.h"
 #include "kernel/process/Thread.h"
@@ -27,6 +26,7 @@
 #include "kernel/service/SchedulerService.h"
 #include "lib/util/base/Address.h"
 #include "lib/util/base/Constants.h"
+#include "lib/util/base/Exception.h"
 #include "kernel/network/ethernet/EthernetModule.h"
 
 namespace Device::Network {
@@ -53,14 +53,19 @@ const Util::String& NetworkDevice::getIdentifier() const {
 }
 
 void NetworkDevice::sendPacket(const uint8_t *packet, uint32_t length) {
-    outgoingPacketLock.acquire();
+    // A slot is only returned after the packet writer has taken a packet out of the queue, so offer() cannot fail
+    freeOutgoingSlots.acquire();
+
     auto *buffer = reinterpret_cast<uint8_t*>(packetMemoryManager.allocateBlock());
     auto source = Util::Address<uint32_t>(packet);
     auto target = Util::Address<uint32_t>(buffer);
     target.copyRange(source, length);
 
-    outgoingPacketQueue.add(Packet{buffer, length});
-    outgoingPacketLock.release();
+    if (!outgoingPacketQueue.offer(Packet{buffer, length})) {
+        Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "NetworkDevice: Outgoing packet queue is full!");
+    }
+
+    outgoingPackets.release();
 }
 
 void NetworkDevice::handleIncomingPacket(const uint8_t *packet, uint32_t length) {
@@ -75,27 +80,46 @@ void NetworkDevice::handleIncomingPacket(const uint8_t *packet, uint32_t length)
 
     if (!incomingPacketQueue.offer(Packet{buffer, length})) {
         packetMemoryManager.freeBlock(buffer);
+        return;
     }
+
+    incomingPacketEvent.signal();
 }
 
 NetworkDevice::~NetworkDevice() {
     delete[] packetMemory;
 }
 
-NetworkDevice::Packet NetworkDevice::getNextIncomingPacket() {
-    while (incomingPacketQueue.isEmpty()) {
-        Util::Async::Thread::yield();
+uint32_t NetworkDevice::getNextIncomingPackets(Packet *packets, uint32_t maxCount) {
+    // Packets are queued by the interrupt handler, which can only signal an interrupt event
+    auto sequence = incomingPacketEvent.getSequence();
+    auto count = incomingPacketQueue.poll(packets, maxCount);
+    while (count == 0) {
+        incomingPacketEvent.wait(sequence);
+        sequence = incomingPacketEvent.getSequence();
+        count = incomingPacketQueue.poll(packets, maxCount);
     }
 
-    return incomingPacketQueue.poll();
+    return count;
 }
 
 NetworkDevice::Packet NetworkDevice::getNextOutgoingPacket() {
-    while (outgoingPacketQueue.isEmpty()) {
-        Util::Async::Thread::yield();
+    if (sparePermits > 0) {
+        sparePermits--;
+    } else {
+        outgoingPackets.acquire();
+    }
+
+    // The permit may belong to a packet behind the next one, whose sender has reserved its slot, but not published it yet.
+    // That sender releases another permit once it has published its packet, so wait for it and keep it for later.
+    Packet packet{};
+    while (!outgoingPacketQueue.poll(packet)) {
+        outgoingPackets.acquire();
+        sparePermits++;
     }
 
-    return outgoingPacketQueue.poll();
+    freeOutgoingSlots.release();
+    return packet;
 }
 
 void NetworkDevice::freePacketBuffer(void *buffer) {
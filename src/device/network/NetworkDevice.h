@@ -21,10 +21,12 @@
 #include <cstdint>
 
 #include "kernel/memory/BitmapMemoryManager.h"
-#include "lib/util/collection/ArrayBlockingQueue.h"
+#include "lib/util/collection/MpscRingBuffer.h"
+#include "lib/util/collection/SpscRingBuffer.h"
 #include "lib/util/network/MacAddress.h"
 #include "kernel/log/Logger.h"
-#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Semaphore.h"
+#include "lib/util/async/InterruptEvent.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/collection/Collection.h"
 #include "lib/util/collection/Iterator.h"
@@ -85,10 +87,23 @@ public:
 
     [[nodiscard]] virtual Util::Network::MacAddress getMacAddress() const = 0;
 
+    /**
+     * Queue a packet for being sent by the packet writer.
+     * Blocks, while the maximum amount of outgoing packets is queued.
+     */
     void sendPacket(const uint8_t *packet, uint32_t length);
 
-    Packet getNextIncomingPacket();
+    /**
+     * Take all packets, that have been received since the last call (up to 'maxCount').
+     * Blocks, until at least one packet is available.
+     *
+     * @return The amount of packets written to 'packets'
+     */
+    uint32_t getNextIncomingPackets(Packet *packets, uint32_t maxCount);
 
+    /**
+     * Take the next packet to send. May only be called by the packet writer and blocks, until a packet is available.
+     */
     Packet getNextOutgoingPacket();
 
 protected:
@@ -107,9 +122,15 @@ private:
 
     uint8_t *packetMemory;
     Kernel::BitmapMemoryManager packetMemoryManager;
-    Util::ArrayBlockingQueue<Packet> incomingPacketQueue;
-    Util::ArrayBlockingQueue<Packet> outgoingPacketQueue;
-    Util::Async::Spinlock outgoingPacketLock;
+    // Filled by the interrupt handler and drained by the packet reader -> Must never block
+    Util::SpscRingBuffer<Packet> incomingPacketQueue;
+    Util::Async::InterruptEvent incomingPacketEvent;
+    // Filled by any thread sending a packet and drained by the packet writer
+    Util::MpscRingBuffer<Packet> outgoingPacketQueue;
+    Util::Async::Semaphore outgoingPackets;
+    Util::Async::Semaphore freeOutgoingSlots = Util::Async::Semaphore(MAX_BUFFERED_PACKETS);
+    // Permits taken by the packet writer, while waiting for a packet, that had not been published yet
+    uint32_t sparePermits = 0;
 
     PacketReader *reader;
     PacketWriter *writer;
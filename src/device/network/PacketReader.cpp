@@ -34,11 +34,16 @@ PacketReader::PacketReader(Device::Network::NetworkDevice &networkDevice) : netw
 void PacketReader::run() {
     auto &ethernetModule = Kernel::System::getService<Kernel::NetworkService>().getNetworkStack().getEthernetModule();
 
+    NetworkDevice::Packet packets[NetworkDevice::MAX_BUFFERED_PACKETS];
+
     while (true) {
-        const auto &packet = networkDevice.getNextIncomingPacket();
-        auto stream = Util::Io::ByteArrayInputStream(packet.buffer, packet.length);
-        ethernetModule.readPacket(stream, Kernel::Network::NetworkModule::LayerInformation{Util::Network::MacAddress(), Util::Network::MacAddress(), packet.length}, networkDevice);
-        networkDevice.freePacketBuffer(packet.buffer);
+        auto count = networkDevice.getNextIncomingPackets(packets, NetworkDevice::MAX_BUFFERED_PACKETS);
+        for (uint32_t i = 0; i < count; i++) {
+            const auto &packet = packets[i];
+            auto stream = Util::Io::ByteArrayInputStream(packet.buffer, packet.length);
+            ethernetModule.readPacket(stream, Kernel::Network::NetworkModule::LayerInformation{Util::Network::MacAddress(), Util::Network::MacAddress(), packet.length}, networkDevice);
+            networkDevice.freePacketBuffer(packet.buffer);
+        }
     }
 }
 
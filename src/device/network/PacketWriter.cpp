@@ -24,16 +24,26 @@ PacketWriter::PacketWriter(Device::Network::NetworkDevice &networkDevice) : netw
 
 void PacketWriter::run() {
     while (true) {
-        const auto &packet = networkDevice.getNextOutgoingPacket();
-        if (packetQueue.offer(packet)) {
-            networkDevice.handleOutgoingPacket(packet.buffer, packet.length);
-            networkDevice.freePacketBuffer(packet.buffer);
+        const auto packet = networkDevice.getNextOutgoingPacket();
+
+        // The buffer must stay valid until the device has sent it, so it is freed by freeLastSendBuffer().
+        // The queue is drained by the interrupt handler -> Wait for its signal, until there is room again
+        auto sequence = sentPackets.getSequence();
+        while (!packetQueue.offer(packet)) {
+            sentPackets.wait(sequence);
+            sequence = sentPackets.getSequence();
         }
+
+        networkDevice.handleOutgoingPacket(packet.buffer, packet.length);
     }
 }
 
 void PacketWriter::freeLastSendBuffer() {
-    networkDevice.freePacketBuffer(packetQueue.poll().buffer);
+    NetworkDevice::Packet packet{};
+    if (packetQueue.poll(packet)) {
+        networkDevice.freePacketBuffer(packet.buffer);
+        sentPackets.signal();
+    }
 }
 
 }
\ No newline at end of file
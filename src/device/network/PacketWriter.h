@@ -19,9 +19,10 @@
 #define HHUOS_PACKETWRITER_H
 
 #include "lib/util/async/Runnable.h"
+#include "lib/util/async/InterruptEvent.h"
 #include "device/network/NetworkDevice.h"
 #include "lib/util/collection/Array.h"
-#include "lib/util/collection/ArrayBlockingQueue.h"
+#include "lib/util/collection/SpscRingBuffer.h"
 #include "lib/util/collection/Collection.h"
 #include "lib/util/collection/Iterator.h"
 
@@ -57,7 +58,10 @@ public:
 private:
 
     Device::Network::NetworkDevice &networkDevice;
-    Util::ArrayBlockingQueue<NetworkDevice::Packet> packetQueue = Util::ArrayBlockingQueue<NetworkDevice::Packet>(16);
+    // Packets handed to the device, which are freed by the interrupt handler once they have been sent
+    Util::SpscRingBuffer<NetworkDevice::Packet> packetQueue = Util::SpscRingBuffer<NetworkDevice::Packet>(16);
+    // Signaled by the interrupt handler, after it has freed a buffer
+    Util::Async::InterruptEvent sentPackets;
 };
 
 }
@@ -20,6 +20,7 @@
 
 #include "Rtl8139.h"
 
+#include "device/cpu/Cpu.h"
 #include "device/pci/Pci.h"
 #include "device/pci/PciDevice.h"
 #include "kernel/system/System.h"
@@ -32,6 +33,7 @@
 #include "kernel/log/Logger.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/base/Address.h"
+#include "lib/util/async/Atomic.h"
 
 namespace Kernel {
 struct InterruptFrame;
@@ -98,14 +100,29 @@ Util::Network::MacAddress Rtl8139::getMacAddress() const {
 }
 
 void Rtl8139::handleOutgoingPacket(const uint8_t *packet, uint32_t length) {
-    while (!isTransmitDescriptorAvailable()) {
-        Util::Async::Thread::sleep(Util::Time::Timestamp::ofMilliseconds(1));
+    // A descriptor may only be reused after the interrupt handler has reclaimed the buffer, which it has sent before
+    auto sequence = transmitEvent.getSequence();
+    while (Util::Async::Atomic<uint32_t>(pendingTransmits).get() == TRANSMIT_DESCRIPTOR_COUNT || !isTransmitDescriptorAvailable()) {
+        transmitEvent.wait(sequence);
+        sequence = transmitEvent.getSequence();
     }
 
     auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
     auto physicalAddress = memoryService.getPhysicalAddress(const_cast<uint8_t*>(packet));
+
+    // The descriptor must only be counted as pending after its status has been reset by setPacketSize().
+    // The interrupt handler must not run in between (on any CPU), since it would miss the completion of this descriptor.
+    // Do not use acquire() here, since it yields, which is not allowed with interrupts disabled
+    Cpu::disableInterrupts();
+    while (!transmitLock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+
     setTransmitAddress(physicalAddress);
     setPacketSize(length);
+    Util::Async::Atomic<uint32_t>(pendingTransmits).inc();
+    transmitLock.release();
+    Cpu::enableInterrupts();
 
     transmitDescriptor = (transmitDescriptor + 1) % TRANSMIT_DESCRIPTOR_COUNT;
 }
@@ -123,11 +140,10 @@ void Rtl8139::trigger(const Kernel::InterruptFrame &frame) {
             processIncomingPacket();
         }
         baseRegister.writeWord(INTERRUPT_STATUS, RECEIVE_OK);
-    } else if (interrupt & TRANSMIT_OK) {
-        freeLastSendBuffer();
-        baseRegister.writeWord(INTERRUPT_STATUS, TRANSMIT_OK);
-    } else if (interrupt & TRANSMIT_ERROR) {
-        baseRegister.writeWord(INTERRUPT_STATUS, TRANSMIT_ERROR);
+    } else if (interrupt & (TRANSMIT_OK | TRANSMIT_ERROR)) {
+        // Acknowledge first, so that a transmission completing during the scan raises a new interrupt
+        baseRegister.writeWord(INTERRUPT_STATUS, interrupt & (TRANSMIT_OK | TRANSMIT_ERROR));
+        reclaimTransmitDescriptors();
     } else if (interrupt & RECEIVE_ERROR) {
         baseRegister.writeWord(INTERRUPT_STATUS, RECEIVE_ERROR);
     }
@@ -138,6 +154,27 @@ bool Rtl8139::isTransmitDescriptorAvailable() {
     return (status & OWN);
 }
 
+void Rtl8139::reclaimTransmitDescriptors() {
+    // A single interrupt may cover several descriptors, so all completed ones (sent or aborted) are reclaimed in order
+    while (!transmitLock.tryAcquire()) {
+        asm volatile ("pause");
+    }
+
+    while (Util::Async::Atomic<uint32_t>(pendingTransmits).get() > 0) {
+        auto status = baseRegister.readDoubleWord(TRANSMIT_STATUS + reclaimDescriptor * 4);
+        if (!(status & (TRANSMIT_STATUS_OK | TRANSMIT_STATUS_ABORT))) {
+            break;
+        }
+
+        freeLastSendBuffer();
+        reclaimDescriptor = (reclaimDescriptor + 1) % TRANSMIT_DESCRIPTOR_COUNT;
+        Util::Async::Atomic<uint32_t>(pendingTransmits).dec();
+    }
+    transmitLock.release();
+
+    transmitEvent.signal();
+}
+
 void Rtl8139::setTransmitAddress(void *buffer) {
     baseRegister.writeDoubleWord(TRANSMIT_ADDRESS + transmitDescriptor * 4, reinterpret_cast<uint32_t>(buffer));
 }
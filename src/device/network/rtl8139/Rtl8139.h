@@ -25,6 +25,8 @@
 #include "kernel/interrupt/InterruptHandler.h"
 #include "device/cpu/IoPort.h"
 #include "lib/util/network/MacAddress.h"
+#include "lib/util/async/InterruptEvent.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Kernel {
 class Logger;
@@ -145,6 +147,12 @@ private:
 
     bool isTransmitDescriptorAvailable();
 
+    /**
+     * Free the buffers of all descriptors, which the device has finished (successfully or not).
+     * Called by the interrupt handler.
+     */
+    void reclaimTransmitDescriptors();
+
     void setTransmitAddress(void *buffer);
 
     void setPacketSize(uint32_t size);
@@ -153,6 +161,13 @@ private:
 
     PciDevice pciDevice;
     uint8_t transmitDescriptor = 0;
+    // Oldest descriptor, whose buffer has not been reclaimed yet
+    uint8_t reclaimDescriptor = 0;
+    uint32_t pendingTransmits = 0;
+    // Protects the transmit descriptors against the interrupt handler running on another CPU
+    Util::Async::Spinlock transmitLock;
+    // Signaled by the interrupt handler, after descriptors have been reclaimed
+    Util::Async::InterruptEvent transmitEvent;
     uint16_t receiveIndex = 0;
     uint8_t *receiveBuffer{};
     IoPort baseRegister = IoPort(0x00);
@@ -50,8 +50,6 @@ SerialPort::SerialPort(ComPort port, BaudRate dataRate) : Util::Io::FilterInputS
     lineControlRegister.writeByte(0x03);    // 8 bits per char, no parity, one stop bit
     fifoControlRegister.writeByte(0x07);    // Enable FIFO-buffers, Clear FIFO-buffers, Trigger interrupt after each byte
     modemControlRegister.writeByte(0x0b);   // Enable data lines
-
-    outputStream.connect(inputStream);
 }
 
 bool SerialPort::checkPort(ComPort port) {
@@ -155,7 +153,7 @@ void SerialPort::trigger(const Kernel::InterruptFrame &frame) {
     bool hasData = (lineStatusRegister.readByte() & 0x01) == 0x01;
     while (hasData) {
         uint8_t byte = dataRegister.readByte();
-        outputStream.write(byte == 13 ? '\n' : byte);
+        inputStream.write(byte == 13 ? '\n' : byte);
         write(byte == 13 ? '\n' : byte);
 
         hasData = (lineStatusRegister.readByte() & 0x01) == 0x01;
@@ -21,12 +21,11 @@
 #include <cstdint>
 
 #include "kernel/interrupt/InterruptHandler.h"
-#include "lib/util/io/stream/PipedOutputStream.h"
 #include "lib/util/io/stream/FilterInputStream.h"
 #include "lib/util/base/String.h"
 #include "device/cpu/IoPort.h"
 #include "lib/util/io/stream/OutputStream.h"
-#include "lib/util/io/stream/PipedInputStream.h"
+#include "lib/util/io/stream/RingBufferInputStream.h"
 
 namespace Kernel {
     class Logger;
@@ -208,8 +207,7 @@ private:
 
     static void initializePort(ComPort port);
 
-    Util::Io::PipedOutputStream outputStream;
-    Util::Io::PipedInputStream inputStream;
+    Util::Io::RingBufferInputStream inputStream;
     ComPort port;
     BaudRate dataRate;
 
@@ -18,6 +18,7 @@
 #include "Partition.h"
 
 #include "device/storage/StorageDevice.h"
+#include "device/storage/queue/BlockRequest.h"
 
 namespace Device::Storage {
 
@@ -39,4 +40,9 @@ uint32_t Partition::write(const uint8_t *buffer, uint32_t startSector, uint32_t
     return parentDevice.write(buffer, this->startSector + startSector, sectorCount);
 }
 
+void Partition::submit(BlockRequest &request) {
+    request.relocate(startSector);
+    parentDevice.submit(request);
+}
+
 }
\ No newline at end of file
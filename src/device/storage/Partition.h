@@ -67,6 +67,12 @@ public:
      */
     uint32_t write(const uint8_t *buffer, uint32_t startSector, uint32_t sectorCount) override;
 
+    /**
+     * Overriding function from StorageDevice.
+     * The request is translated to device sectors and passed to the parent device's request queue.
+     */
+    void submit(BlockRequest &request) override;
+
 private:
 
     StorageDevice &parentDevice;
@@ -159,7 +159,7 @@ void PartitionHandler::writePartition(uint8_t partitionNumber, bool active, Syst
 
         // Write partition entry
         *targetEntry = entry;
-        uint32_t writtenSectors = device.write(mbr, 0, 1);
+        uint32_t writtenSectors = device.queueWrite(mbr, 0, 1);
         delete[] mbr;
         if (writtenSectors < 1) {
             Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "PartitionHandler: Unable to write boot record to disk!");
@@ -215,7 +215,7 @@ void PartitionHandler::writePartition(uint8_t partitionNumber, bool active, Syst
 
             log.debug("Appending new logical partition (Number: [%u], Active: [%B], System ID: [0x%02x], Sector: [%u], Count: [%u])", partitionNumber, active, systemId, startSector, sectorCount);
 
-            uint32_t writtenSectors = device.write(ebr, ebrSector, 1);
+            uint32_t writtenSectors = device.queueWrite(ebr, ebrSector, 1);
             delete[] ebr;
             if (writtenSectors < 1) {
                 Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "PartitionHandler: Unable to write boot record to disk!");
@@ -239,7 +239,7 @@ void PartitionHandler::writePartition(uint8_t partitionNumber, bool active, Syst
             *partition = entry;
 
             // Write boot record to disk
-            writtenSectors = device.write(newEbr, startSector, 1) == device.getSectorSize();
+            writtenSectors = device.queueWrite(newEbr, startSector, 1) == device.getSectorSize();
             delete[] newEbr;
             if (writtenSectors < 1) {
                 Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "PartitionHandler: Unable to write boot record to disk!");
@@ -255,7 +255,7 @@ void PartitionHandler::writePartition(uint8_t partitionNumber, bool active, Syst
             log.debug("Updating existing logical partition (Number: [%u], Active: [%B], System ID: [0x%02x], Sector: [%u], Count: [%u])", partitionNumber, active, systemId, startSector, sectorCount);
 
             // Write boot record to disk
-            auto writtenSectors = device.write(ebr, ebrSector, 1) == device.getSectorSize();
+            auto writtenSectors = device.queueWrite(ebr, ebrSector, 1) == device.getSectorSize();
             delete[] ebr;
             if (writtenSectors < 1) {
                 Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "PartitionHandler: Unable to write boot record to disk!");
@@ -281,7 +281,7 @@ void PartitionHandler::deletePartition(uint8_t partitionNumber) {
 
         // Write empty partition entry
         *targetEntry = {};
-        uint32_t writtenSectors = device.write(mbr, 0, 1);
+        uint32_t writtenSectors = device.queueWrite(mbr, 0, 1);
         delete[] mbr;
         if (writtenSectors < 1) {
             Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "PartitionHandler: Unable to write boot record to disk!");
@@ -325,7 +325,7 @@ void PartitionHandler::deletePartition(uint8_t partitionNumber) {
                 delete[] nextEbr;
             }
 
-            auto writtenBytes = device.write(ebr, extendedPartition.relativeSector, 1);
+            auto writtenBytes = device.queueWrite(ebr, extendedPartition.relativeSector, 1);
             delete[] ebr;
             if (writtenBytes < 1) {
                 Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "PartitionHandler: Unable to write boot record to disk!");
@@ -365,13 +365,13 @@ void PartitionHandler::deletePartition(uint8_t partitionNumber) {
             auto &predecessor = *reinterpret_cast<PartitionTableEntry*>(&lastEbr[PARTITION_TABLE_START + sizeof (PartitionTableEntry)]);
             predecessor = nextLogicalPartition;
 
-            auto writtenSectors = device.write(ebr, currentEbrSector, 1);
+            auto writtenSectors = device.queueWrite(ebr, currentEbrSector, 1);
             delete[] ebr;
             if (writtenSectors < 1) {
                 Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "PartitionHandler: Unable to write boot record to disk!");
             }
 
-            writtenSectors = device.write(lastEbr, lastEbrSector, 1);
+            writtenSectors = device.queueWrite(lastEbr, lastEbrSector, 1);
             delete[] lastEbr;
             if (writtenSectors < 1) {
                 Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "PartitionHandler: Unable to write boot record to disk!");
@@ -391,7 +391,7 @@ void PartitionHandler::createBootRecord(uint32_t sector) {
     mbrAddress.setShort(BOOT_RECORD_SIGNATURE, 510);
 
     // Write fresh boot record to disk
-    auto writtenSectors = device.write(mbr, sector, 1) == device.getSectorSize();
+    auto writtenSectors = device.queueWrite(mbr, sector, 1) == device.getSectorSize();
     delete[] mbr;
 
     if (writtenSectors < 1) {
@@ -402,7 +402,7 @@ void PartitionHandler::createBootRecord(uint32_t sector) {
 uint8_t* PartitionHandler::readBootRecord(uint32_t sector) {
     // Read boot record
     auto *bootRecord = new uint8_t[device.getSectorSize()];
-    if (device.read(bootRecord, sector, 1) < 1) {
+    if (device.queueRead(bootRecord, sector, 1) < 1) {
         delete[] bootRecord;
         return nullptr;
     }
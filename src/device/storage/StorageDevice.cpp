@@ -17,6 +17,43 @@
 
 #include "StorageDevice.h"
 
+#include "device/storage/queue/BlockRequest.h"
+#include "device/storage/queue/BlockRequestQueue.h"
+
 namespace Device::Storage {
 
+void StorageDevice::submit(BlockRequest &request) {
+    if (requestQueue != nullptr) {
+        requestQueue->submit(request);
+        return;
+    }
+
+    auto transferred = request.getType() == BlockRequest::READ ?
+            read(request.getBuffer(), request.getStartSector(), request.getSectorCount()) :
+            write(request.getBuffer(), request.getStartSector(), request.getSectorCount());
+    request.complete(transferred);
+}
+
+uint32_t StorageDevice::queueRead(uint8_t *buffer, uint32_t startSector, uint32_t sectorCount) {
+    auto request = BlockRequest(BlockRequest::READ, buffer, startSector, sectorCount);
+    submit(request);
+
+    return request.wait();
+}
+
+uint32_t StorageDevice::queueWrite(const uint8_t *buffer, uint32_t startSector, uint32_t sectorCount) {
+    auto request = BlockRequest(BlockRequest::WRITE, const_cast<uint8_t*>(buffer), startSector, sectorCount);
+    submit(request);
+
+    return request.wait();
+}
+
+void StorageDevice::setRequestQueue(BlockRequestQueue *queue) {
+    requestQueue = queue;
+}
+
+BlockRequestQueue* StorageDevice::getRequestQueue() const {
+    return requestQueue;
+}
+
 }
\ No newline at end of file
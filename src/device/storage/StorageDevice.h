@@ -20,6 +20,13 @@
 
 #include <cstdint>
 
+namespace Device {
+namespace Storage {
+class BlockRequest;
+class BlockRequestQueue;
+}  // namespace Storage
+}  // namespace Device
+
 namespace Device::Storage {
 
 class StorageDevice {
@@ -76,6 +83,40 @@ public:
      * @return The amount of written sectors
      */
     virtual uint32_t write(const uint8_t *buffer, uint32_t startSector, uint32_t sectorCount) = 0;
+
+    /**
+     * Submit a request to the device's request queue. The request is completed asynchronously.
+     * Devices without a request queue execute the request synchronously.
+     *
+     * @param request The request (must stay valid until it has been completed)
+     */
+    virtual void submit(BlockRequest &request);
+
+    /**
+     * Read sectors via the device's request queue and wait for the request to be completed.
+     * In contrast to read(), concurrent callers do not serialize in the driver and adjacent requests may be merged.
+     *
+     * @return The amount of read sectors
+     */
+    uint32_t queueRead(uint8_t *buffer, uint32_t startSector, uint32_t sectorCount);
+
+    /**
+     * Write sectors via the device's request queue and wait for the request to be completed.
+     *
+     * @return The amount of written sectors
+     */
+    uint32_t queueWrite(const uint8_t *buffer, uint32_t startSector, uint32_t sectorCount);
+
+    /**
+     * Attach a request queue to this device. Afterwards, all submitted requests are passed through the queue.
+     */
+    void setRequestQueue(BlockRequestQueue *queue);
+
+    [[nodiscard]] BlockRequestQueue* getRequestQueue() const;
+
+private:
+
+    BlockRequestQueue *requestQueue = nullptr;
 };
 
 }
@@ -0,0 +1,465 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BlockCache.h"
+
+#include "BlockCacheFlusher.h"
+#include "device/storage/StorageDevice.h"
+#include "device/storage/queue/BlockRequest.h"
+#include "kernel/process/Thread.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/System.h"
+#include "lib/util/base/Address.h"
+
+namespace Device::Storage {
+
+BlockCache::BlockCache(uint32_t capacity) :
+        capacity(capacity), entries(new Entry[capacity]), data(new uint8_t[capacity * BLOCK_SIZE]), buckets(new int32_t[capacity]) {
+    for (uint32_t i = 0; i < capacity; i++) {
+        entries[i] = Entry{this, nullptr, 0, data + i * BLOCK_SIZE, 0, -1};
+        buckets[i] = -1;
+    }
+
+    auto &processService = Kernel::System::getService<Kernel::ProcessService>();
+    auto &flusherThread = Kernel::Thread::createKernelThread("Block-Cache-Flusher", processService.getKernelProcess(), new BlockCacheFlusher(*this));
+    Kernel::System::getService<Kernel::SchedulerService>().ready(flusherThread);
+}
+
+BlockCache::~BlockCache() {
+    delete[] entries;
+    delete[] data;
+    delete[] buckets;
+}
+
+uint32_t BlockCache::read(StorageDevice &device, uint8_t *buffer, uint32_t startSector, uint32_t sectorCount) {
+    if (!isCacheable(device) || startSector + sectorCount > device.getSectorCount()) {
+        return device.queueRead(buffer, startSector, sectorCount);
+    }
+
+    auto sectorSize = device.getSectorSize();
+    auto sectorsPerBlock = BLOCK_SIZE / sectorSize;
+    auto endSector = startSector + sectorCount;
+    auto endBlock = (endSector + sectorsPerBlock - 1) / sectorsPerBlock;
+
+    lock.acquire();
+    auto readahead = isSequential(device, startSector / sectorsPerBlock, endBlock) ? READAHEAD_BLOCKS : 0;
+
+    auto sector = startSector;
+    auto missed = false;
+    while (sector < endSector) {
+        auto block = sector / sectorsPerBlock;
+        auto *entry = lookup(device, block);
+
+        if (entry == nullptr) {
+            if (!missed) {
+                misses++;
+                missed = true;
+            }
+
+            load(device, block, endBlock, readahead);
+            continue;
+        }
+
+        if ((entry->flags & BUSY) == BUSY) {
+            entryChanged.wait(lock);
+            continue;
+        }
+
+        if ((entry->flags & FAILED) == FAILED) {
+            remove(*entry);
+            lock.release();
+            return sector - startSector;
+        }
+
+        if (!missed) {
+            hits++;
+        }
+
+        auto offset = sector % sectorsPerBlock;
+        auto count = sectorsPerBlock - offset < endSector - sector ? sectorsPerBlock - offset : endSector - sector;
+        auto target = Util::Address<uint32_t>(buffer + (sector - startSector) * sectorSize);
+        target.copyRange(Util::Address<uint32_t>(entry->data + offset * sectorSize), count * sectorSize);
+
+        entry->flags |= REFERENCED;
+        sector += count;
+        missed = false;
+    }
+
+    lock.release();
+    return sectorCount;
+}
+
+uint32_t BlockCache::write(StorageDevice &device, const uint8_t *buffer, uint32_t startSector, uint32_t sectorCount) {
+    if (!isCacheable(device) || startSector + sectorCount > device.getSectorCount()) {
+        return device.queueWrite(buffer, startSector, sectorCount);
+    }
+
+    auto sectorSize = device.getSectorSize();
+    auto sectorsPerBlock = BLOCK_SIZE / sectorSize;
+    auto endSector = startSector + sectorCount;
+
+    lock.acquire();
+    auto sector = startSector;
+    while (sector < endSector) {
+        auto block = sector / sectorsPerBlock;
+        auto offset = sector % sectorsPerBlock;
+        auto count = sectorsPerBlock - offset < endSector - sector ? sectorsPerBlock - offset : endSector - sector;
+        auto *entry = lookup(device, block);
+
+        if (entry == nullptr) {
+            if (offset == 0 && count == getBlockSectorCount(device, block)) {
+                // The whole block is overwritten -> No need to read it from the device
+                entry = allocateOrWait(device, block);
+                if (entry == nullptr) {
+                    continue;
+                }
+
+                entry->flags = VALID;
+            } else {
+                misses++;
+                load(device, block, block + 1, 0);
+                continue;
+            }
+        }
+
+        if ((entry->flags & BUSY) == BUSY) {
+            entryChanged.wait(lock);
+            continue;
+        }
+
+        if ((entry->flags & FAILED) == FAILED) {
+            remove(*entry);
+            lock.release();
+            return sector - startSector;
+        }
+
+        auto target = Util::Address<uint32_t>(entry->data + offset * sectorSize);
+        target.copyRange(Util::Address<uint32_t>(buffer + (sector - startSector) * sectorSize), count * sectorSize);
+
+        if ((entry->flags & DIRTY) != DIRTY) {
+            dirtyBlocks++;
+        }
+
+        entry->flags |= DIRTY | REFERENCED;
+        sector += count;
+    }
+
+    lock.release();
+    return sectorCount;
+}
+
+bool BlockCache::flush(StorageDevice *device) {
+    lock.acquire();
+    auto result = flushLocked(device);
+    lock.release();
+
+    return result;
+}
+
+void BlockCache::invalidate() {
+    lock.acquire();
+    flushLocked(nullptr);
+
+    for (uint32_t i = 0; i < capacity; i++) {
+        auto &entry = entries[i];
+        if (entry.flags != 0 && (entry.flags & (BUSY | DIRTY)) == 0) {
+            remove(entry);
+        }
+    }
+
+    for (auto &stream : streams) {
+        stream.device = nullptr;
+    }
+
+    lock.release();
+}
+
+bool BlockCache::flushLocked(StorageDevice *device) {
+    auto success = true;
+    Entry *flushEntries[MAX_FLUSH_BLOCKS];
+    BlockRequest *requests[MAX_FLUSH_BLOCKS];
+
+    while (true) {
+        // Collect dirty blocks and mark them busy, so that they are neither modified nor evicted during write back
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < capacity && count < MAX_FLUSH_BLOCKS; i++) {
+            auto &entry = entries[i];
+            if ((entry.flags & (DIRTY | BUSY)) == DIRTY && (device == nullptr || entry.device == device)) {
+                entry.flags = (entry.flags & ~DIRTY) | BUSY;
+                dirtyBlocks--;
+                flushEntries[count++] = &entry;
+            }
+        }
+
+        if (count == 0) {
+            return success;
+        }
+
+        // Submit all requests at once, so that the request queue can merge adjacent blocks
+        lock.release();
+        for (uint32_t i = 0; i < count; i++) {
+            auto &entry = *flushEntries[i];
+            auto sectorsPerBlock = BLOCK_SIZE / entry.device->getSectorSize();
+            requests[i] = new BlockRequest(BlockRequest::WRITE, entry.data, entry.block * sectorsPerBlock, getBlockSectorCount(*entry.device, entry.block));
+            entry.device->submit(*requests[i]);
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            requests[i]->wait();
+        }
+        lock.acquire();
+
+        for (uint32_t i = 0; i < count; i++) {
+            auto &entry = *flushEntries[i];
+            if (requests[i]->getTransferredSectors() == requests[i]->getSectorCount()) {
+                writtenBackBlocks++;
+                entry.flags &= ~BUSY;
+            } else {
+                // Keep the block dirty and stop flushing, to avoid retrying failing blocks forever
+                dirtyBlocks++;
+                entry.flags = (entry.flags & ~BUSY) | DIRTY;
+                success = false;
+            }
+
+            delete requests[i];
+        }
+
+        entryChanged.signalAll();
+        if (!success) {
+            return false;
+        }
+    }
+}
+
+void BlockCache::load(StorageDevice &device, uint32_t firstBlock, uint32_t endBlock, uint32_t readahead) {
+    auto sectorsPerBlock = BLOCK_SIZE / device.getSectorSize();
+    // Sectors are addressed with 32 bits, so the sector count can be truncated before dividing
+    auto sectorCount = device.getSectorCount() > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(device.getSectorCount());
+    auto deviceBlocks = sectorCount / sectorsPerBlock + (sectorCount % sectorsPerBlock == 0 ? 0 : 1);
+    auto limit = endBlock + readahead > deviceBlocks ? deviceBlocks : endBlock + readahead;
+
+    Entry *loadEntries[MAX_LOAD_BLOCKS];
+    uint32_t count = 0;
+
+    auto block = firstBlock;
+    while (block < limit && count < MAX_LOAD_BLOCKS) {
+        if (lookup(device, block) != nullptr) {
+            if (block >= endBlock) {
+                // Readahead stops at the first block, that is already cached
+                break;
+            }
+
+            block++;
+            continue;
+        }
+
+        auto *entry = count == 0 ? allocateOrWait(device, block) : allocate(device, block);
+        if (entry == nullptr) {
+            if (count == 0) {
+                // Lock has been released while waiting -> Check block again
+                continue;
+            }
+
+            break;
+        }
+
+        if (block >= endBlock) {
+            readaheadBlocks++;
+        }
+
+        loadEntries[count++] = entry;
+        block++;
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    // Submit requests without holding the lock (the completion callback needs it)
+    lock.release();
+    for (uint32_t i = 0; i < count; i++) {
+        auto &entry = *loadEntries[i];
+        auto *request = new BlockRequest(BlockRequest::READ, entry.data, entry.block * sectorsPerBlock, getBlockSectorCount(device, entry.block), onLoadCompleted, &entry);
+        device.submit(*request);
+    }
+    lock.acquire();
+}
+
+void BlockCache::onLoadCompleted(BlockRequest &request, void *context) {
+    auto &entry = *reinterpret_cast<Entry*>(context);
+    auto &cache = *entry.cache;
+
+    cache.lock.acquire();
+    entry.flags = request.getTransferredSectors() == request.getSectorCount() ? (VALID | REFERENCED) : FAILED;
+    cache.entryChanged.signalAll();
+    cache.lock.release();
+
+    delete &request;
+}
+
+BlockCache::Entry* BlockCache::allocate(StorageDevice &device, uint32_t block) {
+    // CLOCK algorithm: Referenced blocks get a second chance, busy and dirty blocks are skipped
+    for (uint32_t i = 0; i < 2 * capacity; i++) {
+        auto &entry = entries[clockHand];
+        clockHand = (clockHand + 1) % capacity;
+
+        if ((entry.flags & (BUSY | DIRTY)) != 0) {
+            continue;
+        }
+
+        if ((entry.flags & REFERENCED) == REFERENCED) {
+            entry.flags &= ~REFERENCED;
+            continue;
+        }
+
+        if ((entry.flags & VALID) == VALID) {
+            evictions++;
+        }
+
+        if (entry.flags != 0) {
+            remove(entry);
+        }
+
+        entry.device = &device;
+        entry.block = block;
+        entry.flags = BUSY;
+        insert(entry);
+
+        return &entry;
+    }
+
+    return nullptr;
+}
+
+BlockCache::Entry* BlockCache::allocateOrWait(StorageDevice &device, uint32_t block) {
+    auto *entry = allocate(device, block);
+    if (entry != nullptr) {
+        return entry;
+    }
+
+    // No free block -> Make dirty blocks evictable or wait for busy blocks
+    if (dirtyBlocks > 0) {
+        flushLocked(nullptr);
+    } else {
+        entryChanged.wait(lock);
+    }
+
+    return nullptr;
+}
+
+BlockCache::Entry* BlockCache::lookup(StorageDevice &device, uint32_t block) {
+    for (auto index = buckets[hash(&device, block)]; index != -1; index = entries[index].hashNext) {
+        auto &entry = entries[index];
+        if (entry.device == &device && entry.block == block) {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+void BlockCache::insert(Entry &entry) {
+    auto bucket = hash(entry.device, entry.block);
+    entry.hashNext = buckets[bucket];
+    buckets[bucket] = static_cast<int32_t>(&entry - entries);
+    usedBlocks++;
+}
+
+void BlockCache::remove(Entry &entry) {
+    auto index = static_cast<int32_t>(&entry - entries);
+    auto *link = &buckets[hash(entry.device, entry.block)];
+    while (*link != -1) {
+        if (*link == index) {
+            *link = entry.hashNext;
+            break;
+        }
+
+        link = &entries[*link].hashNext;
+    }
+
+    entry.flags = 0;
+    entry.device = nullptr;
+    entry.hashNext = -1;
+    usedBlocks--;
+}
+
+uint32_t BlockCache::hash(const StorageDevice *device, uint32_t block) const {
+    return ((reinterpret_cast<uint32_t>(device) >> 4) ^ (block * 2654435761u)) % capacity;
+}
+
+bool BlockCache::isSequential(StorageDevice &device, uint32_t firstBlock, uint32_t endBlock) {
+    for (auto &stream : streams) {
+        if (stream.device == &device && (stream.nextBlock == firstBlock || stream.nextBlock == firstBlock + 1)) {
+            // Small reads may end in the middle of a block, so continuing in the previous block counts as sequential as well
+            stream.nextBlock = endBlock;
+            return true;
+        }
+    }
+
+    streams[nextStream] = Stream{&device, endBlock};
+    nextStream = (nextStream + 1) % STREAM_COUNT;
+    return false;
+}
+
+bool BlockCache::isCacheable(StorageDevice &device) {
+    auto sectorSize = device.getSectorSize();
+    return sectorSize > 0 && sectorSize <= BLOCK_SIZE && BLOCK_SIZE % sectorSize == 0;
+}
+
+uint32_t BlockCache::getBlockSectorCount(StorageDevice &device, uint32_t block) {
+    auto sectorsPerBlock = BLOCK_SIZE / device.getSectorSize();
+    auto firstSector = static_cast<uint64_t>(block) * sectorsPerBlock;
+    auto deviceSectors = device.getSectorCount();
+
+    // The last block of a device may be incomplete
+    return firstSector + sectorsPerBlock > deviceSectors ? static_cast<uint32_t>(deviceSectors - firstSector) : sectorsPerBlock;
+}
+
+uint32_t BlockCache::getCapacity() const {
+    return capacity;
+}
+
+uint32_t BlockCache::getUsedBlocks() const {
+    return usedBlocks;
+}
+
+uint32_t BlockCache::getDirtyBlocks() const {
+    return dirtyBlocks;
+}
+
+uint32_t BlockCache::getHits() const {
+    return hits;
+}
+
+uint32_t BlockCache::getMisses() const {
+    return misses;
+}
+
+uint32_t BlockCache::getEvictions() const {
+    return evictions;
+}
+
+uint32_t BlockCache::getReadaheadBlocks() const {
+    return readaheadBlocks;
+}
+
+uint32_t BlockCache::getWrittenBackBlocks() const {
+    return writtenBackBlocks;
+}
+
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BLOCKCACHE_H
+#define HHUOS_BLOCKCACHE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Mutex.h"
+#include "lib/util/async/ConditionVariable.h"
+
+namespace Device {
+namespace Storage {
+class BlockRequest;
+class StorageDevice;
+}  // namespace Storage
+}  // namespace Device
+
+namespace Device::Storage {
+
+/**
+ * Kernel-wide cache for storage device blocks, shared by all storage backed filesystems.
+ * Blocks have a fixed size of 4 KiB and are identified by their device and block number.
+ * Eviction is done with the CLOCK algorithm. Written blocks are kept dirty in the cache and written back
+ * periodically by a flusher thread (or explicitly via flush()). Sequential reads trigger readahead,
+ * which is submitted asynchronously to the device's request queue.
+ * Devices with sector sizes, that do not divide the block size, bypass the cache.
+ */
+class BlockCache {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param capacity The amount of cached blocks
+     */
+    explicit BlockCache(uint32_t capacity);
+
+    /**
+     * Copy Constructor.
+     */
+    BlockCache(const BlockCache &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BlockCache &operator=(const BlockCache &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BlockCache();
+
+    /**
+     * Read sectors from a device, using cached blocks where possible.
+     *
+     * @return The amount of read sectors
+     */
+    uint32_t read(StorageDevice &device, uint8_t *buffer, uint32_t startSector, uint32_t sectorCount);
+
+    /**
+     * Write sectors to the cache. The data is written back to the device later (see flush()).
+     *
+     * @return The amount of written sectors
+     */
+    uint32_t write(StorageDevice &device, const uint8_t *buffer, uint32_t startSector, uint32_t sectorCount);
+
+    /**
+     * Write back all dirty blocks of a device.
+     *
+     * @param device The device, or nullptr to flush all devices
+     * @return true, if all blocks have been written back successfully
+     */
+    bool flush(StorageDevice *device = nullptr);
+
+    /**
+     * Write back all dirty blocks and drop all blocks from the cache.
+     */
+    void invalidate();
+
+    [[nodiscard]] uint32_t getCapacity() const;
+
+    [[nodiscard]] uint32_t getUsedBlocks() const;
+
+    [[nodiscard]] uint32_t getDirtyBlocks() const;
+
+    [[nodiscard]] uint32_t getHits() const;
+
+    [[nodiscard]] uint32_t getMisses() const;
+
+    [[nodiscard]] uint32_t getEvictions() const;
+
+    [[nodiscard]] uint32_t getReadaheadBlocks() const;
+
+    [[nodiscard]] uint32_t getWrittenBackBlocks() const;
+
+    static const constexpr uint32_t BLOCK_SIZE = 4096;
+    static const constexpr uint32_t DEFAULT_CAPACITY = 1024;
+    static const constexpr uint32_t FLUSH_INTERVAL = 5000;
+
+private:
+
+    static const constexpr uint32_t STREAM_COUNT = 8;
+    static const constexpr uint32_t READAHEAD_BLOCKS = 16;
+    static const constexpr uint32_t MAX_LOAD_BLOCKS = 64;
+    static const constexpr uint32_t MAX_FLUSH_BLOCKS = 64;
+
+    enum Flag : uint8_t {
+        VALID = 0x01,
+        DIRTY = 0x02,
+        REFERENCED = 0x04,
+        BUSY = 0x08,     // Block is being loaded or written back
+        FAILED = 0x10    // Loading the block failed
+    };
+
+    struct Entry {
+        BlockCache *cache;
+        StorageDevice *device;
+        uint32_t block;
+        uint8_t *data;
+        uint8_t flags;
+        int32_t hashNext;
+    };
+
+    struct Stream {
+        StorageDevice *device;
+        uint32_t nextBlock;
+    };
+
+    [[nodiscard]] static bool isCacheable(StorageDevice &device);
+
+    [[nodiscard]] static uint32_t getBlockSectorCount(StorageDevice &device, uint32_t block);
+
+    [[nodiscard]] uint32_t hash(const StorageDevice *device, uint32_t block) const;
+
+    Entry* lookup(StorageDevice &device, uint32_t block);
+
+    void insert(Entry &entry);
+
+    void remove(Entry &entry);
+
+    Entry* allocate(StorageDevice &device, uint32_t block);
+
+    Entry* allocateOrWait(StorageDevice &device, uint32_t block);
+
+    void load(StorageDevice &device, uint32_t firstBlock, uint32_t endBlock, uint32_t readahead);
+
+    bool flushLocked(StorageDevice *device);
+
+    bool isSequential(StorageDevice &device, uint32_t firstBlock, uint32_t endBlock);
+
+    static void onLoadCompleted(BlockRequest &request, void *context);
+
+    Util::Async::Mutex lock;
+    Util::Async::ConditionVariable entryChanged;
+
+    uint32_t capacity;
+    Entry *entries;
+    uint8_t *data;
+    int32_t *buckets;
+    uint32_t clockHand = 0;
+
+    Stream streams[STREAM_COUNT]{};
+    uint32_t nextStream = 0;
+
+    uint32_t usedBlocks = 0;
+    uint32_t dirtyBlocks = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+    uint32_t readaheadBlocks = 0;
+    uint32_t writtenBackBlocks = 0;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BlockCacheNode.h"
+
+#include "BlockCache.h"
+#include "kernel/system/System.h"
+#include "kernel/service/StorageService.h"
+
+namespace Device::Storage {
+
+BlockCacheNode::BlockCacheNode(const Util::String &name) : StringNode(name) {}
+
+Util::String BlockCacheNode::getString() {
+    auto &cache = Kernel::System::getService<Kernel::StorageService>().getBlockCache();
+    auto accesses = cache.getHits() + cache.getMisses();
+    // Avoid overflows of 32-bit multiplication (64-bit divisions are not available without libgcc)
+    auto hitRatio = accesses == 0 ? 0 : (accesses < UINT32_MAX / 100 ? cache.getHits() * 100 / accesses : cache.getHits() / (accesses / 100));
+
+    return Util::String::format("Block size: %u\nCapacity: %u\nUsed: %u\nDirty: %u\nHits: %u\nMisses: %u\nHit ratio: %u%c\nEvictions: %u\nReadahead: %u\nWritten back: %u\n",
+                                BlockCache::BLOCK_SIZE, cache.getCapacity(), cache.getUsedBlocks(), cache.getDirtyBlocks(),
+                                cache.getHits(), cache.getMisses(), hitRatio, '%', cache.getEvictions(),
+                                cache.getReadaheadBlocks(), cache.getWrittenBackBlocks());
+}
+
+Util::Io::File::Type BlockCacheNode::getType() {
+    return Util::Io::File::CHARACTER;
+}
+
+uint64_t BlockCacheNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    auto &cache = Kernel::System::getService<Kernel::StorageService>().getBlockCache();
+    auto command = Util::String(sourceBuffer, numBytes).strip().toLowerCase();
+
+    if (command == "sync") {
+        cache.flush();
+    } else if (command == "drop") {
+        cache.invalidate();
+    }
+
+    return numBytes;
+}
+
+}
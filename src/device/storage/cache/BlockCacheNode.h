@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BLOCKCACHENODE_H
+#define HHUOS_BLOCKCACHENODE_H
+
+#include <cstdint>
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/file/File.h"
+
+namespace Device::Storage {
+
+/**
+ * Shows the usage and hit/miss/eviction counters of the kernel's block cache.
+ * Writing 'sync' writes back all dirty blocks, writing 'drop' additionally empties the cache.
+ */
+class BlockCacheNode : public Filesystem::Memory::StringNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit BlockCacheNode(const Util::String &name);
+
+    /**
+     * Copy Constructor.
+     */
+    BlockCacheNode(const BlockCacheNode &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BlockCacheNode &operator=(const BlockCacheNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BlockCacheNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+
+    /**
+     * Overriding function from MemoryNode.
+     */
+    Util::Io::File::Type getType() override;
+
+    /**
+     * Overriding function from MemoryNode.
+     */
+    uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
+};
+
+}
+
+#endif
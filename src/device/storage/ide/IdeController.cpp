@@ -43,6 +43,9 @@
 namespace Device::Storage {
 
 Kernel::Logger IdeController::log = Kernel::Logger::get("IDE");
+bool IdeController::dmaEnabled = true;
+uint32_t IdeController::programmedIOSectorCount = 0;
+uint32_t IdeController::dmaSectorCount = 0;
 
 IdeController::IdeController(const PciDevice &pciDevice) {
     log.info("Initializing controller [0x%04x:0x%04x]", pciDevice.getVendorId(), pciDevice.getDeviceId());
@@ -86,6 +89,30 @@ IdeController::IdeController(const PciDevice &pciDevice) {
         }
 
         channels[i] = ChannelRegisters(baseAddress, controlBaseAddress, dmaBaseAddress + (i == 0 ? 0 : BUS_MASTER_CHANNEL_OFFSET));
+        channels[i].nativeMode = (channelInterface & 0x01) == 0x01;
+        if (channels[i].nativeMode) {
+            // Native mode channels signal completion via the PCI interrupt line instead of IRQ 14/15
+            usesNativeInterrupt = true;
+            nativeInterruptLine = pciDevice.getInterruptLine();
+        }
+    }
+
+    if (supportsDma) {
+        initializeDma();
+    }
+}
+
+void IdeController::initializeDma() {
+    auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
+
+    for (auto &dma : dmaChannels) {
+        // The PRD table must be dword aligned and must not cross a 64 KiB boundary -> A single page fulfills both requirements
+        dma.prdVirtual = reinterpret_cast<uint32_t*>(memoryService.mapIO(Util::PAGESIZE));
+        dma.prdPhysical = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(dma.prdVirtual));
+
+        // Contiguous blocks from the buddy allocator are aligned to their size -> The buffer never crosses a 64 KiB boundary
+        dma.bufferVirtual = reinterpret_cast<uint8_t*>(memoryService.mapIO(DMA_BUFFER_SIZE));
+        dma.bufferPhysical = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(dma.bufferVirtual));
     }
 }
 
@@ -360,16 +387,52 @@ void IdeController::plugin() {
     interruptService.allowHardwareInterrupt(Device::InterruptRequest::PRIMARY_ATA);
     interruptService.assignInterrupt(Kernel::InterruptVector::SECONDARY_ATA, *this);
     interruptService.allowHardwareInterrupt(Device::InterruptRequest::SECONDARY_ATA);
+
+    if (usesNativeInterrupt && nativeInterruptLine != Device::InterruptRequest::PRIMARY_ATA && nativeInterruptLine != Device::InterruptRequest::SECONDARY_ATA) {
+        interruptService.assignInterrupt(static_cast<Kernel::InterruptVector>(nativeInterruptLine + 32), *this);
+        interruptService.allowHardwareInterrupt(nativeInterruptLine);
+    }
 }
 
 void IdeController::trigger(const Kernel::InterruptFrame &frame) {
     if (frame.interrupt == Kernel::InterruptVector::PRIMARY_ATA) {
-        channels[0].receivedInterrupt = true;
+        handleChannelInterrupt(0);
     } else if (frame.interrupt == Kernel::InterruptVector::SECONDARY_ATA) {
-        channels[1].receivedInterrupt = true;
+        handleChannelInterrupt(1);
+    } else {
+        // Shared PCI interrupt line of native mode channels -> Check both channels
+        for (uint8_t i = 0; i < CHANNELS_PER_CONTROLLER; i++) {
+            handleChannelInterrupt(i);
+        }
     }
 }
 
+void IdeController::handleChannelInterrupt(uint8_t channel) {
+    auto &registers = channels[channel];
+    auto &dma = dmaChannels[channel];
+
+    if (!dma.transferPending) {
+        registers.receivedInterrupt = true;
+        return;
+    }
+
+    auto dmaStatus = registers.dma.status.readByte();
+    if ((dmaStatus & DmaStatus::INTERRUPT) != DmaStatus::INTERRUPT) {
+        // Interrupt has not been raised by this channel
+        return;
+    }
+
+    // Stop bus master, acknowledge interrupt on controller (write 1 to clear) and drive (read status register)
+    registers.dma.command.writeByte(0x00);
+    registers.dma.status.writeByte(dmaStatus | DmaStatus::INTERRUPT);
+    registers.command.status.readByte();
+
+    dma.lastStatus = dmaStatus;
+    dma.transferPending = false;
+    registers.receivedInterrupt = true;
+    dma.completion.signal();
+}
+
 uint8_t IdeController::getAtapiType(uint16_t signature) {
     uint8_t atapiIdentifier = (signature & 0x0f00) >> 8;
     switch(atapiIdentifier){
@@ -423,6 +486,7 @@ uint16_t IdeController::performIO(const IdeController::DeviceInfo &info, IdeCont
         Util::Exception::throwException(Util::Exception::OUT_OF_BOUNDS, "IDE: Trying to read/write out of track bounds!");
     }
 
+    auto &ioLock = ioLocks[info.channel];
     ioLock.acquire();
     if (!selectDrive(info.channel, info.drive)) {
         ioLock.release();
@@ -445,20 +509,31 @@ uint16_t IdeController::performIO(const IdeController::DeviceInfo &info, IdeCont
         return 0;
     }
 
+    auto dma = useDma(info);
     uint16_t maxSectorCount = info.addressing == LBA48 ? 0xffff : 0xff;
+    if (dma && maxSectorCount > DMA_BUFFER_SIZE / info.sectorSize) {
+        // Each DMA transfer is limited by the size of the channel's bounce buffer
+        maxSectorCount = DMA_BUFFER_SIZE / info.sectorSize;
+    }
+
     uint32_t processedSectors = 0;
     while (processedSectors < sectorCount) {
         uint32_t sectorsLeft = sectorCount - processedSectors;
         uint32_t start = startSector + processedSectors;
         uint32_t count = sectorsLeft > maxSectorCount ? maxSectorCount : sectorsLeft;
 
-        uint16_t sectors;
-        if (supportsDma && info.supportsDma()) {
-            // TODO: Reactivate DMA once issues on real hardware have been fixed
-            // sectors = performDmaIO(info, mode, reinterpret_cast<uint16_t*>(buffer + (processedSectors * info.sectorSize)), start, count);
-            sectors = performProgrammedIO(info, mode, reinterpret_cast<uint16_t*>(buffer + (processedSectors * info.sectorSize)), start, count);
-        } else {
+        uint16_t sectors = 0;
+        if (dma) {
+            sectors = performDmaIO(info, mode, reinterpret_cast<uint16_t*>(buffer + (processedSectors * info.sectorSize)), start, count);
+            dmaSectorCount += sectors;
+
+            // DMA is disabled for this controller after a timeout -> Repeat the transfer via programmed I/O
+            dma = useDma(info);
+        }
+
+        if (!dma) {
             sectors = performProgrammedIO(info, mode, reinterpret_cast<uint16_t*>(buffer + (processedSectors * info.sectorSize)), start, count);
+            programmedIOSectorCount += sectors;
         }
 
         processedSectors += sectors;
@@ -551,8 +626,8 @@ uint16_t IdeController::performProgrammedIO(const IdeController::DeviceInfo &inf
 }
 
 uint16_t IdeController::performDmaIO(const IdeController::DeviceInfo &info, IdeController::TransferMode mode, uint16_t *buffer, uint64_t startSector, uint16_t sectorCount) {
-    auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
     auto &registers = channels[info.channel];
+    auto &dma = dmaChannels[info.channel];
 
     uint8_t command;
     if (info.addressing == LBA28) {
@@ -563,99 +638,66 @@ uint16_t IdeController::performDmaIO(const IdeController::DeviceInfo &info, IdeC
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "IDE: Unsupported address type!");
     }
 
-    // Calculate the amount of pages needed for the operation
-    auto size = sectorCount * info.sectorSize;
-    auto pages = size / Util::PAGESIZE + (size % Util::PAGESIZE == 0 ? 0 : 1);
-
-    // Each page corresponds to an 8-byte entry in the PRD
-    auto prdSize = pages * 8;
-    auto prdVirtual = reinterpret_cast<uint32_t*>(memoryService.mapIO(prdSize));
-    auto prdPhysical = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(prdVirtual));
-
-    // Allocate memory for the DMA transfer
-    auto dmaMemoryVirtual = reinterpret_cast<uint32_t*>(memoryService.mapIO(size));
-    auto dmaMemoryPhysical = reinterpret_cast<uint32_t>(memoryService.getPhysicalAddress(dmaMemoryVirtual));
-
+    uint32_t size = sectorCount * info.sectorSize;
     if (mode == WRITE) {
         auto source = Util::Address<uint32_t>(buffer);
-        auto target = Util::Address<uint32_t>(dmaMemoryVirtual);
+        auto target = Util::Address<uint32_t>(dma.bufferVirtual);
         target.copyRange(source, size);
     }
 
-    // Fill PRD
-    uint32_t i;
-    for (i = 0; i < (pages - 1); i++) {
-        prdVirtual[2 * i] = dmaMemoryPhysical + (Util::PAGESIZE * i);
-        prdVirtual[(2 * i) + 1] = Util::PAGESIZE;
+    // Fill PRD (a byte count of 0 means 64 KiB) and set EOT bit on last entry
+    uint32_t entry = 0;
+    for (uint32_t offset = 0; offset < size; offset += PRD_MAX_BYTE_COUNT, entry++) {
+        auto remaining = size - offset;
+        dma.prdVirtual[2 * entry] = dma.bufferPhysical + offset;
+        dma.prdVirtual[(2 * entry) + 1] = remaining >= PRD_MAX_BYTE_COUNT ? 0 : remaining;
     }
+    dma.prdVirtual[(2 * (entry - 1)) + 1] |= PRD_END_OF_TRANSMISSION;
 
-    // Set last PRD entry wit EOT bit
-    prdVirtual[2 * i] = dmaMemoryPhysical + (Util::PAGESIZE * i);
-    prdVirtual[(2 * i) + 1] = (size % Util::PAGESIZE) | PRD_END_OF_TRANSMISSION;
-
-    // Prepare DMA transfer to physical address
-    registers.dma.address.writeDoubleWord(prdPhysical);
+    // Stop bus master and prepare DMA transfer to physical address
+    registers.dma.command.writeByte(0x00);
+    registers.dma.address.writeDoubleWord(dma.prdPhysical);
 
-    // Set DMA direction
-    registers.dma.command.writeByte(mode == READ ? 0x00 : DmaCommand::DIRECTION);
-
-    // Clear interrupt and error bits
-    registers.dma.status.writeByte(~(DmaStatus::DMA_ERROR | DmaStatus::INTERRUPT));
+    // Clear interrupt and error bits (write 1 to clear), while keeping the drive capability bits
+    registers.dma.status.writeByte(registers.dma.status.readByte() | DmaStatus::DMA_ERROR | DmaStatus::INTERRUPT);
 
     // Select drive and sector
     prepareIO(info, startSector, sectorCount);
 
-    // Send command
+    // Send command and start bus master (the direction bit means 'write to memory', which is a read from the drive)
+    auto sequence = dma.completion.getSequence();
+    dma.transferPending = true;
     registers.command.command.writeByte(command);
-    if (!waitStatus(registers.control.alternateStatus, DATA_REQUEST)) {
-        log.error("Failed to %s sectors on drive [%u] on channel [%u] via DMA", mode == READ ? "read" : "write", info.drive, info.channel);
+    registers.dma.command.writeByte(DmaCommand::ENABLE | (mode == READ ? DmaCommand::DIRECTION : 0x00));
 
-        delete prdVirtual;
-        delete dmaMemoryVirtual;
-        return 0;
-    }
+    // Block until the interrupt handler signals completion, but do not let a lost interrupt hang the channel forever
+    dma.completion.wait(sequence, Util::Time::Timestamp::ofMilliseconds(DMA_TIMEOUT));
 
-    // Start DMA transfer
-    registers.dma.command.writeByte(DmaCommand::ENABLE);
+    if (dma.transferPending) {
+        dma.transferPending = false;
 
-    registers.receivedInterrupt = false;
-    uint32_t timeout = Util::Time::getSystemTime().toMilliseconds() + DMA_TIMEOUT;
-    do {
-        if (registers.receivedInterrupt) {
-            // Stop DMA and check flags
-            registers.dma.command.writeByte(0x00);
-
-            auto dmaStatus = registers.dma.status.readByte();
-            if ((dmaStatus & DmaStatus::INTERRUPT) == DmaStatus::INTERRUPT) {
-                // An interrupt has been fired -> Check if bus master is still enabled
-                if ((dmaStatus & DmaStatus::BUS_MASTER_ACTIVE) == DmaStatus::BUS_MASTER_ACTIVE) {
-                    // Continue DMA transfer
-                    registers.receivedInterrupt = false;
-                    registers.dma.command.writeByte(DmaCommand::ENABLE);
-                } else {
-                    // DMA transfer is finished
-                    break;
-                }
-            }
-        }
-    } while (Util::Time::getSystemTime().toMilliseconds() < timeout);
+        // Stop bus master, clear its status bits and abort the command by resetting the drive
+        registers.dma.command.writeByte(0x00);
+        registers.dma.status.writeByte(registers.dma.status.readByte() | DmaStatus::DMA_ERROR | DmaStatus::INTERRUPT);
+        resetDrive(info.channel, info.drive);
 
-    if (Util::Time::getSystemTime().toMilliseconds() >= timeout) {
-        log.error("Timeout while %s sectors on drive [%u] on channel [%u] via DMA", mode == READ ? "reading" : "writing", info.drive, info.channel);
+        log.error("Timeout while %s sectors on drive [%u] on channel [%u] via DMA -> Falling back to programmed I/O", mode == READ ? "reading" : "writing", info.drive, info.channel);
+        supportsDma = false;
+        return 0;
+    }
 
-        delete prdVirtual;
-        delete dmaMemoryVirtual;
+    auto status = registers.control.alternateStatus.readByte();
+    if ((dma.lastStatus & DmaStatus::DMA_ERROR) == DmaStatus::DMA_ERROR || (status & ERROR) == ERROR) {
+        log.error("Failed to %s sectors on drive [%u] on channel [%u] via DMA", mode == READ ? "read" : "write", info.drive, info.channel);
         return 0;
     }
 
     if (mode == READ) {
-        auto source = Util::Address<uint32_t>(dmaMemoryVirtual);
+        auto source = Util::Address<uint32_t>(dma.bufferVirtual);
         auto target = Util::Address<uint32_t>(buffer);
         target.copyRange(source, size);
     }
 
-    delete prdVirtual;
-    delete dmaMemoryVirtual;
     return sectorCount;
 }
 
@@ -710,6 +752,27 @@ bool IdeController::checkBounds(const DeviceInfo &info, uint64_t startSector, ui
     }
 }
 
+bool IdeController::useDma(const DeviceInfo &info) const {
+    // DMA commands are only defined for LBA addressing
+    return dmaEnabled && supportsDma && info.supportsDma() && info.addressing != CHS;
+}
+
+void IdeController::setDmaEnabled(bool enabled) {
+    dmaEnabled = enabled;
+}
+
+bool IdeController::isDmaEnabled() {
+    return dmaEnabled;
+}
+
+uint32_t IdeController::getProgrammedIOSectorCount() {
+    return programmedIOSectorCount;
+}
+
+uint32_t IdeController::getDmaSectorCount() {
+    return dmaSectorCount;
+}
+
 bool IdeController::DeviceInfo::supportsDma() const {
     return ultraDma != 0 || multiwordDma != 0;
 }
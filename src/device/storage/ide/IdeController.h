@@ -26,6 +26,8 @@
 #include "kernel/interrupt/InterruptHandler.h"
 #include "device/cpu/IoPort.h"
 #include "lib/util/async/Spinlock.h"
+#include "lib/util/async/InterruptEvent.h"
+#include "device/interrupt/InterruptRequest.h"
 
 namespace Device {
 class PciDevice;
@@ -69,6 +71,18 @@ public:
 
     void trigger(const Kernel::InterruptFrame &frame) override;
 
+    /**
+     * Globally allow or forbid DMA transfers. If DMA is disabled, all controllers fall back to programmed I/O.
+     * This is mainly intended for comparing both transfer modes (e.g. via '/device/ide').
+     */
+    static void setDmaEnabled(bool enabled);
+
+    [[nodiscard]] static bool isDmaEnabled();
+
+    [[nodiscard]] static uint32_t getProgrammedIOSectorCount();
+
+    [[nodiscard]] static uint32_t getDmaSectorCount();
+
 private:
 
     static const constexpr uint8_t PCI_SUBCLASS_IDE = 0x01;
@@ -85,7 +99,9 @@ private:
     static const constexpr uint32_t BUS_MASTER_CHANNEL_OFFSET = 0x08;
     static const constexpr uint32_t MAX_WAIT_ON_STATUS_RETRIES = 4095;
     static const constexpr uint32_t DMA_TIMEOUT = 30000;
-    static const constexpr uint32_t PRD_END_OF_TRANSMISSION = 1 << 31;
+    static const constexpr uint32_t PRD_END_OF_TRANSMISSION = 1u << 31;
+    static const constexpr uint32_t PRD_MAX_BYTE_COUNT = 64 * 1024;
+    static const constexpr uint32_t DMA_BUFFER_SIZE = 64 * 1024;
 
     enum AddressType : uint8_t {
         CHS = 0x00,
@@ -264,10 +280,33 @@ private:
         CommandRegisters command;             // Command Register Set IoPorts
         ControlRegisters control;             // Control Register Set IoPorts
         DmaRegisters dma;                     // DMA Bus Master Register Set IoPorts
+        bool nativeMode{};                    // Channel uses the PCI interrupt line instead of IRQ 14/15
+    };
+
+    /**
+     * DMA resources of a single channel. PRD table and bounce buffer are allocated once and reused for all transfers.
+     * Transfers on a channel are serialized by its I/O lock, so a single bounce buffer per channel is enough.
+     * The bounce buffer is physically contiguous and naturally aligned, so it never crosses a 64 KiB boundary
+     * and a single PRD entry is enough to describe it.
+     */
+    struct DmaChannel {
+        uint32_t *prdVirtual = nullptr;       // Physical Region Descriptor table (virtual address)
+        uint32_t prdPhysical = 0;             // Physical Region Descriptor table (physical address)
+        uint8_t *bufferVirtual = nullptr;     // Bounce buffer (virtual address)
+        uint32_t bufferPhysical = 0;          // Bounce buffer (physical address)
+        volatile bool transferPending = false; // Set while a DMA command is waiting for its completion interrupt (cleared by the interrupt handler)
+        volatile uint8_t lastStatus = 0;       // Bus master status, as read by the interrupt handler
+        Util::Async::InterruptEvent completion; // Signaled by the interrupt handler, after clearing 'transferPending'
     };
 
     void initializeDrives();
 
+    void initializeDma();
+
+    [[nodiscard]] bool useDma(const DeviceInfo &info) const;
+
+    void handleChannelInterrupt(uint8_t channel);
+
     bool resetDrive(uint8_t channel, uint8_t drive);
 
     IdeDevice* identifyDrive(uint8_t channel, uint8_t drive);
@@ -297,8 +336,15 @@ private:
     static void copyByteSwappedString(const char *source, char *target, uint32_t length);
 
     ChannelRegisters channels[CHANNELS_PER_CONTROLLER]{};
-    Util::Async::Spinlock ioLock;
+    DmaChannel dmaChannels[CHANNELS_PER_CONTROLLER];
+    Util::Async::Spinlock ioLocks[CHANNELS_PER_CONTROLLER];  // Drives on different channels can be accessed concurrently
     bool supportsDma = false;
+    Device::InterruptRequest nativeInterruptLine{};
+    bool usesNativeInterrupt = false;
+
+    static bool dmaEnabled;
+    static uint32_t programmedIOSectorCount;
+    static uint32_t dmaSectorCount;
 
     static Kernel::Logger log;
 };
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "IdeNode.h"
+#include "IdeController.h"
+
+namespace Device::Storage {
+
+IdeNode::IdeNode(const Util::String &name) : StringNode(name) {}
+
+Util::String IdeNode::getString() {
+    return Util::String::format("Mode: %s\nPIO sectors: %u\nDMA sectors: %u\n",
+                                IdeController::isDmaEnabled() ? "dma" : "pio",
+                                IdeController::getProgrammedIOSectorCount(),
+                                IdeController::getDmaSectorCount());
+}
+
+Util::Io::File::Type IdeNode::getType() {
+    return Util::Io::File::CHARACTER;
+}
+
+uint64_t IdeNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    auto mode = Util::String(sourceBuffer, numBytes).strip().toLowerCase();
+    if (mode == "pio") {
+        IdeController::setDmaEnabled(false);
+    } else if (mode == "dma") {
+        IdeController::setDmaEnabled(true);
+    }
+
+    return numBytes;
+}
+
+}
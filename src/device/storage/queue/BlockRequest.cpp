@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BlockRequest.h"
+
+#include "lib/interface.h"
+
+namespace Device::Storage {
+
+BlockRequest::BlockRequest(Type type, uint8_t *buffer, uint32_t startSector, uint32_t sectorCount, CompletionCallback callback, void *context) :
+        type(type), buffer(buffer), startSector(startSector), sectorCount(sectorCount), callback(callback), context(context), stateWrapper(state) {}
+
+uint32_t BlockRequest::wait() {
+    while (stateWrapper.get() != COMPLETED) {
+        futexWait(&state, PENDING);
+    }
+
+    return transferredSectors;
+}
+
+void BlockRequest::complete(uint32_t transferredSectors) {
+    BlockRequest::transferredSectors = transferredSectors;
+    next = nullptr;
+
+    // The callback is the last access to this request, since it may already free the request
+    if (callback != nullptr) {
+        stateWrapper.set(COMPLETED);
+        callback(*this, context);
+        return;
+    }
+
+    // Publishing the state is the last access to this request, since the waiter may return and destroy it right afterwards.
+    // futexWake() only uses the address as a key (it does not read the futex), so it may still be called with it.
+    auto *address = &state;
+    stateWrapper.set(COMPLETED);
+    futexWake(address, UINT32_MAX);
+}
+
+void BlockRequest::relocate(uint32_t sectorOffset) {
+    startSector += sectorOffset;
+}
+
+BlockRequest::Type BlockRequest::getType() const {
+    return type;
+}
+
+uint8_t* BlockRequest::getBuffer() const {
+    return buffer;
+}
+
+uint32_t BlockRequest::getStartSector() const {
+    return startSector;
+}
+
+uint32_t BlockRequest::getEndSector() const {
+    return startSector + sectorCount;
+}
+
+uint32_t BlockRequest::getSectorCount() const {
+    return sectorCount;
+}
+
+uint32_t BlockRequest::getTransferredSectors() const {
+    return transferredSectors;
+}
+
+bool BlockRequest::isCompleted() const {
+    return stateWrapper.get() == COMPLETED;
+}
+
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BLOCKREQUEST_H
+#define HHUOS_BLOCKREQUEST_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+
+namespace Device::Storage {
+
+/**
+ * A single read or write request for a range of sectors, which is submitted to a storage device's request queue.
+ * The submitter may either block on the request via wait() or register a completion callback,
+ * which is called from the queue's dispatcher thread once the request has been processed.
+ * Both are mutually exclusive: The callback may free the request, so wait() must only be used without a callback.
+ * The request object must stay valid until it has been completed.
+ */
+class BlockRequest {
+
+public:
+
+    enum Type : uint8_t {
+        READ,
+        WRITE
+    };
+
+    typedef void (*CompletionCallback)(BlockRequest &request, void *context);
+
+    /**
+     * Constructor.
+     */
+    BlockRequest(Type type, uint8_t *buffer, uint32_t startSector, uint32_t sectorCount, CompletionCallback callback = nullptr, void *context = nullptr);
+
+    /**
+     * Copy Constructor.
+     */
+    BlockRequest(const BlockRequest &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BlockRequest &operator=(const BlockRequest &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BlockRequest() = default;
+
+    /**
+     * Block until the request has been completed. Must not be used for requests with a completion callback.
+     *
+     * @return The amount of transferred sectors
+     */
+    uint32_t wait();
+
+    /**
+     * Mark the request as completed, call the completion callback and wake up waiting threads.
+     * This is called by the request queue and must only be called once per request.
+     */
+    void complete(uint32_t transferredSectors);
+
+    /**
+     * Move the request by a given amount of sectors (e.g. to translate partition relative sectors to device sectors).
+     */
+    void relocate(uint32_t sectorOffset);
+
+    [[nodiscard]] Type getType() const;
+
+    [[nodiscard]] uint8_t* getBuffer() const;
+
+    [[nodiscard]] uint32_t getStartSector() const;
+
+    [[nodiscard]] uint32_t getEndSector() const;
+
+    [[nodiscard]] uint32_t getSectorCount() const;
+
+    [[nodiscard]] uint32_t getTransferredSectors() const;
+
+    [[nodiscard]] bool isCompleted() const;
+
+    /**
+     * Requests, that have been merged into a single transfer, are chained via this pointer.
+     */
+    BlockRequest *next = nullptr;
+
+    /**
+     * System time in milliseconds, at which the request has been submitted (used for deadline scheduling).
+     */
+    uint32_t submitTime = 0;
+
+private:
+
+    Type type;
+    uint8_t *buffer;
+    uint32_t startSector;
+    uint32_t sectorCount;
+    uint32_t transferredSectors = 0;
+
+    CompletionCallback callback;
+    void *context;
+
+    // Futex, which is set to COMPLETED with a single atomic store. The waiter may destroy the request right afterwards.
+    uint32_t state = PENDING;
+    Util::Async::Atomic<uint32_t> stateWrapper;
+
+    static const constexpr uint32_t PENDING = 0;
+    static const constexpr uint32_t COMPLETED = 1;
+};
+
+/**
+ * A contiguous range of sectors, consisting of one or more adjacent requests of the same type,
+ * which is transferred with a single call to the storage device driver.
+ */
+struct BlockRequestBatch {
+    BlockRequest::Type type;
+    uint32_t startSector;
+    uint32_t sectorCount;
+    uint32_t submitTime;   // Submit time of the oldest request in this batch
+    BlockRequest *first;
+    BlockRequest *last;
+
+    [[nodiscard]] uint32_t getEndSector() const {
+        return startSector + sectorCount;
+    }
+};
+
+}
+
+#endif
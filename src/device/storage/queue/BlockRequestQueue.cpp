@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BlockRequestQueue.h"
+
+#include "BlockRequestDispatcher.h"
+#include "DeadlineIoScheduler.h"
+#include "ElevatorIoScheduler.h"
+#include "FifoIoScheduler.h"
+#include "IoScheduler.h"
+#include "device/storage/StorageDevice.h"
+#include "kernel/process/Thread.h"
+#include "kernel/service/ProcessService.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/system/System.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/time/Timestamp.h"
+
+extern uint32_t scheduler_initialized;
+
+namespace Device::Storage {
+
+BlockRequestQueue::BlockRequestQueue(StorageDevice &device, IoScheduler *scheduler) : device(device), scheduler(scheduler) {
+    auto &processService = Kernel::System::getService<Kernel::ProcessService>();
+    auto &dispatcherThread = Kernel::Thread::createKernelThread("Block-Request-Dispatcher", processService.getKernelProcess(), new BlockRequestDispatcher(*this));
+    Kernel::System::getService<Kernel::SchedulerService>().ready(dispatcherThread);
+}
+
+BlockRequestQueue::~BlockRequestQueue() {
+    delete scheduler;
+}
+
+void BlockRequestQueue::submit(BlockRequest &request) {
+    if (request.getSectorCount() == 0) {
+        request.complete(0);
+        return;
+    }
+
+    request.submitTime = Util::Time::getSystemTime().toMilliseconds();
+
+    if (!scheduler_initialized) {
+        // The dispatcher thread cannot run yet -> Execute request directly
+        auto batch = BlockRequestBatch{request.getType(), request.getStartSector(), request.getSectorCount(), request.submitTime, &request, &request};
+        execute(batch);
+        return;
+    }
+
+    lock.acquire();
+    submittedRequests++;
+
+    if (merge(request)) {
+        mergedRequests++;
+        lock.release();
+        return;
+    }
+
+    pending.add(new BlockRequestBatch{request.getType(), request.getStartSector(), request.getSectorCount(), request.submitTime, &request, &request});
+    lock.release();
+    pendingBatches.release();
+}
+
+bool BlockRequestQueue::merge(BlockRequest &request) {
+    for (auto *batch : pending) {
+        if (batch->type != request.getType() || batch->sectorCount + request.getSectorCount() > MAX_BATCH_SECTORS) {
+            continue;
+        }
+
+        if (batch->getEndSector() == request.getStartSector()) {
+            // Back merge
+            batch->last->next = &request;
+            batch->last = &request;
+            batch->sectorCount += request.getSectorCount();
+            return true;
+        }
+
+        if (request.getEndSector() == batch->startSector) {
+            // Front merge
+            request.next = batch->first;
+            batch->first = &request;
+            batch->startSector = request.getStartSector();
+            batch->sectorCount += request.getSectorCount();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void BlockRequestQueue::dispatch() {
+    pendingBatches.acquire();
+
+    lock.acquire();
+    auto now = Util::Time::getSystemTime().toMilliseconds();
+    auto *batch = pending.removeIndex(scheduler->selectNext(pending, headPosition, now));
+    headPosition = batch->getEndSector();
+    dispatchedBatches++;
+    lock.release();
+
+    execute(*batch);
+    delete batch;
+}
+
+void BlockRequestQueue::execute(BlockRequestBatch &batch) {
+    auto sectorSize = device.getSectorSize();
+
+    // Check if the requests' buffers are adjacent in memory as well, so that no bounce buffer is needed
+    bool contiguous = true;
+    for (auto *request = batch.first; request->next != nullptr; request = request->next) {
+        if (request->getBuffer() + request->getSectorCount() * sectorSize != request->next->getBuffer()) {
+            contiguous = false;
+            break;
+        }
+    }
+
+    auto *buffer = contiguous ? batch.first->getBuffer() : new uint8_t[batch.sectorCount * sectorSize];
+    uint32_t transferred;
+
+    if (batch.type == BlockRequest::READ) {
+        transferred = device.read(buffer, batch.startSector, batch.sectorCount);
+    } else {
+        if (!contiguous) {
+            // Gather write data into the bounce buffer
+            auto offset = 0;
+            for (auto *request = batch.first; request != nullptr; request = request->next) {
+                auto size = request->getSectorCount() * sectorSize;
+                Util::Address<uint32_t>(buffer + offset).copyRange(Util::Address<uint32_t>(request->getBuffer()), size);
+                offset += size;
+            }
+        }
+
+        transferred = device.write(buffer, batch.startSector, batch.sectorCount);
+    }
+
+    // Distribute the result over all requests of this batch (and scatter read data, if a bounce buffer has been used)
+    uint32_t sector = batch.startSector;
+    auto *request = batch.first;
+    while (request != nullptr) {
+        auto *next = request->next;
+        auto processed = sector - batch.startSector;
+        auto requestTransferred = transferred <= processed ? 0 : transferred - processed;
+        if (requestTransferred > request->getSectorCount()) {
+            requestTransferred = request->getSectorCount();
+        }
+
+        if (!contiguous && batch.type == BlockRequest::READ) {
+            Util::Address<uint32_t>(request->getBuffer()).copyRange(Util::Address<uint32_t>(buffer + processed * sectorSize), requestTransferred * sectorSize);
+        }
+
+        sector += request->getSectorCount();
+        request->complete(requestTransferred);
+        request = next;
+    }
+
+    if (!contiguous) {
+        delete[] buffer;
+    }
+}
+
+void BlockRequestQueue::setScheduler(IoScheduler *scheduler) {
+    lock.acquire();
+    delete BlockRequestQueue::scheduler;
+    BlockRequestQueue::scheduler = scheduler;
+    lock.release();
+}
+
+uint32_t BlockRequestQueue::getSubmittedRequests() const {
+    return submittedRequests;
+}
+
+uint32_t BlockRequestQueue::getMergedRequests() const {
+    return mergedRequests;
+}
+
+uint32_t BlockRequestQueue::getDispatchedBatches() const {
+    return dispatchedBatches;
+}
+
+IoScheduler* BlockRequestQueue::createScheduler(const Util::String &name) {
+    if (name == "fifo") {
+        return new FifoIoScheduler();
+    } else if (name == "elevator") {
+        return new ElevatorIoScheduler();
+    }
+
+    return new DeadlineIoScheduler();
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BLOCKREQUESTQUEUE_H
+#define HHUOS_BLOCKREQUESTQUEUE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Semaphore.h"
+#include "lib/util/collection/ArrayList.h"
+#include "lib/util/base/String.h"
+#include "BlockRequest.h"
+
+namespace Device {
+namespace Storage {
+class IoScheduler;
+class StorageDevice;
+}  // namespace Storage
+}  // namespace Device
+
+namespace Device::Storage {
+
+/**
+ * Request queue between filesystems and a storage device driver.
+ * Requests are submitted asynchronously and merged with pending requests of the same type, if their sectors are adjacent.
+ * A dedicated dispatcher thread passes the resulting batches to the driver in the order chosen by an exchangeable IoScheduler.
+ * Until the scheduler is running, requests are executed synchronously by the submitting thread.
+ */
+class BlockRequestQueue {
+
+public:
+    /**
+     * Constructor.
+     * The queue takes ownership of the given scheduler.
+     */
+    BlockRequestQueue(StorageDevice &device, IoScheduler *scheduler);
+
+    /**
+     * Copy Constructor.
+     */
+    BlockRequestQueue(const BlockRequestQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BlockRequestQueue &operator=(const BlockRequestQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BlockRequestQueue();
+
+    /**
+     * Enqueue a request. The request is completed asynchronously by the dispatcher thread.
+     */
+    void submit(BlockRequest &request);
+
+    /**
+     * Wait for a pending batch and pass it to the storage device driver.
+     * This is called in a loop by the dispatcher thread.
+     */
+    void dispatch();
+
+    /**
+     * Replace the ordering policy. The queue takes ownership of the given scheduler.
+     */
+    void setScheduler(IoScheduler *scheduler);
+
+    [[nodiscard]] uint32_t getSubmittedRequests() const;
+
+    [[nodiscard]] uint32_t getMergedRequests() const;
+
+    [[nodiscard]] uint32_t getDispatchedBatches() const;
+
+    /**
+     * Create a scheduler by its name ('fifo', 'elevator' or 'deadline').
+     * Unknown names result in the default scheduler (deadline).
+     */
+    static IoScheduler* createScheduler(const Util::String &name);
+
+private:
+
+    bool merge(BlockRequest &request);
+
+    void execute(BlockRequestBatch &batch);
+
+    StorageDevice &device;
+    IoScheduler *scheduler;
+
+    Util::ArrayList<BlockRequestBatch*> pending;
+    Util::Async::Spinlock lock;
+    Util::Async::Semaphore pendingBatches;
+    uint32_t headPosition = 0;
+
+    uint32_t submittedRequests = 0;
+    uint32_t mergedRequests = 0;
+    uint32_t dispatchedBatches = 0;
+
+    static const constexpr uint32_t MAX_BATCH_SECTORS = 256;
+};
+
+}
+
+#endif
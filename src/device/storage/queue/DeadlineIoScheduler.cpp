@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "DeadlineIoScheduler.h"
+
+#include "device/storage/queue/BlockRequest.h"
+
+namespace Device::Storage {
+
+uint32_t DeadlineIoScheduler::selectNext(const Util::ArrayList<BlockRequestBatch*> &pending, uint32_t headPosition, uint32_t now) {
+    // Pending batches are kept in submission order -> The first expired batch is the one, that has been waiting the longest
+    for (uint32_t i = 0; i < pending.size(); i++) {
+        auto *batch = pending.get(i);
+        auto deadline = batch->type == BlockRequest::READ ? READ_DEADLINE : WRITE_DEADLINE;
+        if (now - batch->submitTime >= deadline) {
+            return i;
+        }
+    }
+
+    return ElevatorIoScheduler::selectNext(pending, headPosition, now);
+}
+
+}
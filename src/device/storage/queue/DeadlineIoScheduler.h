@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_DEADLINEIOSCHEDULER_H
+#define HHUOS_DEADLINEIOSCHEDULER_H
+
+#include <cstdint>
+
+#include "ElevatorIoScheduler.h"
+#include "lib/util/collection/ArrayList.h"
+
+namespace Device::Storage {
+
+/**
+ * Elevator scheduling with deadlines: Batches are ordered like in the C-LOOK elevator,
+ * but a batch, that has been waiting longer than its deadline, is dispatched first to prevent starvation.
+ * Reads get a shorter deadline than writes, since readers usually block on their requests.
+ */
+class DeadlineIoScheduler : public ElevatorIoScheduler {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    DeadlineIoScheduler() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    DeadlineIoScheduler(const DeadlineIoScheduler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    DeadlineIoScheduler &operator=(const DeadlineIoScheduler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~DeadlineIoScheduler() override = default;
+
+    /**
+     * Overriding function from IoScheduler.
+     */
+    uint32_t selectNext(const Util::ArrayList<BlockRequestBatch*> &pending, uint32_t headPosition, uint32_t now) override;
+
+private:
+
+    static const constexpr uint32_t READ_DEADLINE = 100;
+    static const constexpr uint32_t WRITE_DEADLINE = 1000;
+};
+
+}
+
+#endif
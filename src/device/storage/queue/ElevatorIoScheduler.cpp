@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ElevatorIoScheduler.h"
+
+#include "device/storage/queue/BlockRequest.h"
+
+namespace Device::Storage {
+
+uint32_t ElevatorIoScheduler::selectNext(const Util::ArrayList<BlockRequestBatch*> &pending, uint32_t headPosition, uint32_t now) {
+    uint32_t nextIndex = pending.size();
+    uint32_t lowestIndex = 0;
+
+    for (uint32_t i = 0; i < pending.size(); i++) {
+        auto *batch = pending.get(i);
+        if (batch->startSector < pending.get(lowestIndex)->startSector) {
+            lowestIndex = i;
+        }
+
+        // Search the nearest batch in front of the head
+        if (batch->startSector >= headPosition && (nextIndex == pending.size() || batch->startSector < pending.get(nextIndex)->startSector)) {
+            nextIndex = i;
+        }
+    }
+
+    // No batch in front of the head -> Jump back to the lowest sector
+    return nextIndex == pending.size() ? lowestIndex : nextIndex;
+}
+
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_ELEVATORIOSCHEDULER_H
+#define HHUOS_ELEVATORIOSCHEDULER_H
+
+#include <cstdint>
+
+#include "IoScheduler.h"
+#include "lib/util/collection/ArrayList.h"
+
+namespace Device::Storage {
+
+/**
+ * C-LOOK elevator: Batches are dispatched in ascending sector order, starting at the current head position.
+ * After the highest pending sector has been reached, the head jumps back to the lowest pending sector.
+ */
+class ElevatorIoScheduler : public IoScheduler {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    ElevatorIoScheduler() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    ElevatorIoScheduler(const ElevatorIoScheduler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ElevatorIoScheduler &operator=(const ElevatorIoScheduler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ElevatorIoScheduler() override = default;
+
+    /**
+     * Overriding function from IoScheduler.
+     */
+    uint32_t selectNext(const Util::ArrayList<BlockRequestBatch*> &pending, uint32_t headPosition, uint32_t now) override;
+};
+
+}
+
+#endif
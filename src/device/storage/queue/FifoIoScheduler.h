@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_FIFOIOSCHEDULER_H
+#define HHUOS_FIFOIOSCHEDULER_H
+
+#include <cstdint>
+
+#include "IoScheduler.h"
+#include "lib/util/collection/ArrayList.h"
+
+namespace Device::Storage {
+
+/**
+ * Dispatches batches in submission order (no reordering besides request merging).
+ */
+class FifoIoScheduler : public IoScheduler {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    FifoIoScheduler() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    FifoIoScheduler(const FifoIoScheduler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    FifoIoScheduler &operator=(const FifoIoScheduler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~FifoIoScheduler() override = default;
+
+    /**
+     * Overriding function from IoScheduler.
+     */
+    uint32_t selectNext(const Util::ArrayList<BlockRequestBatch*> &pending, uint32_t headPosition, uint32_t now) override;
+};
+
+}
+
+#endif
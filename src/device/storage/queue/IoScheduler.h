@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_IOSCHEDULER_H
+#define HHUOS_IOSCHEDULER_H
+
+#include <cstdint>
+
+#include "lib/util/collection/ArrayList.h"
+#include "BlockRequest.h"
+
+namespace Device::Storage {
+
+/**
+ * Ordering policy of a block request queue. Each time the storage device becomes idle,
+ * the queue asks its scheduler, which of the pending (already merged) batches should be dispatched next.
+ */
+class IoScheduler {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    IoScheduler() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    IoScheduler(const IoScheduler &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    IoScheduler &operator=(const IoScheduler &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    virtual ~IoScheduler() = default;
+
+    /**
+     * Select the next batch to dispatch.
+     *
+     * @param pending The pending batches in submission order (never empty)
+     * @param headPosition The sector following the last dispatched batch
+     * @param now The current system time in milliseconds
+     * @return The index of the selected batch in 'pending'
+     */
+    virtual uint32_t selectNext(const Util::ArrayList<BlockRequestBatch*> &pending, uint32_t headPosition, uint32_t now) = 0;
+};
+
+}
+
+#endif
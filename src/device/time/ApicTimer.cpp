@@ -59,15 +59,8 @@ void ApicTimer::trigger(const Kernel::InterruptFrame &frame) {
     // Increase the "core-local" time, the system time is still managed by the PIT.
     time.addNanoseconds(timerInterval * 1000000); // Interval is in milliseconds
 
-    if (cpuId != 0) {
-        // Currently there is only one scheduler, it should get triggered only by the BSP.
-        // Otherwise, the scheduler would be triggered n-times faster than intended, where n
-        // is the CPU count.
-        return;
-    }
-
     if (time.toMilliseconds() % yieldInterval == 0) {
-        // Currently there is only one main scheduler, for SMP systems this should yield the core scheduler or something similar.
+        // Every CPU has its own run queue, so the scheduler only switches threads on the executing CPU
         Kernel::System::getService<Kernel::SchedulerService>().yield();
     }
 }
@@ -22,6 +22,7 @@
 #include "kernel/interrupt/InterruptDispatcher.h"
 #include "kernel/log/Logger.h"
 #include "kernel/service/SchedulerService.h"
+#include "kernel/service/TimeService.h"
 #include "lib/util/base/Exception.h"
 #include "device/debug/FirmwareConfiguration.h"
 
@@ -63,6 +64,9 @@ void Pit::plugin() {
 
 void Pit::trigger(const Kernel::InterruptFrame &frame) {
     time.addNanoseconds(timerInterval);
+    if (Kernel::System::isServiceRegistered(Kernel::TimeService::SERVICE_ID)) {
+        Kernel::System::getService<Kernel::TimeService>().publishSystemTime(time);
+    }
 
     auto &interruptService = Kernel::System::getService<Kernel::InterruptService>();
     if (!interruptService.usesApic() && time.toMilliseconds() % yieldInterval == 0) {
@@ -77,6 +77,17 @@ public:
      * @return true on success
      */
     virtual bool deleteNode(const Util::String &path) = 0;
+
+    /**
+     * Check whether failed lookups may be cached by the filesystem.
+     * This is only allowed for drivers, whose nodes are exclusively created and deleted via createNode() and deleteNode(),
+     * since the filesystem cannot notice nodes appearing by other means (e.g. nodes added directly to a memory driver).
+     *
+     * @return true, if negative lookup results may be cached
+     */
+    virtual bool allowsNegativeLookupCaching() {
+        return false;
+    }
 };
 
 }
@@ -42,7 +42,7 @@ bool Filesystem::mount(const Util::String &deviceName, const Util::String &targe
     auto parsedPath = Util::Io::File::getCanonicalPath(targetPath) + Util::Io::File::SEPARATOR;
     auto *targetNode = getNode(parsedPath);
     if (targetNode == nullptr) {
-        if (mountPoints.size() != 0) {
+        if (mountTable.size() != 0) {
             return lock.releaseAndReturn(false);
         }
     }
@@ -54,11 +54,11 @@ bool Filesystem::mount(const Util::String &deviceName, const Util::String &targe
         return lock.releaseAndReturn(false);
     }
 
-    if (mountPoints.containsKey(parsedPath)) {
+    if (!mountTable.add(parsedPath, driver)) {
         return lock.releaseAndReturn(false);
     }
 
-    mountPoints.put(parsedPath, driver);
+    pathCache.clear();
     mountInformation.put(parsedPath, {deviceName, targetPath, driverName});
     return lock.releaseAndReturn(true);
 }
@@ -70,18 +70,18 @@ bool Filesystem::mountVirtualDriver(const Util::String &targetPath, VirtualDrive
 
     auto *targetNode = getNode(parsedPath);
     if (targetNode == nullptr) {
-        if (mountPoints.size() != 0) {
+        if (mountTable.size() != 0) {
             return lock.releaseAndReturn(false);
         }
     }
 
     delete targetNode;
 
-    if (mountPoints.containsKey(parsedPath)) {
+    if (!mountTable.add(parsedPath, driver)) {
         return lock.releaseAndReturn(false);
     }
 
-    mountPoints.put(parsedPath, driver);
+    pathCache.clear();
     mountInformation.put(parsedPath, {"Virtual", targetPath, "VirtualDriver"});
     return lock.releaseAndReturn(true);
 }
@@ -89,7 +89,7 @@ bool Filesystem::mountVirtualDriver(const Util::String &targetPath, VirtualDrive
 Memory::MemoryDriver& Filesystem::getVirtualDriver(const Util::String &path) {
     lock.acquire();
     auto parsedPath = Util::Io::File::getCanonicalPath(path) + Util::Io::File::SEPARATOR;
-    auto *driver = mountPoints.get(parsedPath);
+    auto *driver = mountTable.get(parsedPath);
 
     return lock.releaseAndReturn<Memory::MemoryDriver&>(*reinterpret_cast<Memory::MemoryDriver*>(driver));
 }
@@ -108,17 +108,15 @@ bool Filesystem::unmount(const Util::String &path) {
 
     delete targetNode;
 
-    for(const Util::String &key : mountPoints.keys()) {
-        if(key.beginsWith(parsedPath)) {
-            if(key != parsedPath) {
-                return lock.releaseAndReturn(false);
-            }
-        }
+    if (mountTable.hasMountsBelow(parsedPath)) {
+        return lock.releaseAndReturn(false);
     }
 
-    if(mountPoints.containsKey(parsedPath)) {
+    auto *driver = mountTable.remove(parsedPath);
+    if (driver != nullptr) {
         mountInformation.remove(parsedPath);
-        delete mountPoints.remove(parsedPath);
+        pathCache.clear();
+        delete driver;
         return lock.releaseAndReturn(true);
     }
 
@@ -145,12 +143,33 @@ Node* Filesystem::getNode(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
     lock.acquire();
 
-    auto *driver = getMountedDriver(parsedPath);
+    auto *entry = pathCache.get(parsedPath);
+    if (entry != nullptr) {
+        if (entry->negative) {
+            return lock.releaseAndReturn(nullptr);
+        }
+
+        auto *node = entry->driver->getNode(entry->relativePath);
+        if (node == nullptr) {
+            pathCache.remove(parsedPath);
+        }
+
+        return lock.releaseAndReturn(node);
+    }
+
+    auto relativePath = parsedPath;
+    auto *driver = getMountedDriver(relativePath);
     if (driver == nullptr) {
         return lock.releaseAndReturn(nullptr);
     }
 
-    Node *ret = driver->getNode(parsedPath);
+    Node *ret = driver->getNode(relativePath);
+    if (ret != nullptr) {
+        pathCache.put(parsedPath, driver, relativePath);
+    } else if (driver->allowsNegativeLookupCaching()) {
+        pathCache.putNegative(parsedPath, driver);
+    }
+
     return lock.releaseAndReturn(ret);
 }
 
@@ -158,6 +177,7 @@ bool Filesystem::createFile(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
     lock.acquire();
 
+    pathCache.remove(parsedPath);
     auto *driver = getMountedDriver(parsedPath);
     if (driver == nullptr) {
         return lock.releaseAndReturn(false);
@@ -171,6 +191,7 @@ bool Filesystem::createDirectory(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
     lock.acquire();
 
+    pathCache.remove(parsedPath);
     auto *driver = getMountedDriver(parsedPath);
     if (driver == nullptr) {
         return lock.releaseAndReturn(false);
@@ -184,13 +205,11 @@ bool Filesystem::deleteFile(const Util::String &path) {
     auto parsedPath = Util::Io::File::getCanonicalPath(path);
     lock.acquire();
 
-    for (const Util::String &key : mountPoints.keys()) {
-        if (key.beginsWith(parsedPath)) {
-            lock.release();
-            return false;
-        }
+    if (mountTable.get(parsedPath) != nullptr || mountTable.hasMountsBelow(parsedPath)) {
+        return lock.releaseAndReturn(false);
     }
 
+    pathCache.remove(parsedPath);
     auto *driver = getMountedDriver(parsedPath);
     if (driver == nullptr) {
         return lock.releaseAndReturn(false);
@@ -208,21 +227,14 @@ Driver* Filesystem::getMountedDriver(Util::String &path) {
 
     lock.acquire();
 
-    Util::String ret;
-    for (const Util::String &currentString: mountPoints.keys()) {
-        if (path.beginsWith(currentString)) {
-            if (currentString.length() > ret.length()) {
-                ret = currentString;
-            }
-        }
-    }
-
-    if (ret.isEmpty()) {
+    uint32_t prefixLength = 0;
+    auto *driver = mountTable.findLongestPrefix(path, prefixLength);
+    if (driver == nullptr) {
         return lock.releaseAndReturn(nullptr);
     }
 
-    path = path.substring(ret.length(), path.length() - 1);
-    return lock.releaseAndReturn(mountPoints.get(ret));
+    path = path.substring(prefixLength, path.length() - 1);
+    return lock.releaseAndReturn(driver);
 }
 
 Util::Array<MountInformation> Filesystem::getMountInformation() {
@@ -230,6 +242,10 @@ Util::Array<MountInformation> Filesystem::getMountInformation() {
     return lock.releaseAndReturn(mountInformation.values());
 }
 
+const PathCache& Filesystem::getPathCache() const {
+    return pathCache;
+}
+
 bool MountInformation::operator!=(const MountInformation &other) const {
     return target == other.target;
 }
@@ -25,6 +25,8 @@
 #include "lib/util/collection/Iterator.h"
 #include "lib/util/base/String.h"
 #include "filesystem/core/Driver.h"
+#include "filesystem/core/MountTable.h"
+#include "filesystem/core/PathCache.h"
 
 namespace Filesystem {
 class Node;
@@ -43,8 +45,9 @@ struct MountInformation {
 };
 
 /**
- * The filesystem. It works by maintaining a list of mount points.
+ * The filesystem. It works by maintaining a table of mount points.
  * Every request is handled by picking the right mount point and and passing the request over to the corresponding driver.
+ * Resolved paths are remembered in a path cache, so that repeated lookups of the same path skip the mount table.
  */
 class Filesystem {
 
@@ -166,7 +169,12 @@ public:
      * @return
      */
     [[nodiscard]] Util::Array<MountInformation> getMountInformation();
-    
+
+    /**
+     * Get the path cache, used to speed up path lookups.
+     */
+    [[nodiscard]] const PathCache& getPathCache() const;
+
 private:
     /**
      * Get the driver, that is mounted at a specified path.
@@ -181,7 +189,8 @@ private:
      */
     [[nodiscard]] Driver* getMountedDriver(Util::String &path);
 
-    Util::HashMap<Util::String, Driver*> mountPoints;
+    MountTable mountTable;
+    PathCache pathCache;
     Util::HashMap<Util::String, MountInformation> mountInformation;
     Util::Async::ReentrantSpinlock lock;
 };
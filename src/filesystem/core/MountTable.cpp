@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "MountTable.h"
+
+#include "lib/util/base/Address.h"
+#include "lib/util/io/file/File.h"
+
+namespace Filesystem {
+
+MountTable::~MountTable() {
+    deleteChildren(root);
+}
+
+bool MountTable::add(const Util::String &path, Driver *driver) {
+    auto *entry = findEntry(path, true);
+    if (entry->driver != nullptr) {
+        return false;
+    }
+
+    entry->driver = driver;
+    mountCount++;
+    return true;
+}
+
+Driver* MountTable::remove(const Util::String &path) {
+    auto *entry = findEntry(path, false);
+    if (entry == nullptr || entry->driver == nullptr) {
+        return nullptr;
+    }
+
+    auto *driver = entry->driver;
+    entry->driver = nullptr;
+    mountCount--;
+
+    // Remove entries, that are no longer part of a path to a mount point
+    while (entry != &root && entry->driver == nullptr && entry->children.isEmpty()) {
+        auto *parent = entry->parent;
+        parent->children.remove(entry);
+        delete entry;
+        entry = parent;
+    }
+
+    return driver;
+}
+
+Driver* MountTable::get(const Util::String &path) const {
+    auto *entry = findEntry(path);
+    return entry == nullptr ? nullptr : entry->driver;
+}
+
+Driver* MountTable::findLongestPrefix(const Util::String &path, uint32_t &prefixLength) const {
+    auto *characters = static_cast<const char*>(path);
+    auto length = path.length();
+    if (length == 0 || characters[0] != Util::Io::File::SEPARATOR[0]) {
+        return nullptr;
+    }
+
+    const Entry *entry = &root;
+    Driver *driver = root.driver;
+    prefixLength = 1;
+
+    // Walk along the path components, remembering the deepest entry with a mounted driver
+    uint32_t start = 1;
+    while (start < length) {
+        auto end = start;
+        while (end < length && characters[end] != Util::Io::File::SEPARATOR[0]) {
+            end++;
+        }
+
+        if (end == length) {
+            // Last component is not terminated by a separator -> Cannot be a mount point
+            break;
+        }
+
+        entry = findChild(*entry, characters + start, end - start);
+        if (entry == nullptr) {
+            break;
+        }
+
+        start = end + 1;
+        if (entry->driver != nullptr) {
+            driver = entry->driver;
+            prefixLength = start;
+        }
+    }
+
+    return driver;
+}
+
+bool MountTable::hasMountsBelow(const Util::String &path) const {
+    auto *entry = findEntry(path);
+    if (entry == nullptr) {
+        return false;
+    }
+
+    for (const auto *child : entry->children) {
+        if (containsMounts(*child)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t MountTable::size() const {
+    return mountCount;
+}
+
+MountTable::Entry* MountTable::findEntry(const Util::String &path, bool create) {
+    auto *characters = static_cast<const char*>(path);
+    auto length = path.length();
+    auto *entry = &root;
+
+    uint32_t start = 1;
+    while (start < length) {
+        auto end = start;
+        while (end < length && characters[end] != Util::Io::File::SEPARATOR[0]) {
+            end++;
+        }
+
+        if (end > start) {
+            auto *child = findChild(*entry, characters + start, end - start);
+            if (child == nullptr) {
+                if (!create) {
+                    return nullptr;
+                }
+
+                child = new Entry();
+                child->name = Util::String(reinterpret_cast<const uint8_t*>(characters + start), end - start);
+                child->parent = entry;
+                entry->children.add(child);
+            }
+
+            entry = child;
+        }
+
+        start = end + 1;
+    }
+
+    return entry;
+}
+
+MountTable::Entry* MountTable::findEntry(const Util::String &path) const {
+    return const_cast<MountTable*>(this)->findEntry(path, false);
+}
+
+MountTable::Entry* MountTable::findChild(const Entry &entry, const char *name, uint32_t length) {
+    for (auto *child : entry.children) {
+        if (child->name.length() == length && Util::Address<uint32_t>(static_cast<const char*>(child->name)).compareRange(Util::Address<uint32_t>(name), length) == 0) {
+            return child;
+        }
+    }
+
+    return nullptr;
+}
+
+bool MountTable::containsMounts(const Entry &entry) {
+    if (entry.driver != nullptr) {
+        return true;
+    }
+
+    for (const auto *child : entry.children) {
+        if (containsMounts(*child)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void MountTable::deleteChildren(Entry &entry) {
+    for (auto *child : entry.children) {
+        deleteChildren(*child);
+        delete child;
+    }
+
+    entry.children.clear();
+}
+
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_MOUNTTABLE_H
+#define HHUOS_MOUNTTABLE_H
+
+#include <cstdint>
+
+#include "lib/util/base/String.h"
+#include "lib/util/collection/ArrayList.h"
+
+namespace Filesystem {
+
+class Driver;
+
+/**
+ * Stores mounted drivers in a tree of path components, so that the mount point of a path can be found
+ * with a single walk along the path (longest prefix match), independent of the amount of mount points.
+ * All paths are expected to be canonical and to end with a separator (e.g. '/' or '/media/').
+ */
+class MountTable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    MountTable() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    MountTable(const MountTable &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    MountTable &operator=(const MountTable &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~MountTable();
+
+    /**
+     * Add a mount point.
+     *
+     * @return false, if there is already a driver mounted at the given path
+     */
+    bool add(const Util::String &path, Driver *driver);
+
+    /**
+     * Remove a mount point.
+     *
+     * @return The driver, that was mounted at the given path (or nullptr, if there was none)
+     */
+    Driver* remove(const Util::String &path);
+
+    /**
+     * Get the driver, that is mounted exactly at the given path.
+     */
+    [[nodiscard]] Driver* get(const Util::String &path) const;
+
+    /**
+     * Find the driver with the longest mount point, that is a prefix of the given path.
+     *
+     * @param path The path
+     * @param prefixLength Is set to the length of the found mount point
+     * @return The driver (or nullptr, if no mount point matches)
+     */
+    Driver* findLongestPrefix(const Util::String &path, uint32_t &prefixLength) const;
+
+    /**
+     * Check, if there are mount points below the given path (excluding the path itself).
+     */
+    [[nodiscard]] bool hasMountsBelow(const Util::String &path) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+private:
+
+    struct Entry {
+        Util::String name;
+        Driver *driver = nullptr;
+        Entry *parent = nullptr;
+        Util::ArrayList<Entry*> children;
+    };
+
+    Entry* findEntry(const Util::String &path, bool create);
+
+    [[nodiscard]] Entry* findEntry(const Util::String &path) const;
+
+    static Entry* findChild(const Entry &entry, const char *name, uint32_t length);
+
+    static bool containsMounts(const Entry &entry);
+
+    static void deleteChildren(Entry &entry);
+
+    Entry root;
+    uint32_t mountCount = 0;
+};
+
+}
+
+#endif
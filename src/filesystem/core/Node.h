@@ -112,6 +112,16 @@ public:
     virtual bool control(uint32_t request, const Util::Array<uint32_t> &parameters) {
         return false;
     }
+
+    /**
+     * Get the address of the node's data, if it resides contiguously in memory and never moves
+     * (e.g. files inside the initial ramdisk). Such nodes can be mapped into processes without copying their data.
+     *
+     * @return The address of the data (or nullptr, if the data can only be accessed via readData())
+     */
+    virtual const uint8_t* getMemoryAddress() {
+        return nullptr;
+    }
 };
 
 }
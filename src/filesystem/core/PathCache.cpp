@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "PathCache.h"
+
+#include "lib/util/io/file/File.h"
+
+namespace Filesystem {
+
+PathCache::PathCache(uint32_t capacity) : entries(new Entry[capacity]), capacity(capacity) {}
+
+PathCache::~PathCache() {
+    delete[] entries;
+}
+
+const PathCache::Entry* PathCache::get(const Util::String &path) {
+    auto &entry = getSlot(path);
+    if (entry.valid && entry.path == path) {
+        hits++;
+        return &entry;
+    }
+
+    misses++;
+    return nullptr;
+}
+
+void PathCache::put(const Util::String &path, Driver *driver, const Util::String &relativePath) {
+    auto &entry = getSlot(path);
+    entry.path = path;
+    entry.relativePath = relativePath;
+    entry.driver = driver;
+    entry.negative = false;
+    entry.valid = true;
+}
+
+void PathCache::putNegative(const Util::String &path, Driver *driver) {
+    auto &entry = getSlot(path);
+    entry.path = path;
+    entry.relativePath = "";
+    entry.driver = driver;
+    entry.negative = true;
+    entry.valid = true;
+}
+
+void PathCache::remove(const Util::String &path) {
+    auto prefix = path + Util::Io::File::SEPARATOR;
+    for (uint32_t i = 0; i < capacity; i++) {
+        auto &entry = entries[i];
+        if (entry.valid && (entry.path == path || entry.path.beginsWith(prefix))) {
+            entry.valid = false;
+        }
+    }
+}
+
+void PathCache::clear() {
+    for (uint32_t i = 0; i < capacity; i++) {
+        entries[i].valid = false;
+    }
+}
+
+uint32_t PathCache::getHits() const {
+    return hits;
+}
+
+uint32_t PathCache::getMisses() const {
+    return misses;
+}
+
+PathCache::Entry& PathCache::getSlot(const Util::String &path) {
+    return entries[path.hashCode() % capacity];
+}
+
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PATHCACHE_H
+#define HHUOS_PATHCACHE_H
+
+#include <cstdint>
+
+#include "lib/util/base/String.h"
+
+namespace Filesystem {
+
+class Driver;
+
+/**
+ * Direct mapped cache for path lookups (dentry cache). Each canonical path is mapped to the driver, it belongs to,
+ * and its path relative to the driver's mount point, so that repeated lookups neither need to search the mount table
+ * nor split the path again. Negative entries remember paths, that do not exist.
+ * Colliding paths simply replace each other, which keeps the cache bounded without any eviction bookkeeping.
+ */
+class PathCache {
+
+public:
+
+    struct Entry {
+        Util::String path;
+        Util::String relativePath;
+        Driver *driver = nullptr;
+        bool negative = false;
+        bool valid = false;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param capacity The amount of cache entries
+     */
+    explicit PathCache(uint32_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * Copy Constructor.
+     */
+    PathCache(const PathCache &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    PathCache &operator=(const PathCache &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~PathCache();
+
+    /**
+     * Look up a canonical path.
+     *
+     * @return The cache entry (or nullptr on a miss). It stays valid until the cache is modified.
+     */
+    const Entry* get(const Util::String &path);
+
+    /**
+     * Remember, that a path belongs to a driver.
+     */
+    void put(const Util::String &path, Driver *driver, const Util::String &relativePath);
+
+    /**
+     * Remember, that a path does not exist.
+     */
+    void putNegative(const Util::String &path, Driver *driver);
+
+    /**
+     * Remove a path and all paths below it.
+     */
+    void remove(const Util::String &path);
+
+    /**
+     * Remove all entries (e.g. after the mount table has been changed).
+     */
+    void clear();
+
+    [[nodiscard]] uint32_t getHits() const;
+
+    [[nodiscard]] uint32_t getMisses() const;
+
+    static const constexpr uint32_t DEFAULT_CAPACITY = 512;
+
+private:
+
+    Entry& getSlot(const Util::String &path);
+
+    Entry *entries;
+    uint32_t capacity;
+
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+};
+
+}
+
+#endif
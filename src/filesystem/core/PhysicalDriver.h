@@ -65,6 +65,14 @@ public:
      * @return True on success
      */
     virtual bool createFilesystem(Device::Storage::StorageDevice &device) = 0;
+
+    /**
+     * Overriding function from Driver.
+     * The namespace of a physical filesystem is only modified via the filesystem.
+     */
+    bool allowsNegativeLookupCaching() override {
+        return true;
+    }
 };
 
 }
@@ -24,6 +24,9 @@
 #include "filesystem/fat/ff/source/ff.h"
 #include "filesystem/fat/ff/source/ffconf.h"
 #include "lib/util/base/Address.h"
+#include "kernel/system/System.h"
+#include "kernel/service/StorageService.h"
+#include "device/storage/cache/BlockCache.h"
 
 extern "C" {
 void* memset(void *str, int32_t c, uint32_t n);
@@ -69,7 +72,8 @@ DSTATUS disk_initialize(BYTE driveNumber) {
 
 DRESULT disk_read(BYTE driveNumber, BYTE *buffer, LBA_t startSector, UINT sectorCount) {
     auto &device = Filesystem::Fat::FatDriver::getStorageDevice(driveNumber);
-    auto result = device.read(buffer, startSector, sectorCount);
+    auto &cache = Kernel::System::getService<Kernel::StorageService>().getBlockCache();
+    auto result = cache.read(device, buffer, startSector, sectorCount);
 
     return result == sectorCount ? RES_OK : RES_ERROR;
 }
@@ -78,7 +82,8 @@ DRESULT disk_read(BYTE driveNumber, BYTE *buffer, LBA_t startSector, UINT sector
 
 DRESULT disk_write(BYTE driveNumber, const BYTE *buffer, LBA_t startSector, UINT sectorCount) {
     auto &device = Filesystem::Fat::FatDriver::getStorageDevice(driveNumber);
-    auto result = device.write(buffer, startSector, sectorCount);
+    auto &cache = Kernel::System::getService<Kernel::StorageService>().getBlockCache();
+    auto result = cache.write(device, buffer, startSector, sectorCount);
 
     return result == sectorCount ? RES_OK : RES_ERROR;
 }
@@ -88,8 +93,10 @@ DRESULT disk_write(BYTE driveNumber, const BYTE *buffer, LBA_t startSector, UINT
 DRESULT disk_ioctl(BYTE driveNumber, BYTE command, void *buffer) {
     auto &device = Filesystem::Fat::FatDriver::getStorageDevice(driveNumber);
     switch (command) {
-        case CTRL_SYNC:
-            return RES_OK;
+        case CTRL_SYNC: {
+            auto &cache = Kernel::System::getService<Kernel::StorageService>().getBlockCache();
+            return cache.flush(&device) ? RES_OK : RES_ERROR;
+        }
         case GET_SECTOR_COUNT: {
             auto *lba = reinterpret_cast<LBA_t *>(buffer);
             *lba = device.getSectorCount();
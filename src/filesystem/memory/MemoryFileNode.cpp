@@ -16,13 +16,21 @@
  */
 
 #include "lib/util/base/Address.h"
+#include "lib/util/async/Atomic.h"
 #include "MemoryFileNode.h"
 #include "filesystem/memory/MemoryNode.h"
 
 namespace Filesystem::Memory {
 
+uint32_t MemoryFileNode::allocatedPages = 0;
+
 MemoryFileNode::MemoryFileNode(const Util::String &name) : MemoryNode(name) {}
 
+MemoryFileNode::~MemoryFileNode() {
+    freePages(0);
+    delete[] pages;
+}
+
 Util::Io::File::Type MemoryFileNode::getType() {
     return Util::Io::File::REGULAR;
 }
@@ -44,34 +52,133 @@ uint64_t MemoryFileNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t
         numBytes = (length - pos);
     }
 
-    auto sourceAddress = Util::Address<uint32_t>(data).add(pos);
-    auto targetAddress = Util::Address<uint32_t>(targetBuffer);
-    targetAddress.copyRange(sourceAddress, numBytes);
+    uint64_t read = 0;
+    while (read < numBytes) {
+        // Shifts and masks instead of 64-bit divisions, which are not available without libgcc
+        auto pageIndex = static_cast<uint32_t>((pos + read) >> PAGE_SHIFT);
+        auto pageOffset = static_cast<uint32_t>((pos + read) & (PAGE_SIZE - 1));
+        auto chunk = PAGE_SIZE - pageOffset < numBytes - read ? PAGE_SIZE - pageOffset : static_cast<uint32_t>(numBytes - read);
+
+        auto targetAddress = Util::Address<uint32_t>(targetBuffer + read);
+        if (pageIndex >= pageTableCapacity || pages[pageIndex] == nullptr) {
+            targetAddress.setRange(0, chunk);
+        } else {
+            targetAddress.copyRange(Util::Address<uint32_t>(pages[pageIndex] + pageOffset), chunk);
+        }
+
+        read += chunk;
+    }
 
     return numBytes;
 }
 
 uint64_t MemoryFileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
-    auto sourceAddress = Util::Address<uint32_t>(sourceBuffer);
+    if (numBytes == 0) {
+        return 0;
+    }
+
+    // Page indices and the page table size are 32 bits wide, so the file must not grow beyond MAX_LENGTH
+    if (pos + numBytes < pos || pos + numBytes > MAX_LENGTH) {
+        return 0;
+    }
 
-    if(pos + numBytes >= length) {
-        auto newLength = pos + numBytes;
-        auto *newData = new uint8_t[newLength];
-        auto oldAddress = Util::Address<uint32_t>(data);
-        auto newAddress = Util::Address<uint32_t>(newData);
+    ensurePageTableCapacity(getPageCount(pos + numBytes));
 
-        newAddress.setRange(0, newLength);
-        newAddress.copyRange(oldAddress, length);
+    uint64_t written = 0;
+    while (written < numBytes) {
+        auto pageIndex = static_cast<uint32_t>((pos + written) >> PAGE_SHIFT);
+        auto pageOffset = static_cast<uint32_t>((pos + written) & (PAGE_SIZE - 1));
+        auto chunk = PAGE_SIZE - pageOffset < numBytes - written ? PAGE_SIZE - pageOffset : static_cast<uint32_t>(numBytes - written);
 
-        delete data;
-        data = newData;
-        length = newLength;
+        if (pages[pageIndex] == nullptr) {
+            pages[pageIndex] = new uint8_t[PAGE_SIZE];
+            Util::Address<uint32_t>(pages[pageIndex]).setRange(0, PAGE_SIZE);
+            Util::Async::Atomic<uint32_t>(allocatedPages).inc();
+        }
+
+        Util::Address<uint32_t>(pages[pageIndex] + pageOffset).copyRange(Util::Address<uint32_t>(sourceBuffer + written), chunk);
+        written += chunk;
     }
 
-    auto targetAddress = Util::Address<uint32_t>(data).add(pos);
-    targetAddress.copyRange(sourceAddress, numBytes);
+    if (pos + numBytes > length) {
+        length = pos + numBytes;
+    }
 
     return numBytes;
 }
 
+bool MemoryFileNode::control(uint32_t request, const Util::Array<uint32_t> &parameters) {
+    switch (request) {
+        case TRUNCATE: {
+            if (parameters.length() < 1) {
+                return false;
+            }
+
+            auto newLength = parameters.length() < 2 ? parameters[0] : (static_cast<uint64_t>(parameters[1]) << 32) | parameters[0];
+            if (newLength > MAX_LENGTH) {
+                return false;
+            }
+
+            truncate(newLength);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+void MemoryFileNode::truncate(uint64_t newLength) {
+    if (newLength < length) {
+        freePages(getPageCount(newLength));
+
+        // Clear the rest of the last page, so that growing the file again reads zeros
+        auto pageOffset = static_cast<uint32_t>(newLength & (PAGE_SIZE - 1));
+        auto lastPage = static_cast<uint32_t>(newLength >> PAGE_SHIFT);
+        if (pageOffset != 0 && lastPage < pageTableCapacity && pages[lastPage] != nullptr) {
+            Util::Address<uint32_t>(pages[lastPage] + pageOffset).setRange(0, PAGE_SIZE - pageOffset);
+        }
+    }
+
+    length = newLength;
+}
+
+uint32_t MemoryFileNode::getAllocatedPages() {
+    return allocatedPages;
+}
+
+void MemoryFileNode::ensurePageTableCapacity(uint32_t pageCount) {
+    if (pageCount <= pageTableCapacity) {
+        return;
+    }
+
+    // Grow geometrically, so that appending is amortized O(1)
+    auto newCapacity = pageTableCapacity < MIN_PAGE_TABLE_CAPACITY ? MIN_PAGE_TABLE_CAPACITY : pageTableCapacity * 2;
+    if (newCapacity < pageCount || newCapacity > MAX_PAGE_COUNT) {
+        newCapacity = pageCount;
+    }
+
+    auto **newPages = new uint8_t*[newCapacity];
+    for (uint32_t i = 0; i < newCapacity; i++) {
+        newPages[i] = i < pageTableCapacity ? pages[i] : nullptr;
+    }
+
+    delete[] pages;
+    pages = newPages;
+    pageTableCapacity = newCapacity;
+}
+
+void MemoryFileNode::freePages(uint32_t firstPage) {
+    for (uint32_t i = firstPage; i < pageTableCapacity; i++) {
+        if (pages[i] != nullptr) {
+            delete[] pages[i];
+            pages[i] = nullptr;
+            Util::Async::Atomic<uint32_t>(allocatedPages).dec();
+        }
+    }
+}
+
+uint32_t MemoryFileNode::getPageCount(uint64_t length) {
+    return static_cast<uint32_t>((length + PAGE_SIZE - 1) >> PAGE_SHIFT);
+}
+
 }
\ No newline at end of file
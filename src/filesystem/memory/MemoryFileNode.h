@@ -22,14 +22,29 @@
 
 #include "MemoryNode.h"
 #include "lib/util/collection/Array.h"
+#include "lib/util/base/Constants.h"
 #include "lib/util/base/String.h"
 #include "lib/util/io/file/File.h"
 
 namespace Filesystem::Memory {
 
+/**
+ * A regular file in memory, whose data is stored in separately allocated pages.
+ * Appending only allocates new pages (and occasionally grows the page table geometrically),
+ * instead of copying the whole file. Pages that have never been written are holes, which read as zeros.
+ */
 class MemoryFileNode : public MemoryNode {
 
 public:
+
+    enum Request {
+        /**
+         * Set the file's length to the first parameter (lower 32 bits) and the second parameter (upper 32 bits).
+         * Pages behind the new end are freed.
+         */
+        TRUNCATE
+    };
+
     /**
      * Constructor.
      */
@@ -48,7 +63,7 @@ public:
     /**
      * Destructor.
      */
-    ~MemoryFileNode() override = default;
+    ~MemoryFileNode() override;
 
     /**
      * Overriding function from Node.
@@ -75,11 +90,42 @@ public:
      */
     uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
 
+    /**
+     * Overriding function from Node.
+     */
+    bool control(uint32_t request, const Util::Array<uint32_t> &parameters) override;
+
+    /**
+     * Set the file's length. Shrinking frees all pages behind the new end,
+     * growing only creates a hole, which does not use any memory until it is written.
+     */
+    void truncate(uint64_t newLength);
+
+    /**
+     * Get the amount of pages, that are currently allocated by all memory files together.
+     */
+    [[nodiscard]] static uint32_t getAllocatedPages();
+
+    static const constexpr uint32_t PAGE_SIZE = Util::PAGESIZE;
+
 private:
 
+    void ensurePageTableCapacity(uint32_t pageCount);
+
+    void freePages(uint32_t firstPage);
+
+    static uint32_t getPageCount(uint64_t length);
+
     uint64_t length = 0;
-    uint8_t *data = nullptr;
+    uint8_t **pages = nullptr;
+    uint32_t pageTableCapacity = 0;
+
+    static uint32_t allocatedPages;
 
+    static const constexpr uint32_t PAGE_SHIFT = 12;
+    static const constexpr uint32_t MIN_PAGE_TABLE_CAPACITY = 8;
+    static const constexpr uint32_t MAX_PAGE_COUNT = UINT32_MAX / sizeof(uint8_t*);
+    static const constexpr uint64_t MAX_LENGTH = static_cast<uint64_t>(MAX_PAGE_COUNT) << PAGE_SHIFT;
 };
 
 }
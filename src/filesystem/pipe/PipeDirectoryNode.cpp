@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "PipeDirectoryNode.h"
+
+namespace Filesystem::Pipe {
+
+PipeDirectoryNode::PipeDirectoryNode(const Util::String &name, const Util::Array<Util::String> &children) : name(name), children(children) {}
+
+Util::String PipeDirectoryNode::getName() {
+    return name;
+}
+
+Util::Io::File::Type PipeDirectoryNode::getType() {
+    return Util::Io::File::DIRECTORY;
+}
+
+uint64_t PipeDirectoryNode::getLength() {
+    return 0;
+}
+
+Util::Array<Util::String> PipeDirectoryNode::getChildren() {
+    return children;
+}
+
+uint64_t PipeDirectoryNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
+    return 0;
+}
+
+uint64_t PipeDirectoryNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    return 0;
+}
+
+}
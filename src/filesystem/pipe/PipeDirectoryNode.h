@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PIPEDIRECTORYNODE_H
+#define HHUOS_PIPEDIRECTORYNODE_H
+
+#include <cstdint>
+
+#include "filesystem/core/Node.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/base/String.h"
+#include "lib/util/io/file/File.h"
+
+namespace Filesystem::Pipe {
+
+/**
+ * A directory with a fixed list of children, used for the driver's root and for each pipe.
+ */
+class PipeDirectoryNode : public Node {
+
+public:
+    /**
+     * Constructor.
+     */
+    PipeDirectoryNode(const Util::String &name, const Util::Array<Util::String> &children);
+
+    /**
+     * Copy Constructor.
+     */
+    PipeDirectoryNode(const PipeDirectoryNode &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    PipeDirectoryNode &operator=(const PipeDirectoryNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~PipeDirectoryNode() override = default;
+
+    /**
+     * Overriding function from Node.
+     */
+    Util::String getName() override;
+
+    /**
+     * Overriding function from Node.
+     */
+    Util::Io::File::Type getType() override;
+
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t getLength() override;
+
+    /**
+     * Overriding function from Node.
+     */
+    Util::Array<Util::String> getChildren() override;
+
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) override;
+
+    /**
+     * Overriding function from Node.
+     */
+    uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
+
+private:
+
+    Util::String name;
+    Util::Array<Util::String> children;
+};
+
+}
+
+#endif
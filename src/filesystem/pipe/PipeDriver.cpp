@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "PipeDriver.h"
+
+#include "PipeDirectoryNode.h"
+#include "PipeNode.h"
+#include "lib/util/collection/Array.h"
+#include "lib/util/io/file/File.h"
+
+namespace Filesystem::Pipe {
+
+Node* PipeDriver::getNode(const Util::String &path) {
+    lock.acquire();
+
+    if (path.isEmpty() || path == "/") {
+        auto ids = pipes.keys();
+        Util::Array<Util::String> children(ids.length());
+        for (uint32_t i = 0; i < ids.length(); i++) {
+            children[i] = Util::String::format("%u", ids[i]);
+        }
+
+        lock.release();
+        return new PipeDirectoryNode("", children);
+    }
+
+    auto splitPath = path.split(Util::Io::File::SEPARATOR);
+    auto id = static_cast<uint32_t>(Util::String::parseInt(splitPath[0]));
+    if (!pipes.containsKey(id)) {
+        lock.release();
+        return nullptr;
+    }
+
+    Node *node = nullptr;
+    if (splitPath.length() == 1) {
+        node = new PipeDirectoryNode(splitPath[0], Util::Array<Util::String>({"read", "write"}));
+    } else if (splitPath.length() == 2) {
+        const auto &name = splitPath[1];
+        if (name == "read") {
+            node = createEndNode(id, *pipes.get(id), Kernel::Pipe::READ);
+        } else if (name == "write") {
+            node = createEndNode(id, *pipes.get(id), Kernel::Pipe::WRITE);
+        }
+    }
+
+    lock.release();
+    return node;
+}
+
+bool PipeDriver::createNode(const Util::String &path, Util::Io::File::Type type) {
+    return false;
+}
+
+bool PipeDriver::deleteNode(const Util::String &path) {
+    return false;
+}
+
+uint32_t PipeDriver::createPipe(Node *&readNode, Node *&writeNode) {
+    auto *pipe = new Kernel::Pipe();
+
+    lock.acquire();
+    auto id = nextId++;
+    pipes.put(id, pipe);
+    readNode = createEndNode(id, *pipe, Kernel::Pipe::READ);
+    writeNode = createEndNode(id, *pipe, Kernel::Pipe::WRITE);
+    lock.release();
+
+    return id;
+}
+
+void PipeDriver::release(uint32_t id, Kernel::Pipe::End end) {
+    lock.acquire();
+    auto *pipe = pipes.get(id);
+    if (pipe->detach(end)) {
+        pipes.remove(id);
+        delete pipe;
+    }
+    lock.release();
+}
+
+Node* PipeDriver::createEndNode(uint32_t id, Kernel::Pipe &pipe, Kernel::Pipe::End end) {
+    // Attaching happens under the driver lock, so that a pipe cannot be deleted while a new end is being opened
+    pipe.attach(end);
+    return new PipeNode(*this, id, pipe, end);
+}
+
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PIPEDRIVER_H
+#define HHUOS_PIPEDRIVER_H
+
+#include <cstdint>
+
+#include "filesystem/core/VirtualDriver.h"
+#include "kernel/file/Pipe.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/base/String.h"
+#include "lib/util/collection/HashMap.h"
+#include "lib/util/io/file/File.h"
+
+namespace Filesystem {
+class Node;
+}  // namespace Filesystem
+
+namespace Filesystem::Pipe {
+
+/**
+ * Exposes all existing pipes as '<id>/read' and '<id>/write'.
+ * Every opened node attaches itself to an end of its pipe and detaches, when it is closed.
+ * A pipe is deleted, as soon as no node references it anymore.
+ */
+class PipeDriver : public VirtualDriver {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    PipeDriver() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    PipeDriver(const PipeDriver &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    PipeDriver &operator=(const PipeDriver &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~PipeDriver() override = default;
+
+    /**
+     * Overriding virtual function from VirtualDriver.
+     */
+    Node* getNode(const Util::String &path) override;
+
+    /**
+     * Overriding virtual function from VirtualDriver.
+     */
+    bool createNode(const Util::String &path, Util::Io::File::Type type) override;
+
+    /**
+     * Overriding virtual function from VirtualDriver.
+     */
+    bool deleteNode(const Util::String &path) override;
+
+    /**
+     * Create a new pipe, together with a node for each of its ends.
+     *
+     * @return The pipe's id
+     */
+    uint32_t createPipe(Node *&readNode, Node *&writeNode);
+
+    /**
+     * Detach an end from a pipe and delete the pipe, if it is no longer referenced.
+     * Called by the pipe's nodes, when they are deleted.
+     */
+    void release(uint32_t id, Kernel::Pipe::End end);
+
+private:
+
+    Node* createEndNode(uint32_t id, Kernel::Pipe &pipe, Kernel::Pipe::End end);
+
+    Util::HashMap<uint32_t, Kernel::Pipe*> pipes;
+    Util::Async::Spinlock lock;
+    uint32_t nextId = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "PipeNode.h"
+
+#include "PipeDriver.h"
+
+namespace Filesystem::Pipe {
+
+PipeNode::PipeNode(PipeDriver &driver, uint32_t id, Kernel::Pipe &pipe, Kernel::Pipe::End end) : driver(driver), id(id), pipe(pipe), end(end) {}
+
+PipeNode::~PipeNode() {
+    driver.release(id, end);
+}
+
+Util::String PipeNode::getName() {
+    return end == Kernel::Pipe::READ ? "read" : "write";
+}
+
+Util::Io::File::Type PipeNode::getType() {
+    return Util::Io::File::CHARACTER;
+}
+
+uint64_t PipeNode::getLength() {
+    return pipe.getAvailableBytes();
+}
+
+Util::Array<Util::String> PipeNode::getChildren() {
+    return Util::Array<Util::String>(0);
+}
+
+uint64_t PipeNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
+    if (end != Kernel::Pipe::READ) {
+        return 0;
+    }
+
+    return pipe.read(targetBuffer, numBytes > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(numBytes));
+}
+
+uint64_t PipeNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    if (end != Kernel::Pipe::WRITE) {
+        return 0;
+    }
+
+    return pipe.write(sourceBuffer, numBytes > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(numBytes));
+}
+
+}
@@ -1,34 +1,13 @@
 #include "ArchiveDirectoryNode.h"
 
 #include "lib/util/base/Exception.h"
-#include "lib/util/io/file/tar/Archive.h"
 
 namespace Filesystem::Tar {
 
-ArchiveDirectoryNode::ArchiveDirectoryNode(Util::Io::Tar::Archive &archive, const Util::String &path) {
-    if(path.isEmpty() || path == "/") {
-        name = "/";
-    } else {
-        Util::Array<Util::String> tokens = path.split("/");
-        name = tokens[tokens.length() - 1];
-    }
-
-    for(const auto &header : archive.getFileHeaders()) {
-        Util::String fullPath = header.filename;
-
-        if(fullPath.beginsWith(path) && fullPath != path) {
-            Util::String subPath = fullPath.substring(path.length(), fullPath.length());
-            Util::String childName = subPath.split("/")[0];
-
-            if(!children.contains(childName)) {
-                children.add(childName);
-            }
-        }
-    }
-}
+ArchiveDirectoryNode::ArchiveDirectoryNode(const ArchiveIndex::Entry &entry) : entry(entry) {}
 
 Util::String ArchiveDirectoryNode::getName() {
-    return name;
+    return entry.getName();
 }
 
 Util::Io::File::Type ArchiveDirectoryNode::getType() {
@@ -40,7 +19,13 @@ uint64_t ArchiveDirectoryNode::getLength() {
 }
 
 Util::Array<Util::String> ArchiveDirectoryNode::getChildren() {
-    return children.toArray();
+    Util::Array<Util::String> children(entry.childCount);
+    uint32_t i = 0;
+    for (const auto *child = entry.firstChild; child != nullptr; child = child->nextSibling) {
+        children[i++] = child->getName();
+    }
+
+    return children;
 }
 
 uint64_t ArchiveDirectoryNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
@@ -4,21 +4,11 @@
 #include <cstdint>
 
 #include "ArchiveNode.h"
+#include "ArchiveIndex.h"
 #include "lib/util/collection/Array.h"
-#include "lib/util/collection/ArrayList.h"
-#include "lib/util/collection/Collection.h"
-#include "lib/util/collection/Iterator.h"
 #include "lib/util/base/String.h"
 #include "lib/util/io/file/File.h"
 
-namespace Util {
-namespace Io {
-namespace Tar {
-class Archive;
-}  // namespace Tar
-}  // namespace File
-}  // namespace Util
-
 namespace Filesystem::Tar {
 
 class ArchiveDirectoryNode : public ArchiveNode {
@@ -26,8 +16,10 @@ class ArchiveDirectoryNode : public ArchiveNode {
 public:
     /**
      * Constructor.
+     *
+     * @param entry The directory's entry in the archive index
      */
-    ArchiveDirectoryNode(Util::Io::Tar::Archive &archive, const Util::String &path);
+    explicit ArchiveDirectoryNode(const ArchiveIndex::Entry &entry);
 
     /**
      * Copy Constructor.
@@ -76,8 +68,7 @@ public:
 
 private:
 
-    Util::String name;
-    Util::ArrayList<Util::String> children;
+    const ArchiveIndex::Entry &entry;
 
 };
 
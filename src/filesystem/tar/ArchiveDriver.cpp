@@ -26,22 +26,19 @@ class Node;
 
 namespace Filesystem::Tar {
 
-ArchiveDriver::ArchiveDriver(Util::Io::Tar::Archive &archive) : archive(archive), fileHeaders(archive.getFileHeaders()) {}
+ArchiveDriver::ArchiveDriver(Util::Io::Tar::Archive &archive) : index(archive) {}
 
 Node *ArchiveDriver::getNode(const Util::String &path) {
-    for(const auto &header : fileHeaders) {
-        Util::String currentPath = header.filename;
-
-        if(path == currentPath) {
-            return new ArchiveFileNode(archive, header);
-        }
+    const auto *entry = index.find(path);
+    if (entry == nullptr) {
+        return nullptr;
+    }
 
-        if((path == "") || (currentPath.beginsWith(path) && currentPath[path.length()] == '/')) {
-            return new ArchiveDirectoryNode(archive, path);
-        }
+    if (entry->isDirectory()) {
+        return new ArchiveDirectoryNode(*entry);
     }
 
-    return nullptr;
+    return new ArchiveFileNode(*entry);
 }
 
 bool ArchiveDriver::createNode(const Util::String &path, Util::Io::File::Type type) {
@@ -51,4 +48,13 @@ bool ArchiveDriver::createNode(const Util::String &path, Util::Io::File::Type ty
 bool ArchiveDriver::deleteNode(const Util::String &path) {
     return false;
 }
+
+bool ArchiveDriver::allowsNegativeLookupCaching() {
+    return true;
+}
+
+const ArchiveIndex& ArchiveDriver::getIndex() const {
+    return index;
+}
+
 }
\ No newline at end of file
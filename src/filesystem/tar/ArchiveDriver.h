@@ -19,8 +19,8 @@
 #define HHUOS_ARCHIVEDRIVER_H
 
 #include "filesystem/core/VirtualDriver.h"
+#include "filesystem/tar/ArchiveIndex.h"
 #include "lib/util/io/file/tar/Archive.h"
-#include "lib/util/collection/Array.h"
 #include "lib/util/base/String.h"
 #include "lib/util/io/file/File.h"
 
@@ -30,6 +30,10 @@ class Node;
 
 namespace Filesystem::Tar {
 
+/**
+ * Read-only driver for tar archives (e.g. the initial ramdisk).
+ * The archive is indexed once on construction, so that lookups do not need to scan all file headers.
+ */
 class ArchiveDriver : public VirtualDriver {
 
 public:
@@ -70,10 +74,17 @@ public:
      */
     bool deleteNode(const Util::String &path) override;
 
+    /**
+     * Overriding virtual function from Driver.
+     * Tar archives are read-only, so failed lookups stay valid forever.
+     */
+    bool allowsNegativeLookupCaching() override;
+
+    [[nodiscard]] const ArchiveIndex& getIndex() const;
+
 private:
 
-    Util::Io::Tar::Archive &archive;
-    Util::Array<Util::Io::Tar::Archive::Header> fileHeaders{};
+    ArchiveIndex index;
 
 };
 
@@ -2,16 +2,10 @@
 
 namespace Filesystem::Tar {
 
-ArchiveFileNode::ArchiveFileNode(Util::Io::Tar::Archive &archive, Util::Io::Tar::Archive::Header fileHeader) {
-    auto path = Util::String(fileHeader.filename);
-    if(!path.isEmpty()) {
-        Util::Array<Util::String> tokens = path.split("/");
-        name = tokens[tokens.length() - 1];
-    }
-
-    length = Util::Io::Tar::Archive::calculateFileSize(fileHeader);
-    dataAddress = Util::Address<uint32_t>(archive.getFile(path));
-}
+ArchiveFileNode::ArchiveFileNode(const ArchiveIndex::Entry &entry) :
+        length(Util::Io::Tar::Archive::calculateFileSize(*entry.header)),
+        dataAddress(Util::Io::Tar::Archive::getFileData(*entry.header)),
+        name(entry.getName()) {}
 
 Util::String ArchiveFileNode::getName() {
     return name;
@@ -48,6 +42,10 @@ uint64_t ArchiveFileNode::readData(uint8_t *targetBuffer, uint64_t pos, uint64_t
     return numBytes;
 }
 
+const uint8_t* ArchiveFileNode::getMemoryAddress() {
+    return reinterpret_cast<const uint8_t*>(dataAddress.get());
+}
+
 uint64_t ArchiveFileNode::writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
     return 0;
 }
@@ -4,6 +4,7 @@
 #include <cstdint>
 
 #include "ArchiveNode.h"
+#include "ArchiveIndex.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/io/file/tar/Archive.h"
 #include "lib/util/base/Address.h"
@@ -17,8 +18,11 @@ class ArchiveFileNode : public ArchiveNode {
 public:
     /**
      * File Constructor.
+     * The node reads directly from the archive's memory, referenced by the index entry.
+     *
+     * @param entry The file's entry in the archive index
      */
-    ArchiveFileNode(Util::Io::Tar::Archive &archive, Util::Io::Tar::Archive::Header fileHeader);
+    explicit ArchiveFileNode(const ArchiveIndex::Entry &entry);
 
     /**
      * Copy Constructor.
@@ -65,6 +69,11 @@ public:
      */
     uint64_t writeData(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) override;
 
+    /**
+     * Overriding function from Node.
+     */
+    const uint8_t* getMemoryAddress() override;
+
 private:
 
     uint32_t length = 0;
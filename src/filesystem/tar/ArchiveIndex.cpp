@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "ArchiveIndex.h"
+
+#include "lib/util/base/Address.h"
+#include "lib/util/collection/Array.h"
+
+namespace Filesystem::Tar {
+
+ArchiveIndex::ArchiveIndex(Util::Io::Tar::Archive &archive) {
+    for (const auto *header : archive.getFileHeaderReferences()) {
+        insert(*header);
+    }
+}
+
+ArchiveIndex::~ArchiveIndex() {
+    deleteChildren(root);
+}
+
+const ArchiveIndex::Entry* ArchiveIndex::find(const Util::String &path) const {
+    auto *characters = static_cast<const char*>(path);
+    auto length = path.length();
+    const Entry *entry = &root;
+
+    uint32_t start = 0;
+    while (start < length) {
+        auto end = start;
+        while (end < length && characters[end] != '/') {
+            end++;
+        }
+
+        if (end > start) {
+            entry = findChild(*entry, characters + start, end - start);
+            if (entry == nullptr) {
+                return nullptr;
+            }
+        }
+
+        start = end + 1;
+    }
+
+    return entry;
+}
+
+uint32_t ArchiveIndex::getFileCount() const {
+    return fileCount;
+}
+
+void ArchiveIndex::insert(const Util::Io::Tar::Archive::Header &header) {
+    const auto *characters = header.filename;
+    uint32_t length = 0;
+    while (length < MAX_FILENAME_LENGTH && characters[length] != '\0') {
+        length++;
+    }
+
+    auto *entry = &root;
+    uint32_t start = 0;
+    while (start < length) {
+        auto end = start;
+        while (end < length && characters[end] != '/') {
+            end++;
+        }
+
+        if (end > start) {
+            auto *child = findChild(*entry, characters + start, end - start);
+            if (child == nullptr) {
+                child = new Entry();
+                child->name = characters + start;
+                child->nameLength = end - start;
+
+                if (entry->lastChild == nullptr) {
+                    entry->firstChild = child;
+                } else {
+                    entry->lastChild->nextSibling = child;
+                }
+
+                entry->lastChild = child;
+                entry->childCount++;
+            }
+
+            entry = child;
+        }
+
+        start = end + 1;
+    }
+
+    if (entry != &root) {
+        entry->header = &header;
+        fileCount++;
+    }
+}
+
+ArchiveIndex::Entry* ArchiveIndex::findChild(const Entry &entry, const char *name, uint32_t length) {
+    for (auto *child = entry.firstChild; child != nullptr; child = child->nextSibling) {
+        if (child->nameLength == length && Util::Address<uint32_t>(child->name).compareRange(Util::Address<uint32_t>(name), length) == 0) {
+            return child;
+        }
+    }
+
+    return nullptr;
+}
+
+void ArchiveIndex::deleteChildren(Entry &entry) {
+    auto *child = entry.firstChild;
+    while (child != nullptr) {
+        auto *next = child->nextSibling;
+        deleteChildren(*child);
+        delete child;
+        child = next;
+    }
+
+    entry.firstChild = nullptr;
+    entry.lastChild = nullptr;
+    entry.childCount = 0;
+}
+
+bool ArchiveIndex::Entry::isDirectory() const {
+    return header == nullptr;
+}
+
+Util::String ArchiveIndex::Entry::getName() const {
+    if (name == nullptr) {
+        return "/";
+    }
+
+    return Util::String(reinterpret_cast<const uint8_t*>(name), nameLength);
+}
+
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_ARCHIVEINDEX_H
+#define HHUOS_ARCHIVEINDEX_H
+
+#include <cstdint>
+
+#include "lib/util/io/file/tar/Archive.h"
+#include "lib/util/base/String.h"
+
+namespace Filesystem::Tar {
+
+/**
+ * Path trie over the files of a tar archive, built once when the archive is mounted.
+ * Tar archives only contain a flat list of headers, so without an index every lookup needs to scan all headers.
+ * Entries reference their names and headers directly inside the archive's memory, nothing is copied.
+ */
+class ArchiveIndex {
+
+public:
+
+    struct Entry {
+        /** Name of the entry (not null terminated, points into the header's filename) */
+        const char *name = nullptr;
+        uint32_t nameLength = 0;
+        /** File header inside the archive (nullptr for directories) */
+        const Util::Io::Tar::Archive::Header *header = nullptr;
+
+        Entry *firstChild = nullptr;
+        Entry *lastChild = nullptr;
+        Entry *nextSibling = nullptr;
+        uint32_t childCount = 0;
+
+        [[nodiscard]] bool isDirectory() const;
+
+        [[nodiscard]] Util::String getName() const;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param archive The archive to index
+     */
+    explicit ArchiveIndex(Util::Io::Tar::Archive &archive);
+
+    /**
+     * Copy Constructor.
+     */
+    ArchiveIndex(const ArchiveIndex &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ArchiveIndex &operator=(const ArchiveIndex &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ArchiveIndex();
+
+    /**
+     * Look up a path relative to the archive's root (e.g. "bin/shell" or "" for the root directory).
+     *
+     * @return The entry (or nullptr, if the path does not exist)
+     */
+    [[nodiscard]] const Entry* find(const Util::String &path) const;
+
+    [[nodiscard]] uint32_t getFileCount() const;
+
+private:
+
+    void insert(const Util::Io::Tar::Archive::Header &header);
+
+    static Entry* findChild(const Entry &entry, const char *name, uint32_t length);
+
+    static void deleteChildren(Entry &entry);
+
+    Entry root;
+    uint32_t fileCount = 0;
+
+    static const constexpr uint32_t MAX_FILENAME_LENGTH = sizeof(Util::Io::Tar::Archive::Header::filename);
+};
+
+}
+
+#endif
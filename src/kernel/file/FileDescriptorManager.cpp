@@ -4,11 +4,14 @@
 #include "kernel/file/FileDescriptorManager.h"
 #include "filesystem/core/Filesystem.h"
 #include "filesystem/core/Node.h"
+#include "filesystem/pipe/PipeDriver.h"
+#include "kernel/file/OpenFile.h"
 #include "lib/util/base/Exception.h"
+#include "lib/util/io/file/File.h"
 
 namespace Kernel {
 
-FileDescriptorManager::FileDescriptorManager(int32_t size) : size(size), descriptorTable(new Filesystem::Node*[size]) {
+FileDescriptorManager::FileDescriptorManager(int32_t size) : size(size), descriptorTable(new OpenFile*[size]) {
     if (size < 0) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "FileDescriptorManager: Size is negative!");
     }
@@ -19,13 +22,14 @@ FileDescriptorManager::FileDescriptorManager(int32_t size) : size(size), descrip
 }
 
 FileDescriptorManager::~FileDescriptorManager() {
+    closeAll();
     delete[] descriptorTable;
 }
 
-int32_t FileDescriptorManager::registerFile(Filesystem::Node *node) {
+int32_t FileDescriptorManager::registerFile(Filesystem::Node *node, const Util::String &path) {
     for (int32_t fileDescriptor = 0; fileDescriptor < size; fileDescriptor++) {
         if (descriptorTable[fileDescriptor] == nullptr) {
-            descriptorTable[fileDescriptor] = node;
+            descriptorTable[fileDescriptor] = new OpenFile(node, path);
             return fileDescriptor;
         }
     }
@@ -40,7 +44,7 @@ int32_t FileDescriptorManager::openFile(const Util::String &path) {
         return -1;
     }
 
-    return registerFile(node);
+    return registerFile(node, Util::Io::File::getCanonicalPath(path));
 }
 
 void FileDescriptorManager::closeFile(int32_t fileDescriptor) {
@@ -48,24 +52,60 @@ void FileDescriptorManager::closeFile(int32_t fileDescriptor) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Invalid file descriptor!");
     }
 
-    auto *node = descriptorTable[fileDescriptor];
-    if (node != nullptr) {
-        delete node;
+    auto *file = descriptorTable[fileDescriptor];
+    if (file != nullptr) {
+        // The file may still be referenced by a memory mapping
+        if (file->release()) {
+            delete file;
+        }
+
         descriptorTable[fileDescriptor] = nullptr;
     }
 }
 
+int32_t FileDescriptorManager::createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor) {
+    Filesystem::Node *readNode;
+    Filesystem::Node *writeNode;
+    auto id = Kernel::System::getService<Kernel::FilesystemService>().getPipeDriver().createPipe(readNode, writeNode);
+
+    readFileDescriptor = registerFile(readNode);
+    if (readFileDescriptor == -1) {
+        delete readNode;
+        delete writeNode;
+        return -1;
+    }
+
+    writeFileDescriptor = registerFile(writeNode);
+    if (writeFileDescriptor == -1) {
+        closeFile(readFileDescriptor);
+        delete writeNode;
+        return -1;
+    }
+
+    return static_cast<int32_t>(id);
+}
+
+void FileDescriptorManager::closeAll() {
+    for (int32_t fileDescriptor = 0; fileDescriptor < size; fileDescriptor++) {
+        closeFile(fileDescriptor);
+    }
+}
+
 Filesystem::Node &FileDescriptorManager::getNode(int32_t fileDescriptor) {
-    if (fileDescriptor == -1) {
+    return getFile(fileDescriptor).getNode();
+}
+
+OpenFile &FileDescriptorManager::getFile(int32_t fileDescriptor) {
+    if (fileDescriptor < 0 || fileDescriptor >= size) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Invalid file descriptor!");
     }
 
-    auto *node = descriptorTable[fileDescriptor];
-    if (node == nullptr) {
+    auto *file = descriptorTable[fileDescriptor];
+    if (file == nullptr) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Invalid file descriptor!");
     }
 
-    return *node;
+    return *file;
 }
 
 }
\ No newline at end of file
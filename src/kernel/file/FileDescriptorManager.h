@@ -10,6 +10,7 @@ class Node;
 }  // namespace Filesystem
 
 namespace Kernel {
+class OpenFile;
 
 class FileDescriptorManager {
 
@@ -34,18 +35,32 @@ public:
      */
     ~FileDescriptorManager();
 
-    int32_t registerFile(Filesystem::Node *node);
+    int32_t registerFile(Filesystem::Node *node, const Util::String &path = Util::String());
 
     int32_t openFile(const Util::String &path);
 
     void closeFile(int32_t fileDescriptor);
 
+    /**
+     * Create a pipe and register both of its ends.
+     *
+     * @return The pipe's id (or -1, if there are not enough free file descriptors)
+     */
+    int32_t createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor);
+
+    /**
+     * Close all open files. Called when a process exits, so that e.g. readers of its pipes see end of file.
+     */
+    void closeAll();
+
     Filesystem::Node& getNode(int32_t fileDescriptor);
 
+    OpenFile& getFile(int32_t fileDescriptor);
+
 private:
 
     int32_t size;
-    Filesystem::Node **descriptorTable;
+    OpenFile **descriptorTable;
 
     static const constexpr int32_t DEFAULT_TABLE_SIZE = 1024;
 
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "OpenFile.h"
+
+#include "filesystem/core/Node.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/system/System.h"
+
+namespace Kernel {
+
+OpenFile::OpenFile(Filesystem::Node *node, const Util::String &path) : node(node), path(path), type(node->getType()) {
+    if (type == Util::Io::File::REGULAR) {
+        length = node->getLength();
+    }
+}
+
+OpenFile::~OpenFile() {
+    delete node;
+}
+
+Filesystem::Node& OpenFile::getNode() {
+    return *node;
+}
+
+Util::Io::File::Type OpenFile::getType() const {
+    return type;
+}
+
+uint64_t OpenFile::getPosition() const {
+    return position;
+}
+
+void OpenFile::retain() {
+    Util::Async::Atomic<uint32_t>(references).inc();
+}
+
+bool OpenFile::release() {
+    return Util::Async::Atomic<uint32_t>(references).dec() == 1;
+}
+
+uint64_t OpenFile::read(uint8_t *targetBuffer, uint64_t numBytes) {
+    auto read = readAt(targetBuffer, position, numBytes);
+    position += read;
+
+    return read;
+}
+
+uint64_t OpenFile::write(const uint8_t *sourceBuffer, uint64_t numBytes) {
+    auto written = writeAt(sourceBuffer, position, numBytes);
+    position += written;
+
+    return written;
+}
+
+uint64_t OpenFile::read(const Util::Io::File::IoVector *vectors, uint32_t count) {
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        auto read = OpenFile::read(vectors[i].buffer, vectors[i].length);
+        total += read;
+
+        if (read < vectors[i].length) {
+            break;
+        }
+    }
+
+    return total;
+}
+
+uint64_t OpenFile::write(const Util::Io::File::IoVector *vectors, uint32_t count) {
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        auto written = OpenFile::write(vectors[i].buffer, vectors[i].length);
+        total += written;
+
+        if (written < vectors[i].length) {
+            break;
+        }
+    }
+
+    return total;
+}
+
+uint64_t OpenFile::readAt(uint8_t *targetBuffer, uint64_t pos, uint64_t numBytes) {
+    if (type == Util::Io::File::REGULAR && pos >= length) {
+        length = node->getLength();
+        if (pos >= length) {
+            return 0;
+        }
+    }
+
+    return node->readData(targetBuffer, pos, numBytes);
+}
+
+uint64_t OpenFile::writeAt(const uint8_t *sourceBuffer, uint64_t pos, uint64_t numBytes) {
+    auto written = node->writeData(sourceBuffer, pos, numBytes);
+    updateLength(pos + written);
+
+    if (written > 0 && !path.isEmpty()) {
+        // Processes started from this file afterwards must not share pages loaded from its old content
+        System::getService<MemoryService>().invalidateSharedSegments(path);
+    }
+
+    return written;
+}
+
+uint64_t OpenFile::seek(int64_t offset, Util::Io::File::SeekMode mode) {
+    int64_t base;
+    switch (mode) {
+        case Util::Io::File::SET:
+            base = 0;
+            break;
+        case Util::Io::File::CURRENT:
+            base = static_cast<int64_t>(position);
+            break;
+        case Util::Io::File::END:
+            length = node->getLength();
+            base = static_cast<int64_t>(length);
+            break;
+        default:
+            return position;
+    }
+
+    auto target = base + offset;
+    position = target < 0 ? 0 : static_cast<uint64_t>(target);
+    return position;
+}
+
+void OpenFile::updateLength(uint64_t end) {
+    if (type == Util::Io::File::REGULAR && end > length) {
+        length = end;
+    }
+}
+
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_OPENFILE_H
+#define HHUOS_OPENFILE_H
+
+#include <cstdint>
+
+#include "lib/util/base/String.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/async/Atomic.h"
+
+namespace Filesystem {
+class Node;
+}  // namespace Filesystem
+
+namespace Kernel {
+
+/**
+ * A file, opened by a process. It owns the node and keeps the current position inside the file,
+ * so that sequential reads and writes need no seeking or length queries from user space.
+ * The type is queried once on opening. The length of regular files is cached and only refreshed,
+ * when a read would otherwise end at the cached length (the file may have been extended through another node).
+ */
+class OpenFile {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param node The node (ownership is transferred to the open file)
+     * @param path The canonical path of the node (empty for nodes without a path, like pipes)
+     */
+    explicit OpenFile(Filesystem::Node *node, const Util::String &path = Util::String());
+
+    /**
+     * Copy Constructor.
+     */
+    OpenFile(const OpenFile &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    OpenFile& operator=(const OpenFile &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~OpenFile();
+
+    [[nodiscard]] Filesystem::Node& getNode();
+
+    [[nodiscard]] Util::Io::File::Type getType() const;
+
+    [[nodiscard]] uint64_t getPosition() const;
+
+    /**
+     * Add a reference (e.g. from a memory mapping), so that the file stays open after its descriptor has been closed.
+     */
+    void retain();
+
+    /**
+     * Remove a reference.
+     *
+     * @return true, if this was the last reference and the file should be deleted
+     */
+    bool release();
+
+    /**
+     * Read from the current position and advance it by the amount of bytes read.
+     *
+     * @return The amount of bytes read (0 at the end of a regular file)
+     */
+    uint64_t read(uint8_t *targetBuffer, uint64_t length);
+
+    /**
+     * Write at the current position and advance it by the amount of bytes written.
+     *
+     * @return The amount of bytes written
+     */
+    uint64_t write(const uint8_t *sourceBuffer, uint64_t length);
+
+    /**
+     * Read into several buffers, starting at the current position. Stops at the first buffer, that cannot be filled completely.
+     *
+     * @return The total amount of bytes read
+     */
+    uint64_t read(const Util::Io::File::IoVector *vectors, uint32_t count);
+
+    /**
+     * Write several buffers, starting at the current position. Stops at the first buffer, that cannot be written completely.
+     *
+     * @return The total amount of bytes written
+     */
+    uint64_t write(const Util::Io::File::IoVector *vectors, uint32_t count);
+
+    /**
+     * Read at an explicit position, leaving the current position untouched.
+     */
+    uint64_t readAt(uint8_t *targetBuffer, uint64_t pos, uint64_t length);
+
+    /**
+     * Write at an explicit position, leaving the current position untouched.
+     */
+    uint64_t writeAt(const uint8_t *sourceBuffer, uint64_t pos, uint64_t length);
+
+    /**
+     * Move the current position.
+     *
+     * @param offset The offset, relative to the position given by mode
+     * @param mode The reference point (start, current position or end of the file)
+     *
+     * @return The new position
+     */
+    uint64_t seek(int64_t offset, Util::Io::File::SeekMode mode);
+
+private:
+
+    void updateLength(uint64_t end);
+
+    Filesystem::Node *node;
+    Util::String path;
+    Util::Io::File::Type type;
+    uint64_t length = 0;
+    uint64_t position = 0;
+    uint32_t references = 1;
+};
+
+}
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Pipe.h"
+
+#include "lib/util/base/Address.h"
+
+namespace Kernel {
+
+void Pipe::attach(Pipe::End end) {
+    waitQueue.lock();
+    if (end == READ) {
+        readers++;
+    } else {
+        writers++;
+    }
+    waitQueue.unlock();
+}
+
+bool Pipe::detach(Pipe::End end) {
+    waitQueue.lock();
+    if (end == READ) {
+        readers--;
+    } else {
+        writers--;
+    }
+
+    bool unused = readers == 0 && writers == 0;
+    waitQueue.unlock();
+
+    // Blocked threads on the other end need to notice, that they will never be served
+    waitQueue.wakeAll();
+    return unused;
+}
+
+uint32_t Pipe::read(uint8_t *targetBuffer, uint32_t length) {
+    if (length == 0) {
+        return 0;
+    }
+
+    waitQueue.lock();
+    while (count == 0 && writers > 0) {
+        waitQueue.waitAndUnlock();
+        waitQueue.lock();
+    }
+
+    if (length > count) {
+        length = count;
+    }
+
+    // The data may wrap around the end of the buffer, so it is copied in up to two parts
+    auto firstPart = CAPACITY - readIndex < length ? CAPACITY - readIndex : length;
+    Util::Address<uint32_t>(targetBuffer).copyRange(Util::Address<uint32_t>(buffer + readIndex), firstPart);
+    Util::Address<uint32_t>(targetBuffer + firstPart).copyRange(Util::Address<uint32_t>(buffer), length - firstPart);
+
+    readIndex = (readIndex + length) % CAPACITY;
+    count -= length;
+    waitQueue.unlock();
+
+    if (length > 0) {
+        waitQueue.wakeAll();
+    }
+
+    return length;
+}
+
+uint32_t Pipe::write(const uint8_t *sourceBuffer, uint32_t length) {
+    uint32_t written = 0;
+
+    while (written < length) {
+        waitQueue.lock();
+        while (count == CAPACITY && readers > 0) {
+            waitQueue.waitAndUnlock();
+            waitQueue.lock();
+        }
+
+        if (readers == 0) {
+            waitQueue.unlock();
+            break;
+        }
+
+        auto part = CAPACITY - count < length - written ? CAPACITY - count : length - written;
+        auto writeIndex = (readIndex + count) % CAPACITY;
+        auto firstPart = CAPACITY - writeIndex < part ? CAPACITY - writeIndex : part;
+        Util::Address<uint32_t>(buffer + writeIndex).copyRange(Util::Address<uint32_t>(sourceBuffer + written), firstPart);
+        Util::Address<uint32_t>(buffer).copyRange(Util::Address<uint32_t>(sourceBuffer + written + firstPart), part - firstPart);
+
+        count += part;
+        written += part;
+        waitQueue.unlock();
+
+        waitQueue.wakeAll();
+    }
+
+    return written;
+}
+
+uint32_t Pipe::getAvailableBytes() const {
+    return count;
+}
+
+}
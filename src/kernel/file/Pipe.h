@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_PIPE_H
+#define HHUOS_PIPE_H
+
+#include <cstdint>
+
+#include "kernel/process/WaitQueue.h"
+#include "lib/util/base/Constants.h"
+
+namespace Kernel {
+
+/**
+ * A unidirectional channel between processes, backed by a page-sized ring buffer.
+ * Readers block until data is available and writers block until there is free space,
+ * so producer and consumer run concurrently with constant memory usage.
+ * Once all writers are detached, reading the remaining data is followed by end of file.
+ * Once all readers are detached, written data is discarded instead of blocking forever.
+ */
+class Pipe {
+
+public:
+
+    enum End {
+        READ,
+        WRITE
+    };
+
+    /**
+     * Default Constructor.
+     */
+    Pipe() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    Pipe(const Pipe &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Pipe &operator=(const Pipe &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Pipe() = default;
+
+    /**
+     * Register a new reader or writer.
+     */
+    void attach(End end);
+
+    /**
+     * Unregister a reader or writer and wake up all threads, blocked on the other end.
+     *
+     * @return true, if neither readers nor writers are attached anymore
+     */
+    bool detach(End end);
+
+    /**
+     * Read up to 'length' bytes, blocking until at least one byte is available.
+     *
+     * @return The amount of bytes read (0 signals end of file, after all writers are detached)
+     */
+    uint32_t read(uint8_t *targetBuffer, uint32_t length);
+
+    /**
+     * Write 'length' bytes, blocking while the buffer is full.
+     *
+     * @return The amount of bytes written (less than 'length', if all readers are detached)
+     */
+    uint32_t write(const uint8_t *sourceBuffer, uint32_t length);
+
+    /**
+     * Get the amount of bytes, that can currently be read without blocking.
+     */
+    [[nodiscard]] uint32_t getAvailableBytes() const;
+
+    static const constexpr uint32_t CAPACITY = Util::PAGESIZE;
+
+private:
+
+    WaitQueue waitQueue;
+
+    uint8_t buffer[CAPACITY]{};
+    uint32_t readIndex = 0;
+    uint32_t count = 0;
+
+    uint32_t readers = 0;
+    uint32_t writers = 0;
+};
+
+}
+
+#endif
@@ -66,6 +66,9 @@ enum InterruptVector : uint8_t {
 
     SYSTEM_CALL = 0x86,
 
+    // Inter-processor interrupts (240 - 246)
+    TLB_SHOOTDOWN = 0xf0,
+
     // Local APIC interrupts (247 - 254)
     CMCI = 0xf8,
     APICTIMER = 0xf9,
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "BuddyMemoryManager.h"
+
+#include "lib/util/base/Exception.h"
+
+namespace Kernel {
+
+BuddyMemoryManager::BuddyMemoryManager(uint32_t startAddress, uint32_t endAddress, uint32_t blockSize) :
+        startAddress(startAddress), endAddress(endAddress), blockSize(blockSize), blockCount((endAddress - startAddress + 1) / blockSize) {
+    uint32_t bitmapSize = 0;
+    for (uint8_t order = 0; order <= MAX_ORDER; order++) {
+        bitmapSize += (getRunCount(order) + 31) / 32;
+    }
+
+    auto *bitmap = new uint32_t[bitmapSize];
+    for (uint32_t i = 0; i < bitmapSize; i++) {
+        bitmap[i] = 0;
+    }
+
+    for (uint8_t order = 0; order <= MAX_ORDER; order++) {
+        bitmaps[order] = bitmap;
+        bitmap += (getRunCount(order) + 31) / 32;
+    }
+
+    // Cover the whole area with the largest possible runs
+    uint32_t block = 0;
+    while (block < blockCount) {
+        uint8_t order = MAX_ORDER;
+        while (order > 0 && ((block & ((1 << order) - 1)) != 0 || block + (1 << order) > blockCount)) {
+            order--;
+        }
+
+        markFree(order, block >> order);
+        block += 1 << order;
+    }
+}
+
+BuddyMemoryManager::~BuddyMemoryManager() {
+    delete[] bitmaps[0];
+}
+
+void *BuddyMemoryManager::allocateBlock() {
+    return allocateBlocks(0);
+}
+
+void BuddyMemoryManager::freeBlock(void *pointer) {
+    freeBlocks(pointer, 0);
+}
+
+void *BuddyMemoryManager::allocateBlocks(uint8_t order) {
+    if (order > MAX_ORDER) {
+        return nullptr;
+    }
+
+    lock.acquire();
+
+    auto currentOrder = order;
+    while (currentOrder <= MAX_ORDER && freeRuns[currentOrder] == 0) {
+        currentOrder++;
+    }
+
+    if (currentOrder > MAX_ORDER) {
+        return lock.releaseAndReturn<void*>(nullptr);
+    }
+
+    auto run = findFreeRun(currentOrder);
+    markUsed(currentOrder, run);
+
+    // Split the run, until it has the requested size. The upper halves stay free.
+    while (currentOrder > order) {
+        currentOrder--;
+        run <<= 1;
+        markFree(currentOrder, run + 1);
+    }
+
+    lock.release();
+    return reinterpret_cast<void*>(startAddress + (run << order) * blockSize);
+}
+
+void BuddyMemoryManager::freeBlocks(void *pointer, uint8_t order) {
+    auto address = reinterpret_cast<uint32_t>(pointer);
+    if (address < startAddress || address > endAddress || order > MAX_ORDER) {
+        return;
+    }
+
+    lock.acquire();
+
+    // Merge with the buddy, as long as it is free
+    auto run = ((address - startAddress) / blockSize) >> order;
+    while (order < MAX_ORDER) {
+        auto buddy = run ^ 1;
+        if (buddy >= getRunCount(order) || !isFree(order, buddy)) {
+            break;
+        }
+
+        markUsed(order, buddy);
+        run >>= 1;
+        order++;
+    }
+
+    markFree(order, run);
+    lock.release();
+}
+
+bool BuddyMemoryManager::reserveBlock(void *pointer) {
+    auto address = reinterpret_cast<uint32_t>(pointer);
+    if (address < startAddress || address > endAddress) {
+        return false;
+    }
+
+    auto block = (address - startAddress) / blockSize;
+    lock.acquire();
+
+    for (uint8_t order = 0; order <= MAX_ORDER; order++) {
+        auto run = block >> order;
+        if (run >= getRunCount(order) || !isFree(order, run)) {
+            continue;
+        }
+
+        // Split the run down to the single block. Halves not containing the block stay free.
+        markUsed(order, run);
+        while (order > 0) {
+            order--;
+            markFree(order, (block >> order) ^ 1);
+        }
+
+        return lock.releaseAndReturn(true);
+    }
+
+    return lock.releaseAndReturn(false);
+}
+
+uint32_t BuddyMemoryManager::getFreeRunCount(uint8_t order) const {
+    return order > MAX_ORDER ? 0 : freeRuns[order];
+}
+
+uint32_t BuddyMemoryManager::getTotalMemory() const {
+    return endAddress - startAddress + 1;
+}
+
+uint32_t BuddyMemoryManager::getFreeMemory() const {
+    uint32_t freeMemory = 0;
+    for (uint8_t order = 0; order <= MAX_ORDER; order++) {
+        freeMemory += (freeRuns[order] << order) * blockSize;
+    }
+
+    return freeMemory;
+}
+
+uint32_t BuddyMemoryManager::getBlockSize() const {
+    return blockSize;
+}
+
+uint32_t BuddyMemoryManager::getStartAddress() const {
+    return startAddress;
+}
+
+uint32_t BuddyMemoryManager::getEndAddress() const {
+    return endAddress;
+}
+
+uint8_t BuddyMemoryManager::getOrder(uint32_t blockCount) {
+    uint8_t order = 0;
+    while ((static_cast<uint32_t>(1) << order) < blockCount) {
+        order++;
+    }
+
+    return order;
+}
+
+uint32_t BuddyMemoryManager::getRunCount(uint8_t order) const {
+    return blockCount >> order;
+}
+
+bool BuddyMemoryManager::isFree(uint8_t order, uint32_t run) const {
+    return (bitmaps[order][run / 32] & (1u << (run % 32))) != 0;
+}
+
+void BuddyMemoryManager::markFree(uint8_t order, uint32_t run) {
+    bitmaps[order][run / 32] |= (1u << (run % 32));
+    freeRuns[order]++;
+
+    if (run / 32 < searchHints[order]) {
+        searchHints[order] = run / 32;
+    }
+}
+
+void BuddyMemoryManager::markUsed(uint8_t order, uint32_t run) {
+    bitmaps[order][run / 32] &= ~(1u << (run % 32));
+    freeRuns[order]--;
+}
+
+uint32_t BuddyMemoryManager::findFreeRun(uint8_t order) {
+    // All words before the search hint are known to be empty
+    auto wordCount = (getRunCount(order) + 31) / 32;
+    for (uint32_t i = searchHints[order]; i < wordCount; i++) {
+        auto word = bitmaps[order][i];
+        if (word != 0) {
+            searchHints[order] = i;
+            return i * 32 + __builtin_ctz(word);
+        }
+    }
+
+    Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "BuddyMemoryManager: Free run counter is inconsistent!");
+}
+
+}
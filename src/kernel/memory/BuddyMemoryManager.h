@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_BUDDYMEMORYMANAGER_H
+#define HHUOS_BUDDYMEMORYMANAGER_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+#include "BlockMemoryManager.h"
+
+namespace Kernel {
+
+/**
+ * Memory manager, that hands out naturally aligned runs of 2^order blocks, using the buddy system.
+ *
+ * Every order has its own bitmap, in which a set bit marks a free run of that order. Freeing a run merges it with its
+ * buddy, as long as the buddy is free as well, so that coalescing takes at most MAX_ORDER steps.
+ * The bitmaps are the only metadata, which allows managing memory that is not mapped into the address space
+ * (e.g. physical page frames).
+ */
+class BuddyMemoryManager : public BlockMemoryManager {
+
+public:
+    /**
+     * Constructor. All blocks are free initially.
+     */
+    BuddyMemoryManager(uint32_t startAddress, uint32_t endAddress, uint32_t blockSize = 4096);
+
+    /**
+     * Copy Constructor.
+     */
+    BuddyMemoryManager(const BuddyMemoryManager &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    BuddyMemoryManager& operator=(const BuddyMemoryManager &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~BuddyMemoryManager() override;
+
+    [[nodiscard]] void *allocateBlock() override;
+
+    void freeBlock(void *pointer) override;
+
+    /**
+     * Allocate 2^order contiguous blocks, aligned to their combined size.
+     *
+     * @return The address of the first block, or nullptr if no run of the requested order is available
+     */
+    [[nodiscard]] void *allocateBlocks(uint8_t order);
+
+    /**
+     * Free 2^order contiguous blocks. Runs may also be freed in smaller parts (e.g. block by block).
+     */
+    void freeBlocks(void *pointer, uint8_t order);
+
+    /**
+     * Take a single free block out of the free lists, splitting the run it is part of.
+     *
+     * @return false, if the block is not free
+     */
+    bool reserveBlock(void *pointer);
+
+    /**
+     * Get the amount of free runs of a given order.
+     */
+    [[nodiscard]] uint32_t getFreeRunCount(uint8_t order) const;
+
+    [[nodiscard]] uint32_t getTotalMemory() const override;
+
+    [[nodiscard]] uint32_t getFreeMemory() const override;
+
+    [[nodiscard]] uint32_t getBlockSize() const override;
+
+    [[nodiscard]] uint32_t getStartAddress() const override;
+
+    [[nodiscard]] uint32_t getEndAddress() const override;
+
+    /**
+     * Calculate the minimal order of a run, that contains the given amount of blocks.
+     */
+    [[nodiscard]] static uint8_t getOrder(uint32_t blockCount);
+
+    static const constexpr uint8_t MAX_ORDER = 10;
+
+private:
+
+    [[nodiscard]] uint32_t getRunCount(uint8_t order) const;
+
+    [[nodiscard]] bool isFree(uint8_t order, uint32_t run) const;
+
+    void markFree(uint8_t order, uint32_t run);
+
+    void markUsed(uint8_t order, uint32_t run);
+
+    [[nodiscard]] uint32_t findFreeRun(uint8_t order);
+
+    uint32_t startAddress;
+    uint32_t endAddress;
+    uint32_t blockSize;
+    uint32_t blockCount;
+
+    uint32_t *bitmaps[MAX_ORDER + 1]{};
+    uint32_t freeRuns[MAX_ORDER + 1]{};
+    uint32_t searchHints[MAX_ORDER + 1]{};
+    Util::Async::Spinlock lock;
+};
+
+}
+
+#endif
@@ -19,6 +19,9 @@
 
 #include "kernel/system/System.h"
 #include "kernel/service/MemoryService.h"
+#include "kernel/memory/BuddyMemoryManager.h"
+#include "kernel/paging/Paging.h"
+#include "filesystem/memory/MemoryFileNode.h"
 
 namespace Kernel {
 
@@ -37,7 +40,33 @@ Util::String MemoryStatusNode::getString() {
     return "Physical:      " + formatMemory(memoryStatus.freePhysicalMemory) + " / " + formatMemory(memoryStatus.totalPhysicalMemory) + "\n"
             + "Lower:         " + formatMemory(memoryStatus.freeLowerMemory) + " / " + formatMemory(memoryStatus.totalLowerMemory) + "\n"
             + "Kernel:        " + formatMemory(memoryStatus.freeKernelHeapMemory) + " / " + formatMemory(memoryStatus.totalKernelHeapMemory) + "\n"
-            + "Paging Area:   " + formatMemory(memoryStatus.freePagingAreaMemory) + " / " + formatMemory(memoryStatus.totalPagingAreaMemory) + "\n";
+            + "Paging Area:   " + formatMemory(memoryStatus.freePagingAreaMemory) + " / " + formatMemory(memoryStatus.totalPagingAreaMemory) + "\n"
+            + "Memory Files:  " + formatMemory(Filesystem::Memory::MemoryFileNode::getAllocatedPages() * Filesystem::Memory::MemoryFileNode::PAGE_SIZE) + "\n"
+            + formatFragmentation(memoryStatus);
+}
+
+Util::String MemoryStatusNode::formatFragmentation(const MemoryService::MemoryStatus &memoryStatus) {
+    Util::String result = "\nFree physical runs per order:\n";
+    uint32_t largestRunSize = 0;
+
+    for (uint8_t order = 0; order <= BuddyMemoryManager::MAX_ORDER; order++) {
+        auto runSize = (static_cast<uint32_t>(1) << order) * Paging::PAGESIZE;
+        auto runCount = memoryStatus.freePhysicalRuns[order];
+        result += Util::String::format("Order %02u (%u KiB): %u\n", order, runSize / 1024, runCount);
+
+        if (runCount > 0) {
+            largestRunSize = runSize;
+        }
+    }
+
+    // Share of free memory, that cannot be used for an allocation of the maximum order
+    auto freeMemory = memoryStatus.freePhysicalMemory;
+    auto maxOrderMemory = memoryStatus.freePhysicalRuns[BuddyMemoryManager::MAX_ORDER] * (static_cast<uint32_t>(1) << BuddyMemoryManager::MAX_ORDER) * Paging::PAGESIZE;
+    // Calculated in KiB, to avoid 64-bit divisions (which are not available without libgcc)
+    auto freeKib = freeMemory / 1024;
+    auto fragmentation = freeKib == 0 ? 0 : ((freeMemory - maxOrderMemory) / 1024) * 100 / freeKib;
+
+    return result + Util::String::format("Largest free run: %u KiB\nFragmentation: %u", largestRunSize / 1024, fragmentation) + "%\n";
 }
 
 }
\ No newline at end of file
@@ -22,6 +22,7 @@
 
 #include "filesystem/memory/StringNode.h"
 #include "lib/util/base/String.h"
+#include "kernel/service/MemoryService.h"
 
 namespace Kernel {
 
@@ -57,6 +58,8 @@ private:
 
     static Util::String formatMemory(uint32_t value);
 
+    static Util::String formatFragmentation(const MemoryService::MemoryStatus &memoryStatus);
+
     Util::String memoryStatusBuffer;
 
 };
@@ -20,11 +20,12 @@
 #include "PageFrameAllocator.h"
 #include "kernel/memory/PagingAreaManager.h"
 #include "kernel/memory/TableMemoryManager.h"
+#include "lib/util/base/Exception.h"
 
 namespace Kernel {
 
 PageFrameAllocator::PageFrameAllocator(PagingAreaManager &pagingAreaManager, uint32_t startAddress, uint32_t endAddress) :
-        TableMemoryManager(pagingAreaManager, startAddress, endAddress, Kernel::Paging::PAGESIZE) {
+        TableMemoryManager(pagingAreaManager, startAddress, endAddress, Kernel::Paging::PAGESIZE), buddyAllocator(startAddress, endAddress, Kernel::Paging::PAGESIZE) {
     auto *blockMap = Multiboot::getBlockMap();
 
     // Reserve blocks already used by system image and initrd
@@ -35,7 +36,119 @@ PageFrameAllocator::PageFrameAllocator(PagingAreaManager &pagingAreaManager, uin
         uint32_t end = start + block.blockCount * blockSize - 1;
 
         setMemory(start, end, 1, block.type == Multiboot::MULTIBOOT_RESERVED);
+        for (uint32_t address = start; address < end && address <= getEndAddress(); address += Kernel::Paging::PAGESIZE) {
+            buddyAllocator.reserveBlock(reinterpret_cast<void*>(address));
+        }
     }
 }
 
+void *PageFrameAllocator::allocateBlock() {
+    lock.acquire();
+    auto *frame = buddyAllocator.allocateBlock();
+    if (frame == nullptr) {
+        lock.release();
+        Util::Exception::throwException(Util::Exception::OUT_OF_PHYSICAL_MEMORY, "PageFrameAllocator: No free page frame left!");
+    }
+
+    frame = TableMemoryManager::allocateBlockAtAddress(frame);
+    lock.release();
+
+    return frame;
+}
+
+void *PageFrameAllocator::allocateBlockAtAddress(void *address) {
+    lock.acquire();
+    if (getUseCount(address) == 0 && !isReserved(address)) {
+        buddyAllocator.reserveBlock(address);
+    }
+
+    auto *frame = TableMemoryManager::allocateBlockAtAddress(address);
+    lock.release();
+
+    return frame;
+}
+
+void PageFrameAllocator::freeBlock(void *pointer) {
+    lock.acquire();
+    TableMemoryManager::freeBlock(pointer);
+    if (getUseCount(pointer) == 0 && !isReserved(pointer)) {
+        buddyAllocator.freeBlock(pointer);
+    }
+
+    lock.release();
+}
+
+void *PageFrameAllocator::allocateContiguousBlocks(uint32_t count) {
+    auto order = BuddyMemoryManager::getOrder(count);
+    if (order > BuddyMemoryManager::MAX_ORDER) {
+        lock.acquire();
+        auto *frames = searchContiguousBlocks(count);
+        lock.release();
+
+        if (frames == nullptr) {
+            Util::Exception::throwException(Util::Exception::OUT_OF_PHYSICAL_MEMORY, "PageFrameAllocator: No contiguous page frames left!");
+        }
+
+        return frames;
+    }
+
+    lock.acquire();
+    auto *frames = buddyAllocator.allocateBlocks(order);
+    if (frames == nullptr) {
+        lock.release();
+        Util::Exception::throwException(Util::Exception::OUT_OF_PHYSICAL_MEMORY, "PageFrameAllocator: No contiguous page frames left!");
+    }
+
+    // Give back the frames, exceeding the requested amount
+    auto startAddress = reinterpret_cast<uint32_t>(frames);
+    for (uint32_t i = count; i < static_cast<uint32_t>(1) << order; i++) {
+        buddyAllocator.freeBlock(reinterpret_cast<void*>(startAddress + i * Kernel::Paging::PAGESIZE));
+    }
+
+    setMemory(startAddress, startAddress + count * Kernel::Paging::PAGESIZE - 1, 1, false);
+    lock.release();
+
+    return frames;
+}
+
+void *PageFrameAllocator::searchContiguousBlocks(uint32_t count) {
+    // A frame is free, if it is neither used nor reserved (the same condition, under which it is given back to the buddy allocator)
+    auto startAddress = getStartAddress();
+    auto frameCount = (getEndAddress() - startAddress) / Kernel::Paging::PAGESIZE + 1;
+    uint32_t runStart = 0;
+    uint32_t runLength = 0;
+
+    for (uint32_t i = 0; i < frameCount; i++) {
+        auto *frame = reinterpret_cast<void*>(startAddress + i * Kernel::Paging::PAGESIZE);
+        if (getUseCount(frame) != 0 || isReserved(frame)) {
+            runLength = 0;
+            continue;
+        }
+
+        if (runLength == 0) {
+            runStart = i;
+        }
+
+        if (++runLength == count) {
+            auto runAddress = startAddress + runStart * Kernel::Paging::PAGESIZE;
+            for (uint32_t j = 0; j < count; j++) {
+                buddyAllocator.reserveBlock(reinterpret_cast<void*>(runAddress + j * Kernel::Paging::PAGESIZE));
+            }
+
+            setMemory(runAddress, runAddress + count * Kernel::Paging::PAGESIZE - 1, 1, false);
+            return reinterpret_cast<void*>(runAddress);
+        }
+    }
+
+    return nullptr;
+}
+
+uint32_t PageFrameAllocator::getFreeRunCount(uint8_t order) const {
+    return buddyAllocator.getFreeRunCount(order);
+}
+
+uint32_t PageFrameAllocator::getFreeMemory() const {
+    return buddyAllocator.getFreeMemory();
+}
+
 }
\ No newline at end of file
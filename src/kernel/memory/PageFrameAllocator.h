@@ -21,6 +21,8 @@
 #include <cstdint>
 
 #include "TableMemoryManager.h"
+#include "BuddyMemoryManager.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Kernel {
 class PagingAreaManager;
@@ -53,6 +55,52 @@ public:
      * Destructor.
      */
      ~PageFrameAllocator() override = default;
+
+    /**
+     * Allocate a free page frame. The frame is taken from the buddy allocator and gets a use count of 1.
+     */
+    [[nodiscard]] void *allocateBlock() override;
+
+    /**
+     * Increment the use count of a specific page frame (e.g. for memory mapped IO).
+     * If the frame is still free, it is taken out of the buddy allocator first.
+     */
+    [[nodiscard]] void *allocateBlockAtAddress(void *address);
+
+    /**
+     * Decrement the use count of a page frame. Once it is not used anymore, it is given back to the buddy allocator.
+     */
+    void freeBlock(void *pointer) override;
+
+    /**
+     * Allocate physically contiguous page frames (e.g. for DMA buffers).
+     * The frames are freed one by one, using freeBlock().
+     * Requests larger than the buddy allocator's maximum order are served by searching for a free range frame by frame.
+     *
+     * @param count The amount of page frames
+     * @return The physical address of the first frame
+     */
+    [[nodiscard]] void *allocateContiguousBlocks(uint32_t count);
+
+    /**
+     * Get the amount of free runs of 2^order contiguous page frames.
+     */
+    [[nodiscard]] uint32_t getFreeRunCount(uint8_t order) const;
+
+    [[nodiscard]] uint32_t getFreeMemory() const override;
+
+private:
+
+    /**
+     * Allocate more contiguous page frames, than the buddy allocator can hand out at once (2^MAX_ORDER).
+     * The lock must be held by the caller.
+     *
+     * @return The physical address of the first frame, or nullptr if no free range is large enough
+     */
+    [[nodiscard]] void *searchContiguousBlocks(uint32_t count);
+
+    BuddyMemoryManager buddyAllocator;
+    Util::Async::Spinlock lock;
 };
 
 }
@@ -155,6 +155,36 @@ void TableMemoryManager::freeBlock(void *pointer) {
     allocationTableEntry.decrementUseCount();
 }
 
+uint16_t TableMemoryManager::getUseCount(void *pointer) const {
+    if (reinterpret_cast<uint32_t>(pointer) > endAddress) {
+        return 0;
+    }
+
+    const auto index = calculateIndex(reinterpret_cast<uint32_t>(pointer));
+    auto &referenceTableEntry = referenceTableArray[index.referenceTableArrayIndex][index.referenceTableIndex];
+    if (referenceTableEntry.getAddress() == 0) {
+        return 0;
+    }
+
+    auto *allocationTable = reinterpret_cast<AllocationTableEntry*>(referenceTableEntry.getAddress());
+    return allocationTable[index.allocationTableIndex].getUseCount();
+}
+
+bool TableMemoryManager::isReserved(void *pointer) const {
+    if (reinterpret_cast<uint32_t>(pointer) > endAddress) {
+        return false;
+    }
+
+    const auto index = calculateIndex(reinterpret_cast<uint32_t>(pointer));
+    auto &referenceTableEntry = referenceTableArray[index.referenceTableArrayIndex][index.referenceTableIndex];
+    if (referenceTableEntry.getAddress() == 0) {
+        return false;
+    }
+
+    auto *allocationTable = reinterpret_cast<AllocationTableEntry*>(referenceTableEntry.getAddress());
+    return allocationTable[index.allocationTableIndex].isReserved();
+}
+
 void *TableMemoryManager::allocateBlockAfterAddress(void *address) {
     auto startIndex = calculateIndex(reinterpret_cast<uint32_t>(address));
     auto endIndex = calculateIndex(endAddress);
@@ -61,6 +61,10 @@ public:
 
     void freeBlock(void *pointer) override;
 
+    [[nodiscard]] uint16_t getUseCount(void *pointer) const;
+
+    [[nodiscard]] bool isReserved(void *pointer) const;
+
     [[nodiscard]] uint32_t getTotalMemory() const override;
 
     [[nodiscard]] uint32_t getBlockSize() const override;
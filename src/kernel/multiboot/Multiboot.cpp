@@ -103,6 +103,35 @@ Util::String Multiboot::getKernelOption(const Util::String &key) {
     Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Multiboot: Requested kernel option is not available!");
 }
 
+bool Multiboot::hasEarlyKernelOption(const char *key, const char *value) {
+    if (!(info->flags & COMMAND_LINE)) {
+        return false;
+    }
+
+    auto keyLength = Util::Address<uint32_t>(key).stringLength();
+    auto valueLength = Util::Address<uint32_t>(value).stringLength();
+    auto *option = reinterpret_cast<const char*>(info->commandLine);
+
+    while (*option != '\0') {
+        auto optionAddress = Util::Address<uint32_t>(option);
+        auto optionEnd = optionAddress.searchCharacter(' ');
+        auto optionLength = optionEnd.get() == 0 ? optionAddress.stringLength() : optionEnd.get() - optionAddress.get();
+
+        if (optionLength == keyLength + 1 + valueLength && option[keyLength] == '=' &&
+                optionAddress.compareRange(Util::Address<uint32_t>(key), keyLength) == 0 &&
+                optionAddress.add(keyLength + 1).compareRange(Util::Address<uint32_t>(value), valueLength) == 0) {
+            return true;
+        }
+
+        option += optionLength;
+        while (*option == ' ') {
+            option++;
+        }
+    }
+
+    return false;
+}
+
 bool Multiboot::isModuleLoaded(const Util::String &module) {
     if (!(info->flags & MODULES)) {
         return false;
@@ -229,6 +229,16 @@ public:
 
     static Util::String getKernelOption(const Util::String &key);
 
+    /**
+     * Check if a kernel option has a given value, without allocating any memory.
+     * This is needed to evaluate options, before the kernel heap has been set up.
+     *
+     * @param key The name of the option
+     * @param value The expected value
+     * @return true, if the command line contains 'key=value'
+     */
+    static bool hasEarlyKernelOption(const char *key, const char *value);
+
     static bool isModuleLoaded(const Util::String &module);
 
     static ModuleInfo getModule(const Util::String &module);
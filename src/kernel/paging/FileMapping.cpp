@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "FileMapping.h"
+
+#include "kernel/file/OpenFile.h"
+#include "kernel/paging/SharedSegment.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/system/System.h"
+#include "kernel/paging/Paging.h"
+#include "filesystem/core/Node.h"
+#include "lib/util/base/Address.h"
+
+namespace Kernel {
+
+FileMapping::FileMapping(uint32_t startAddress, OpenFile &file, uint32_t offset, uint32_t length, Util::Io::File::MapMode mode) :
+        file(file), startAddress(startAddress), offset(offset), length(length), size(calculateSize(file, offset, length)), pageOffset(0), memoryStartAddress(0), mode(mode), fixed(false) {
+    auto *memoryAddress = file.getNode().getMemoryAddress();
+    if (memoryAddress != nullptr) {
+        auto dataAddress = reinterpret_cast<uint32_t>(memoryAddress) + offset;
+        pageOffset = dataAddress % Paging::PAGESIZE;
+        memoryStartAddress = dataAddress - pageOffset;
+    }
+
+    file.retain();
+}
+
+FileMapping::FileMapping(uint32_t startAddress, OpenFile &file, uint32_t offset, uint32_t length, uint32_t size, Util::Io::File::MapMode mode) :
+        file(file), startAddress(startAddress), offset(offset), length(length), size(size), pageOffset(0), memoryStartAddress(0), mode(mode), fixed(true) {
+    file.retain();
+}
+
+FileMapping::~FileMapping() {
+    if (sharedSegment != nullptr) {
+        System::getService<MemoryService>().releaseSharedSegment(*sharedSegment);
+    }
+
+    if (file.release()) {
+        delete &file;
+    }
+}
+
+uint32_t FileMapping::calculateSize(OpenFile &file, uint32_t offset, uint32_t length) {
+    auto *memoryAddress = file.getNode().getMemoryAddress();
+    auto pageOffset = memoryAddress == nullptr ? 0 : (reinterpret_cast<uint32_t>(memoryAddress) + offset) % Paging::PAGESIZE;
+
+    return Util::Address<uint32_t>(pageOffset + length).alignUp(Paging::PAGESIZE).get();
+}
+
+bool FileMapping::contains(uint32_t address) const {
+    return address >= startAddress && address - startAddress < getSize();
+}
+
+uint32_t FileMapping::getStartAddress() const {
+    return startAddress;
+}
+
+uint32_t FileMapping::getSize() const {
+    return size;
+}
+
+uint32_t FileMapping::getMappedAddress() const {
+    return startAddress + pageOffset;
+}
+
+Util::Io::File::MapMode FileMapping::getMode() const {
+    return mode;
+}
+
+bool FileMapping::isZeroCopy() const {
+    return memoryStartAddress != 0;
+}
+
+bool FileMapping::isFixed() const {
+    return fixed;
+}
+
+SharedSegment* FileMapping::getSharedSegment() const {
+    return sharedSegment;
+}
+
+void FileMapping::setSharedSegment(SharedSegment &segment) {
+    sharedSegment = &segment;
+}
+
+uint32_t FileMapping::getMemoryPage(uint32_t pageAddress) const {
+    return memoryStartAddress + (pageAddress - startAddress);
+}
+
+void FileMapping::loadPage(uint32_t pageAddress) {
+    auto page = Util::Address<uint32_t>(pageAddress);
+    auto mappedOffset = pageAddress - startAddress;
+    if (mappedOffset >= length) {
+        // Page lies completely behind the file range (e.g. uninitialized data of a program)
+        page.setRange(0, Paging::PAGESIZE);
+        return;
+    }
+
+    auto count = length - mappedOffset > Paging::PAGESIZE ? Paging::PAGESIZE : length - mappedOffset;
+    auto read = static_cast<uint32_t>(file.readAt(reinterpret_cast<uint8_t*>(pageAddress), offset + mappedOffset, count));
+    page.add(read).setRange(0, Paging::PAGESIZE - read);
+}
+
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_FILEMAPPING_H
+#define HHUOS_FILEMAPPING_H
+
+#include <cstdint>
+
+#include "lib/util/io/file/File.h"
+
+namespace Kernel {
+class OpenFile;
+class SharedSegment;
+
+/**
+ * A file range, that is mapped into a virtual address space. Pages are populated on demand by the page fault handler.
+ * If the file's data resides in memory (e.g. inside the initial ramdisk), its pages are mapped directly instead of being copied.
+ * In this case, the data does not need to start at a page boundary, so the first and last page may also contain
+ * neighbouring bytes of the underlying memory and the mapped address is offset into the first page.
+ */
+class FileMapping {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param startAddress The page aligned virtual start address
+     * @param file The mapped file (the mapping holds a reference until it is deleted)
+     * @param offset The file offset of the first mapped byte
+     * @param length The amount of mapped bytes
+     * @param mode Whether the mapping is read-only or copy-on-write
+     */
+    FileMapping(uint32_t startAddress, OpenFile &file, uint32_t offset, uint32_t length, Util::Io::File::MapMode mode);
+
+    /**
+     * Constructor for mappings at a fixed address (e.g. program segments).
+     * The file data always gets copied, since its first byte must reside exactly at the start address.
+     * Memory behind the file range is zero filled.
+     *
+     * @param startAddress The page aligned virtual start address
+     * @param file The mapped file (the mapping holds a reference until it is deleted)
+     * @param offset The file offset of the first mapped byte
+     * @param length The amount of mapped bytes
+     * @param size The page aligned size of the mapping (at least length)
+     * @param mode Whether the mapping is read-only or copy-on-write
+     */
+    FileMapping(uint32_t startAddress, OpenFile &file, uint32_t offset, uint32_t length, uint32_t size, Util::Io::File::MapMode mode);
+
+    /**
+     * Copy Constructor.
+     */
+    FileMapping(const FileMapping &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    FileMapping &operator=(const FileMapping &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~FileMapping();
+
+    /**
+     * Calculate the amount of virtual memory, needed to map a file range.
+     */
+    [[nodiscard]] static uint32_t calculateSize(OpenFile &file, uint32_t offset, uint32_t length);
+
+    [[nodiscard]] bool contains(uint32_t address) const;
+
+    [[nodiscard]] uint32_t getStartAddress() const;
+
+    [[nodiscard]] uint32_t getSize() const;
+
+    /**
+     * Get the address of the first mapped byte, as seen by the process.
+     */
+    [[nodiscard]] uint32_t getMappedAddress() const;
+
+    [[nodiscard]] Util::Io::File::MapMode getMode() const;
+
+    /**
+     * Check, if the pages of this mapping are taken directly from the file's memory.
+     */
+    [[nodiscard]] bool isZeroCopy() const;
+
+    /**
+     * Check, if this mapping has been created at a fixed address, instead of being reserved in the user heap.
+     */
+    [[nodiscard]] bool isFixed() const;
+
+    /**
+     * Get the segment, whose page frames are shared with other processes (or nullptr for private pages).
+     */
+    [[nodiscard]] SharedSegment* getSharedSegment() const;
+
+    /**
+     * Share the pages of this mapping. The mapping takes over a reference on the segment.
+     */
+    void setSharedSegment(SharedSegment &segment);
+
+    /**
+     * Get the (kernel) address of the memory page, which backs a page of a zero copy mapping.
+     */
+    [[nodiscard]] uint32_t getMemoryPage(uint32_t pageAddress) const;
+
+    /**
+     * Fill a mapped page with the corresponding file data. Bytes behind the file range are zeroed.
+     * The page must already be mapped writable for the kernel.
+     */
+    void loadPage(uint32_t pageAddress);
+
+private:
+
+    OpenFile &file;
+    uint32_t startAddress;
+    uint32_t offset;
+    uint32_t length;
+    uint32_t size;
+    uint32_t pageOffset;
+    uint32_t memoryStartAddress;
+    Util::Io::File::MapMode mode;
+    bool fixed;
+    SharedSegment *sharedSegment = nullptr;
+};
+
+}
+
+#endif
@@ -210,6 +210,18 @@ void *PageDirectory::getPhysicalAddress(void *virtualAddress) {
     return reinterpret_cast<void*>(physAddress);
 }
 
+uint32_t PageDirectory::getPageFlags(uint32_t virtualAddress) {
+    uint32_t pageDirectoryIndex = Paging::GET_PD_IDX(virtualAddress);
+    uint32_t pageTableIndex = Paging::GET_PT_IDX(virtualAddress);
+
+    if ((pageDirectory[pageDirectoryIndex] & Paging::PRESENT) == 0) {
+        return 0;
+    }
+
+    auto entry = *(reinterpret_cast<uint32_t*>(virtualTableAddresses[pageDirectoryIndex]) + pageTableIndex);
+    return (entry & Paging::PRESENT) == 0 ? 0 : entry & 0x00000FFF;
+}
+
 void PageDirectory::setPageFlags(uint32_t virtualStartAddress, uint32_t flags) {
     // Align address to 4 KiB
     uint32_t alignedAddress = virtualStartAddress & 0xFFFFF000;
@@ -95,6 +95,15 @@ public:
      */
     void createTable(uint32_t index, uint32_t physicalAddress, uint32_t virtualAddress, uint32_t flags);
 
+    /**
+     * Get the flags of a mapped page.
+     *
+     * @param virtualAddress Virtual address inside the page
+     *
+     * @return The flags of the page table entry (or 0, if the page is not mapped)
+     */
+    uint32_t getPageFlags(uint32_t virtualAddress);
+
     /**
      * Protects a given page from unmapping.
      *
@@ -47,7 +47,8 @@ public:
         GLOBAL = 0x100,
 
         // User defined flags
-        DO_NOT_UNMAP = 0x200
+        DO_NOT_UNMAP = 0x200,
+        COPY_ON_WRITE = 0x400
     };
 
     /**
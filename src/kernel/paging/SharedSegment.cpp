@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SharedSegment.h"
+
+#include "kernel/paging/Paging.h"
+#include "lib/util/async/Atomic.h"
+
+namespace Kernel {
+
+SharedSegment::SharedSegment(const Util::String &path, uint32_t offset, uint32_t length, uint32_t size) :
+        path(path), offset(offset), length(length), size(size), frames(size / Paging::PAGESIZE) {
+    for (auto &frame : frames) {
+        frame = 0;
+    }
+}
+
+bool SharedSegment::matches(const Util::String &path, uint32_t offset, uint32_t length, uint32_t size) const {
+    return SharedSegment::offset == offset && SharedSegment::length == length && SharedSegment::size == size && SharedSegment::path == path;
+}
+
+const Util::String& SharedSegment::getPath() const {
+    return path;
+}
+
+uint32_t SharedSegment::getFrame(uint32_t index) {
+    lock.acquire();
+    return lock.releaseAndReturn<uint32_t>(frames[index]);
+}
+
+bool SharedSegment::setFrame(uint32_t index, uint32_t physicalAddress) {
+    lock.acquire();
+    if (frames[index] != 0) {
+        return lock.releaseAndReturn<bool>(false);
+    }
+
+    frames[index] = physicalAddress;
+    return lock.releaseAndReturn<bool>(true);
+}
+
+const Util::Array<uint32_t>& SharedSegment::getFrames() const {
+    return frames;
+}
+
+void SharedSegment::retain() {
+    Util::Async::Atomic<uint32_t>(references).inc();
+}
+
+bool SharedSegment::release() {
+    return Util::Async::Atomic<uint32_t>(references).dec() == 1;
+}
+
+}
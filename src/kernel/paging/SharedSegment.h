@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SHAREDSEGMENT_H
+#define HHUOS_SHAREDSEGMENT_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/base/String.h"
+#include "lib/util/collection/Array.h"
+
+namespace Kernel {
+
+/**
+ * Page frames of a program segment, which are shared between all processes running the same binary.
+ * A frame is loaded by the first process touching the corresponding page and is then mapped by all others.
+ * The segment holds its own reference on each loaded frame, which is given back by the memory service,
+ * once the last mapping using the segment has been removed.
+ * When the binary is written to or deleted, its segments are invalidated, so that they are not shared with new processes anymore.
+ */
+class SharedSegment {
+
+public:
+    /**
+     * Constructor. The segment starts with a single reference.
+     *
+     * @param path The path of the binary
+     * @param offset The file offset of the first mapped byte
+     * @param length The amount of bytes mapped from the file
+     * @param size The page aligned size of the segment
+     */
+    SharedSegment(const Util::String &path, uint32_t offset, uint32_t length, uint32_t size);
+
+    /**
+     * Copy Constructor.
+     */
+    SharedSegment(const SharedSegment &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SharedSegment &operator=(const SharedSegment &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SharedSegment() = default;
+
+    [[nodiscard]] bool matches(const Util::String &path, uint32_t offset, uint32_t length, uint32_t size) const;
+
+    [[nodiscard]] const Util::String& getPath() const;
+
+    /**
+     * Get the physical address of a loaded page.
+     *
+     * @param index The index of the page inside the segment
+     * @return The physical address, or 0 if the page has not been loaded yet
+     */
+    [[nodiscard]] uint32_t getFrame(uint32_t index);
+
+    /**
+     * Publish a loaded page.
+     *
+     * @return false, if another process has published the page in the meantime
+     */
+    bool setFrame(uint32_t index, uint32_t physicalAddress);
+
+    /**
+     * Get the physical addresses of all pages (0 for pages, which have not been loaded).
+     */
+    [[nodiscard]] const Util::Array<uint32_t>& getFrames() const;
+
+    void retain();
+
+    /**
+     * Remove a reference.
+     *
+     * @return true, if this was the last reference and the segment should be deleted
+     */
+    bool release();
+
+private:
+
+    Util::String path;
+    uint32_t offset;
+    uint32_t length;
+    uint32_t size;
+
+    Util::Array<uint32_t> frames;
+    uint32_t references = 1;
+    Util::Async::Spinlock lock;
+};
+
+}
+
+#endif
@@ -18,7 +18,8 @@
 #include "VirtualAddressSpace.h"
 #include "lib/util/base/Constants.h"
 #include "kernel/paging/PageDirectory.h"
-#include "lib/util/base/FreeListMemoryManager.h"
+#include "kernel/paging/FileMapping.h"
+#include "lib/util/base/HeapMemoryManager.h"
 
 namespace Util {
 
@@ -33,12 +34,16 @@ VirtualAddressSpace::VirtualAddressSpace(Util::HeapMemoryManager &kernelHeapMemo
 }
 
 VirtualAddressSpace::VirtualAddressSpace(PageDirectory &basePageDirectory) :
-        memoryManager(reinterpret_cast<Util::FreeListMemoryManager*>(Util::USER_SPACE_MEMORY_MANAGER_ADDRESS)), kernelAddressSpace(false) {
+        memoryManager(reinterpret_cast<Util::HeapMemoryManager*>(Util::USER_SPACE_MEMORY_MANAGER_ADDRESS)), kernelAddressSpace(false) {
     // Initialize a new memory abstraction through paging
     this->pageDirectory = new PageDirectory(basePageDirectory);
 }
 
 VirtualAddressSpace::~VirtualAddressSpace() {
+    for (auto *mapping : fileMappings) {
+        delete mapping;
+    }
+
     delete pageDirectory;
 }
 
@@ -54,4 +59,33 @@ bool VirtualAddressSpace::isKernelAddressSpace() const {
     return kernelAddressSpace;
 }
 
+void VirtualAddressSpace::addFileMapping(FileMapping *mapping) {
+    fileMappingLock.acquire();
+    fileMappings.add(mapping);
+    fileMappingLock.release();
+}
+
+FileMapping* VirtualAddressSpace::findFileMapping(uint32_t address) {
+    fileMappingLock.acquire();
+    for (auto *mapping : fileMappings) {
+        if (mapping->contains(address)) {
+            return fileMappingLock.releaseAndReturn(mapping);
+        }
+    }
+
+    return fileMappingLock.releaseAndReturn<FileMapping*>(nullptr);
+}
+
+FileMapping* VirtualAddressSpace::removeFileMapping(uint32_t mappedAddress) {
+    fileMappingLock.acquire();
+    for (auto *mapping : fileMappings) {
+        if (mapping->getMappedAddress() == mappedAddress) {
+            fileMappings.remove(mapping);
+            return fileMappingLock.releaseAndReturn(mapping);
+        }
+    }
+
+    return fileMappingLock.releaseAndReturn<FileMapping*>(nullptr);
+}
+
 }
\ No newline at end of file
@@ -18,6 +18,11 @@
 #ifndef __VIRTUALADDRESSSPACE__
 #define __VIRTUALADDRESSSPACE__
 
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/collection/ArrayList.h"
+
 namespace Util {
 
 class HeapMemoryManager;
@@ -26,6 +31,7 @@ class HeapMemoryManager;
 
 namespace Kernel {
 class PageDirectory;
+class FileMapping;
 
 /**
  * VirtualAddressSpace - represents a virtual address space with corresponding page directory
@@ -64,12 +70,36 @@ public:
 
     [[nodiscard]] bool isKernelAddressSpace() const;
 
+    /**
+     * Register a file mapping. The address space takes ownership of the mapping.
+     */
+    void addFileMapping(FileMapping *mapping);
+
+    /**
+     * Get the file mapping, that contains a given virtual address.
+     *
+     * @return The mapping (or nullptr, if the address is not part of a file mapping)
+     */
+    [[nodiscard]] FileMapping* findFileMapping(uint32_t address);
+
+    /**
+     * Remove the file mapping, that has been mapped at a given address. Ownership is transferred back to the caller.
+     *
+     * @param mappedAddress The address, that has been returned when the file was mapped
+     *
+     * @return The mapping (or nullptr, if no mapping has been mapped at the given address)
+     */
+    FileMapping* removeFileMapping(uint32_t mappedAddress);
+
 private:
 
     PageDirectory *pageDirectory;
     Util::HeapMemoryManager *memoryManager;
 
     bool kernelAddressSpace;
+
+    Util::ArrayList<FileMapping*> fileMappings;
+    Util::Async::Spinlock fileMappingLock;
 };
 
 }
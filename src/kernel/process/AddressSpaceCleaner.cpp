@@ -32,6 +32,8 @@ void AddressSpaceCleaner::run() {
         schedulerService.yield();
     }
 
+    // Closing the files first releases e.g. pipe ends, so that other processes are not blocked forever
+    currentProcess.getFileDescriptorManager().closeAll();
     System::getService<MemoryService>().unmap(0, 0xbfffffff, 0);
     schedulerService.cleanup(&currentProcess);
 }
@@ -28,15 +28,28 @@
 #include "kernel/process/Process.h"
 #include "kernel/process/Thread.h"
 #include "kernel/service/SchedulerService.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/service/FilesystemService.h"
+#include "kernel/service/TimeService.h"
+#include "kernel/file/OpenFile.h"
+#include "kernel/multiboot/Multiboot.h"
+#include "filesystem/core/Filesystem.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/base/Address.h"
+#include "lib/util/time/Timestamp.h"
 
 namespace Kernel {
 
 BinaryLoader::BinaryLoader(const Util::String &path, const Util::String &command, const Util::Array<Util::String> &arguments) :
-        path(path), command(command), arguments(arguments) {}
+        path(path), command(command), arguments(arguments), lazy(isLazyLoadingEnabled()) {}
+
+BinaryLoader::BinaryLoader(const Util::String &path, bool lazy, BenchmarkResult &result) :
+        path(path), command(path), arguments(0), lazy(lazy), benchmarkResult(&result) {}
 
 void BinaryLoader::run() {
+    auto &timeService = System::getService<TimeService>();
+    auto startTime = timeService.getSystemTime().toMicroseconds();
+
     auto file = Util::Io::File(path);
     if (!file.exists()) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "BinaryLoader: File not found!");
@@ -46,16 +59,15 @@ void BinaryLoader::run() {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "BinaryLoader: Not a file!");
     }
 
-    auto *buffer = new uint8_t[file.getLength()];
-    auto binaryStream = Util::Io::FileInputStream(file);
-    binaryStream.read(buffer, 0, file.getLength());
-
-    // buffer is automatically deleted by file destructor
-    auto executable = Util::Io::Elf::File(buffer);
-    executable.loadProgram();
+    uint32_t entryPoint = 0;
+    uint32_t endAddress = 0;
+    if (!lazy || !mapProgram(entryPoint, endAddress)) {
+        entryPoint = loadProgram(file, endAddress);
+    }
 
+    // Arguments are placed on the first page behind the program, so that setting them up does not populate any segment page
     uint32_t argc = arguments.length() + 1;
-    char **argv = reinterpret_cast<char**>(executable.getEndAddress() + 1);
+    char **argv = reinterpret_cast<char**>(Util::Address<uint32_t>(endAddress).alignUp(Kernel::Paging::PAGESIZE).get());
     auto currentAddress = reinterpret_cast<uint32_t>(argv) + sizeof(char**) * argc;
 
     for (uint32_t i = 0; i < argc; i++) {
@@ -68,13 +80,107 @@ void BinaryLoader::run() {
     }
 
     auto &processService = System::getService<ProcessService>();
+    if (benchmarkResult != nullptr) {
+        // Fetch the first instruction, which populates the entry page for lazily loaded programs
+        static_cast<void>(*reinterpret_cast<volatile uint8_t*>(entryPoint));
+
+        benchmarkResult->time = timeService.getSystemTime().toMicroseconds() - startTime;
+        benchmarkResult->finished = true;
+        processService.exitCurrentProcess(0);
+    }
+
     auto &schedulerService = System::getService<SchedulerService>();
     auto &process = processService.getCurrentProcess();
     auto heapAddress = Util::Address(currentAddress + 1).alignUp(Kernel::Paging::PAGESIZE).get();
-    auto &userThread = Thread::createMainUserThread(file.getName(), process, (uint32_t) executable.getEntryPoint(), argc, argv, nullptr, heapAddress);
+    auto &userThread = Thread::createMainUserThread(file.getName(), process, entryPoint, argc, argv, nullptr, heapAddress, System::getHeapMemoryManagerType());
 
     processService.getCurrentProcess().setMainThread(userThread);
     schedulerService.ready(userThread);
 }
 
+bool BinaryLoader::isLazyLoadingEnabled() {
+    return !Multiboot::hasKernelOption("eager_loading") || Multiboot::getKernelOption("eager_loading") != "true";
+}
+
+uint32_t BinaryLoader::loadProgram(Util::Io::File &file, uint32_t &endAddress) {
+    auto *buffer = new uint8_t[file.getLength()];
+    auto binaryStream = Util::Io::FileInputStream(file);
+    binaryStream.read(buffer, 0, file.getLength());
+
+    // buffer is automatically deleted by file destructor
+    auto executable = Util::Io::Elf::File(buffer);
+    executable.loadProgram();
+
+    endAddress = executable.getEndAddress();
+    return reinterpret_cast<uint32_t>(executable.getEntryPoint());
+}
+
+bool BinaryLoader::mapProgram(uint32_t &entryPoint, uint32_t &endAddress) {
+    auto *node = System::getService<FilesystemService>().getFilesystem().getNode(path);
+    if (node == nullptr) {
+        return false;
+    }
+
+    // The loader holds one reference, while the mappings are created. Each mapping holds its own reference.
+    auto *file = new OpenFile(node);
+    auto fileHeader = Util::Io::Elf::FileHeader{};
+    if (file->readAt(reinterpret_cast<uint8_t*>(&fileHeader), 0, sizeof(fileHeader)) != sizeof(fileHeader) ||
+            !fileHeader.isValid() || fileHeader.programHeaderEntrySize < sizeof(Util::Io::Elf::ProgramHeader)) {
+        delete file;
+        return false;
+    }
+
+    // Loadable segments are sorted by their virtual address. Each page must belong to exactly one segment.
+    auto programHeaders = Util::Array<Util::Io::Elf::ProgramHeader>(fileHeader.programHeaderEntries);
+    uint32_t previousEndAddress = 0;
+    for (uint32_t i = 0; i < fileHeader.programHeaderEntries; i++) {
+        auto &header = programHeaders[i];
+        auto headerOffset = fileHeader.programHeader + i * fileHeader.programHeaderEntrySize;
+        if (file->readAt(reinterpret_cast<uint8_t*>(&header), headerOffset, sizeof(header)) != sizeof(header)) {
+            delete file;
+            return false;
+        }
+
+        if (header.type != Util::Io::Elf::ProgramHeaderType::LOAD) {
+            continue;
+        }
+
+        auto pageOffset = header.virtualAddress % Paging::PAGESIZE;
+        if (header.memorySize < header.fileSize || header.offset < pageOffset || header.virtualAddress - pageOffset < previousEndAddress) {
+            delete file;
+            return false;
+        }
+
+        previousEndAddress = Util::Address<uint32_t>(header.virtualAddress + header.memorySize).alignUp(Paging::PAGESIZE).get();
+    }
+
+    auto &memoryService = System::getService<MemoryService>();
+    endAddress = 0;
+    for (const auto &header : programHeaders) {
+        if (header.type != Util::Io::Elf::ProgramHeaderType::LOAD || header.memorySize == 0) {
+            continue;
+        }
+
+        // Map from the start of the first page, so that the segment data is located at its virtual address.
+        // Pages are shared with other processes running the same binary (writable ones until they are written to).
+        auto pageOffset = header.virtualAddress % Paging::PAGESIZE;
+        auto writable = (header.flags & static_cast<uint32_t>(Util::Io::Elf::ProgramHeaderFlag::WRITABLE)) != 0;
+        if (!memoryService.mapFileAt(header.virtualAddress - pageOffset, *file, header.offset - pageOffset, header.fileSize + pageOffset,
+                                     header.memorySize + pageOffset, writable ? Util::Io::File::COPY_ON_WRITE : Util::Io::File::READ_ONLY, path)) {
+            Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "BinaryLoader: Failed to map program segment!");
+        }
+
+        if (header.virtualAddress + header.memorySize > endAddress) {
+            endAddress = header.virtualAddress + header.memorySize;
+        }
+    }
+
+    if (file->release()) {
+        delete file;
+    }
+
+    entryPoint = fileHeader.entry;
+    return true;
+}
+
 }
\ No newline at end of file
@@ -18,20 +18,48 @@
 #ifndef HHUOS_BINARYLOADER_H
 #define HHUOS_BINARYLOADER_H
 
+#include <cstdint>
+
 #include "lib/util/async/Runnable.h"
 #include "lib/util/base/String.h"
 #include "lib/util/collection/Array.h"
 
+namespace Util {
+namespace Io {
+class File;
+}  // namespace Io
+}  // namespace Util
+
 namespace Kernel {
 
+/**
+ * Loads an executable into the address space of the current process and starts its main thread.
+ * By default, loadable segments are not copied up front. Instead, they are registered as file mappings
+ * and each page is populated from the file (or zero filled for uninitialized data) on first access.
+ * Booting with 'eager_loading=true' reads and copies the whole binary before starting it.
+ */
 class BinaryLoader : public Util::Async::Runnable {
 
 public:
+    /**
+     * Filled in by a loader, created for benchmarking.
+     */
+    struct BenchmarkResult {
+        uint32_t time;
+        volatile bool finished;
+    };
+
     /**
      * Default Constructor.
      */
     explicit BinaryLoader(const Util::String &path, const Util::String &command, const Util::Array<Util::String> &arguments);
 
+    /**
+     * Constructor for benchmarking. Instead of starting the main thread, the loader touches the entry point
+     * (as the first instruction would do), stores the time elapsed since it started and exits the process.
+     */
+    BinaryLoader(const Util::String &path, bool lazy, BenchmarkResult &result);
+
     /**
      * Copy Constructor.
      */
@@ -49,11 +77,32 @@ public:
 
     void run() override;
 
+    /**
+     * Check, if segments are loaded on demand (default) or copied completely before starting a program.
+     */
+    [[nodiscard]] static bool isLazyLoadingEnabled();
+
 private:
 
+    /**
+     * Read the whole binary and copy all loadable segments into memory.
+     *
+     * @return The entry point
+     */
+    uint32_t loadProgram(Util::Io::File &file, uint32_t &endAddress);
+
+    /**
+     * Read only the ELF headers and register a file mapping for each loadable segment.
+     *
+     * @return true on success; false, if the segments cannot be mapped page-wise (e.g. because two segments share a page)
+     */
+    bool mapProgram(uint32_t &entryPoint, uint32_t &endAddress);
+
     const Util::String path;
     const Util::String command;
     const Util::Array<Util::String> arguments;
+    const bool lazy;
+    BenchmarkResult *benchmarkResult = nullptr;
 };
 
 }
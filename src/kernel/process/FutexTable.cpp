@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include "FutexTable.h"
+
+#include "kernel/system/System.h"
+#include "kernel/service/MemoryService.h"
+
+namespace Kernel {
+
+bool FutexTable::wait(uint32_t *address, uint32_t expectedValue) {
+    // Read the value once before getting its physical address, so that the page is guaranteed to be mapped
+    if (*reinterpret_cast<volatile uint32_t*>(address) != expectedValue) {
+        return false;
+    }
+
+    auto key = getKey(address);
+    auto &futex = *acquireFutex(key, true);
+
+    futex.queue.lock();
+    if (*reinterpret_cast<volatile uint32_t*>(address) != expectedValue) {
+        futex.queue.unlock();
+        releaseFutex(key, futex);
+        return false;
+    }
+
+    futex.queue.waitAndUnlock();
+    releaseFutex(key, futex);
+    return true;
+}
+
+uint32_t FutexTable::wake(uint32_t *address, uint32_t count) {
+    auto key = getKey(address);
+    auto *futex = acquireFutex(key, false);
+    if (futex == nullptr) {
+        // Nobody is waiting
+        return 0;
+    }
+
+    auto woken = futex->queue.wake(count);
+    releaseFutex(key, *futex);
+
+    return woken;
+}
+
+bool FutexTable::cancelWait(Thread &thread) {
+    tableLock.acquire();
+
+    for (const auto key : futexes.keys()) {
+        auto *futex = futexes.get(key);
+        if (futex->queue.remove(thread)) {
+            futex->users--;
+            if (futex->users == 0 && futex->queue.isEmpty()) {
+                futexes.remove(key);
+                delete futex;
+            }
+
+            tableLock.release();
+            return true;
+        }
+    }
+
+    tableLock.release();
+    return false;
+}
+
+FutexTable::Futex* FutexTable::acquireFutex(uint32_t key, bool create) {
+    tableLock.acquire();
+
+    Futex *futex = nullptr;
+    if (futexes.containsKey(key)) {
+        futex = futexes.get(key);
+    } else if (create) {
+        futex = new Futex();
+        futexes.put(key, futex);
+    }
+
+    if (futex != nullptr) {
+        futex->users++;
+    }
+
+    tableLock.release();
+    return futex;
+}
+
+void FutexTable::releaseFutex(uint32_t key, Futex &futex) {
+    tableLock.acquire();
+    futex.users--;
+
+    if (futex.users == 0 && futex.queue.isEmpty()) {
+        futexes.remove(key);
+        delete &futex;
+    }
+
+    tableLock.release();
+}
+
+uint32_t FutexTable::getKey(uint32_t *address) {
+    return reinterpret_cast<uint32_t>(System::getService<MemoryService>().getPhysicalAddress(address));
+}
+
+}
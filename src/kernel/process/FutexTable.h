@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_FUTEXTABLE_H
+#define HHUOS_FUTEXTABLE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/collection/HashMap.h"
+#include "kernel/process/WaitQueue.h"
+
+namespace Kernel {
+
+/**
+ * Wait queues for futexes (fast user space mutexes).
+ * A futex is an ordinary 32-bit integer. Locks in user space manipulate it with atomic instructions
+ * and only need the kernel to put a thread to sleep, if the lock is contended, or to wake up sleeping threads.
+ * Futexes are identified by their physical address, so that they work across address spaces (e.g. in shared memory).
+ * A wait queue only exists, while threads are using the futex.
+ */
+class FutexTable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    FutexTable() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    FutexTable(const FutexTable &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    FutexTable &operator=(const FutexTable &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~FutexTable() = default;
+
+    /**
+     * Block the current thread, if the futex still contains the expected value.
+     * The check is atomic with respect to wake(), so a wakeup cannot get lost.
+     *
+     * @return false, if the futex value has changed and the thread has not been blocked
+     */
+    bool wait(uint32_t *address, uint32_t expectedValue);
+
+    /**
+     * Wake up threads, which are waiting on the futex.
+     *
+     * @return The amount of threads, that have been woken up
+     */
+    uint32_t wake(uint32_t *address, uint32_t count);
+
+    /**
+     * Remove a thread, which is blocked on a futex, from its wait queue (e.g. because it is killed).
+     * The thread never returns from wait(), so its reference on the futex is released here.
+     *
+     * @return true, if the thread has been waiting on a futex
+     */
+    bool cancelWait(Thread &thread);
+
+private:
+
+    struct Futex {
+        WaitQueue queue;
+        uint32_t users = 0;
+    };
+
+    /**
+     * Get the futex with the given key and register as one of its users, so that it is not deleted in the meantime.
+     *
+     * @param create Create the futex, if it does not exist yet
+     * @return The futex, or nullptr if it does not exist and create is false
+     */
+    Futex* acquireFutex(uint32_t key, bool create);
+
+    void releaseFutex(uint32_t key, Futex &futex);
+
+    static uint32_t getKey(uint32_t *address);
+
+    Util::Async::Spinlock tableLock;
+    Util::HashMap<uint32_t, Futex*> futexes;
+};
+
+}
+
+#endif
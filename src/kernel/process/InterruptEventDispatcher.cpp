@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "InterruptEventDispatcher.h"
+
+#include "kernel/process/Scheduler.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/service/TimeService.h"
+#include "kernel/system/System.h"
+#include "lib/util/async/InterruptEvent.h"
+#include "lib/util/async/Thread.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Kernel {
+
+void InterruptEventDispatcher::run() {
+    while (true) {
+        dispatchEvents();
+        auto sleepTime = checkDeadlines();
+
+        // The scheduler cuts this sleep short, as soon as an interrupt handler queues an event
+        Util::Async::Thread::sleep(Util::Time::Timestamp::ofMilliseconds(sleepTime));
+    }
+}
+
+void InterruptEventDispatcher::dispatchEvents() {
+    auto &schedulerService = System::getService<SchedulerService>();
+    auto *event = schedulerService.takeInterruptEvents();
+    while (event != nullptr) {
+        // Once dispatched, the event may be queued again, which overwrites its link
+        auto *next = event->next;
+        event->dispatch();
+
+        uint32_t deadline;
+        if (event->getDeadline(deadline) && !timedEvents.contains(event)) {
+            timedEvents.add(event);
+        }
+
+        event = next;
+    }
+}
+
+uint32_t InterruptEventDispatcher::checkDeadlines() {
+    auto systemTime = System::getService<TimeService>().getSystemTime().toMilliseconds();
+    auto sleepTime = IDLE_INTERVAL;
+
+    for (uint32_t i = timedEvents.size(); i > 0; i--) {
+        auto *event = timedEvents.get(i - 1);
+        uint32_t deadline;
+        if (!event->getDeadline(deadline)) {
+            timedEvents.removeIndex(i - 1);
+        } else if (systemTime >= deadline) {
+            // The waiter may not have been blocked yet -> Keep waking it up, until it has noticed the timeout
+            event->wakeUp();
+            sleepTime = 1;
+        } else if (deadline - systemTime < sleepTime) {
+            sleepTime = deadline - systemTime;
+        }
+    }
+
+    return sleepTime;
+}
+
+}
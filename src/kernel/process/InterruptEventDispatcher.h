@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_INTERRUPTEVENTDISPATCHER_H
+#define HHUOS_INTERRUPTEVENTDISPATCHER_H
+
+#include <cstdint>
+
+#include "lib/util/async/Runnable.h"
+#include "lib/util/collection/ArrayList.h"
+
+namespace Util {
+namespace Async {
+class InterruptEvent;
+}  // namespace Async
+}  // namespace Util
+
+namespace Kernel {
+
+/**
+ * Wakes up threads waiting for events, which have been signaled by interrupt handlers (see Util::Async::InterruptEvent).
+ * Runs in its own kernel thread, which the scheduler wakes up as soon as events are queued.
+ * It also wakes up threads, whose timed wait for an event has expired.
+ */
+class InterruptEventDispatcher : public Util::Async::Runnable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    InterruptEventDispatcher() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    InterruptEventDispatcher(const InterruptEventDispatcher &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    InterruptEventDispatcher &operator=(const InterruptEventDispatcher &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~InterruptEventDispatcher() override = default;
+
+    void run() override;
+
+private:
+
+    void dispatchEvents();
+
+    /**
+     * Wake up the waiters of all events, whose timed wait has expired, and forget events without a pending timed wait.
+     *
+     * @return The time (in milliseconds) until the next timed wait expires
+     */
+    uint32_t checkDeadlines();
+
+    Util::ArrayList<Util::Async::InterruptEvent*> timedEvents;
+
+    static const constexpr uint32_t IDLE_INTERVAL = 1000;
+};
+
+}
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include "PriorityThreadQueue.h"
+
+#include "kernel/process/Thread.h"
+
+namespace Kernel {
+
+void PriorityThreadQueue::offer(Thread *thread) {
+    levels[getLevel(*thread)].offer(thread);
+}
+
+Thread* PriorityThreadQueue::poll() {
+    if (++pollCount % STARVATION_INTERVAL == 0) {
+        for (auto &level : levels) {
+            if (!level.isEmpty()) {
+                return level.poll();
+            }
+        }
+
+        return nullptr;
+    }
+
+    for (uint32_t i = PRIORITY_LEVELS; i > 0; i--) {
+        auto &level = levels[i - 1];
+        if (!level.isEmpty()) {
+            return level.poll();
+        }
+    }
+
+    return nullptr;
+}
+
+Thread* PriorityThreadQueue::peek() {
+    for (uint32_t i = PRIORITY_LEVELS; i > 0; i--) {
+        auto &level = levels[i - 1];
+        if (!level.isEmpty()) {
+            return level.peek();
+        }
+    }
+
+    return nullptr;
+}
+
+bool PriorityThreadQueue::remove(Thread *thread) {
+    // The priority may have changed since the thread has been queued, so every level is searched
+    for (auto &level : levels) {
+        if (level.remove(thread)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool PriorityThreadQueue::contains(Thread *thread) const {
+    for (const auto &level : levels) {
+        if (level.contains(thread)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Thread* PriorityThreadQueue::getThread(uint32_t id) const {
+    for (const auto &level : levels) {
+        for (auto *thread : level) {
+            if (thread->getId() == id) {
+                return thread;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+bool PriorityThreadQueue::isEmpty() const {
+    for (const auto &level : levels) {
+        if (!level.isEmpty()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint32_t PriorityThreadQueue::size() const {
+    uint32_t size = 0;
+    for (const auto &level : levels) {
+        size += level.size();
+    }
+
+    return size;
+}
+
+uint32_t PriorityThreadQueue::getLevel(const Thread &thread) {
+    return thread.getPriority() + (thread.isBoosted() ? 1 : 0);
+}
+
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_PRIORITYTHREADQUEUE_H
+#define HHUOS_PRIORITYTHREADQUEUE_H
+
+#include <cstdint>
+
+#include "lib/util/collection/ArrayListBlockingQueue.h"
+#include "lib/util/async/Thread.h"
+
+namespace Kernel {
+
+class Thread;
+
+/**
+ * A run queue with one round-robin queue per priority level.
+ * Threads are always taken from the highest non-empty level, except for every STARVATION_INTERVAL-th call of poll(),
+ * which serves the lowest non-empty level, so that background threads still make progress.
+ * A thread is queued at its base priority, or one level above it, if it has been boosted after waking up.
+ * The queue is not synchronized, the scheduler protects it with the lock of the corresponding CPU.
+ */
+class PriorityThreadQueue {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    PriorityThreadQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    PriorityThreadQueue(const PriorityThreadQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    PriorityThreadQueue &operator=(const PriorityThreadQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~PriorityThreadQueue() = default;
+
+    void offer(Thread *thread);
+
+    /**
+     * Take the next thread, that should be scheduled.
+     *
+     * @return The thread, or nullptr if the queue is empty
+     */
+    Thread* poll();
+
+    /**
+     * Get the thread, that would be taken by the next call of poll() (ignoring starvation prevention).
+     *
+     * @return The thread, or nullptr if the queue is empty
+     */
+    [[nodiscard]] Thread* peek();
+
+    bool remove(Thread *thread);
+
+    [[nodiscard]] bool contains(Thread *thread) const;
+
+    [[nodiscard]] Thread* getThread(uint32_t id) const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    // All priorities of Util::Async::Thread, plus one level for boosted threads with the highest priority
+    static const constexpr uint32_t PRIORITY_LEVELS = Util::Async::Thread::HIGH + 2;
+
+private:
+
+    static uint32_t getLevel(const Thread &thread);
+
+    Util::ArrayListBlockingQueue<Thread*> levels[PRIORITY_LEVELS];
+    uint32_t pollCount = 0;
+
+    static const constexpr uint32_t STARVATION_INTERVAL = 16;
+};
+
+}
+
+#endif
@@ -132,6 +132,7 @@ void Process::killAllThreadsButCurrent() {
 
     for (auto *thread : threads) {
         if (thread->getId() != currentThreadId) {
+            schedulerService.cancelWait(*thread);
             schedulerService.killWithoutLock(*thread);
         }
     }
@@ -25,8 +25,11 @@
 #include "kernel/process/Thread.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/service/SchedulerService.h"
+#include "lib/util/async/Atomic.h"
+#include "lib/util/async/InterruptEvent.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/time/Timestamp.h"
+#include "kernel/service/InterruptService.h"
 
 extern uint32_t scheduler_initialized;
 
@@ -34,73 +37,116 @@ namespace Kernel {
 
 bool Scheduler::fpuAvailable = Device::Fpu::isAvailable();
 
+Scheduler::Scheduler(uint32_t cpuCount) : runQueues(cpuCount) {
+    for (uint32_t i = 0; i < cpuCount; i++) {
+        runQueues[i] = new RunQueue();
+    }
+}
+
 Scheduler::~Scheduler() {
-    while (!threadQueue.isEmpty()) {
-        delete threadQueue.poll();
+    for (auto *queue : runQueues) {
+        while (!queue->threads.isEmpty()) {
+            delete queue->threads.poll();
+        }
+
+        delete queue;
     }
 }
 
 void Scheduler::start() {
-    lock.acquire();
-    currentThread = &getNextThread();
-    start_first_thread(currentThread->getContext());
+    auto &queue = getCurrentRunQueue();
+    queue.lock.acquire();
+    queue.currentThread = &getNextThread();
+    queue.currentThread->cpuId = getCurrentCpuId();
+    start_first_thread(queue.currentThread->getContext());
+}
+
+void Scheduler::startApplicationProcessor() {
+    auto &queue = getCurrentRunQueue();
+    queue.lock.acquire();
+    waitForThread(queue);
+
+    auto &thread = getNextThread();
+    queue.currentThread = &thread;
+    thread.cpuId = getCurrentCpuId();
+    System::getService<MemoryService>().switchAddressSpace(thread.getParent().getAddressSpace());
+    if (fpuAvailable) {
+        Device::Fpu::armFpuMonitor();
+    }
+
+    // The boot stack of this CPU is never used again, so its context is saved into a dummy
+    // (start_first_thread() cannot be used, since this CPU has already loaded its TSS)
+    Context *bootContext;
+    switch_context(&bootContext, &thread.kernelContext);
+    Util::Exception::throwException(Util::Exception::ILLEGAL_STATE, "Scheduler: Application processor returned to its boot context!");
 }
 
 void Scheduler::ready(Thread &thread) {
-    if (currentThread == nullptr) {
-        currentThread = &thread;
+    auto &queue = getCurrentRunQueue();
+    if (queue.currentThread == nullptr) {
+        queue.currentThread = &thread;
     }
 
-    if (threadQueue.contains(&thread)) {
+    if (queue.threads.contains(&thread)) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "Scheduler: Thread is already running!");
     }
 
-    lock.acquire();
-    threadQueue.offer(&thread);
+    queue.lock.acquire();
+    thread.cpuId = getCurrentCpuId();
+    queue.threads.offer(&thread);
     thread.getParent().addThread(thread);
-    lock.release();
+    queue.lock.release();
 }
 
 void Scheduler::exit() {
-    lock.acquire();
-    threadQueue.remove(currentThread);
-    currentThread->getParent().removeThread(*currentThread);
-    lock.release();
+    auto &queue = getCurrentRunQueue();
+    auto &currentThread = *queue.currentThread;
 
-    currentThread->unblockJoinList();
+    queue.lock.acquire();
+    queue.threads.remove(&currentThread);
+    currentThread.getParent().removeThread(currentThread);
+    queue.lock.release();
 
-    System::getService<SchedulerService>().cleanup(currentThread);
+    currentThread.unblockJoinList();
+
+    System::getService<SchedulerService>().cleanup(&currentThread);
     yield(true);
 }
 
 void Scheduler::kill(Thread &thread) {
-    if (thread.getId() == currentThread->getId()) {
+    if (thread.getId() == getCurrentThread().getId()) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT,"Scheduler: A thread cannot kill itself!");
     }
 
     sleepLock.acquire();
-    sleepList.remove(SleepEntry{&thread, 0});
+    sleepQueue.remove(thread);
     sleepLock.release();
 
-    lock.acquire();
-    threadQueue.remove(&thread);
+    // A later wakeup of a blocked thread would access the freed thread
+    System::getService<SchedulerService>().cancelWait(thread);
+
+    for (auto *queue : runQueues) {
+        queue->lock.acquire();
+        queue->threads.remove(&thread);
+        queue->lock.release();
+    }
+
     thread.getParent().removeThread(thread);
     thread.unblockJoinList();
-    lock.release();
 
     System::getService<SchedulerService>().cleanup(&thread);
 }
 
 void Scheduler::killWithoutLock(Thread &thread) {
-    if (thread.getId() == currentThread->getId()) {
+    if (thread.getId() == getCurrentThread().getId()) {
         Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT,"Scheduler: A thread cannot kill itself!");
     }
 
     sleepLock.acquire();
-    sleepList.remove(SleepEntry{&thread, 0});
+    sleepQueue.remove(thread);
     sleepLock.release();
 
-    threadQueue.remove(&thread);
+    removeFromRunQueues(thread);
     thread.getParent().removeThread(thread);
     thread.unblockJoinList();
 
@@ -108,40 +154,73 @@ void Scheduler::killWithoutLock(Thread &thread) {
 }
 
 Thread& Scheduler::getCurrentThread() {
-    return *currentThread;
+    return *getCurrentRunQueue().currentThread;
 }
 
 Thread& Scheduler::getNextThread() {
-    Thread *thread = threadQueue.poll();
-    threadQueue.offer(thread);
+    auto &queue = getCurrentRunQueue();
+    Thread *thread = queue.threads.poll();
+
+    // The boost of a woken up thread only lasts until it has been dispatched, afterwards it is queued at its own priority
+    thread->boosted = false;
+    queue.threads.offer(thread);
 
     return *thread;
 }
 
 void Scheduler::yield(bool force) {
+    // Spinlocks yield while waiting, so this is also the place to answer TLB shootdowns with interrupts disabled
+    auto &memoryService = System::getService<Kernel::MemoryService>();
+    memoryService.handlePendingTlbShootdown();
+
     if (!scheduler_initialized) {
         return;
     }
 
-    if (force) {
-        lock.acquire();
-    } else if (!lock.tryAcquire()) {
+    auto &queue = getCurrentRunQueue();
+    if (queue.currentThread == nullptr) {
+        // This CPU has not started scheduling yet
         return;
     }
 
-    do {
-        checkSleepList();
-    } while (threadQueue.isEmpty());
+    if (force) {
+        queue.lock.acquire();
+    } else if (!queue.lock.tryAcquire()) {
+        return;
+    }
 
+    waitForThread(queue);
     Thread &nextThread = getNextThread();
 
-    System::getService<Kernel::MemoryService>().switchAddressSpace(nextThread.getParent().getAddressSpace());
-    dispatch(nextThread);
+    memoryService.switchAddressSpace(nextThread.getParent().getAddressSpace());
+    dispatch(queue, nextThread);
+}
+
+void Scheduler::waitForThread(RunQueue &queue) {
+    checkSleepList(queue);
+
+    while (queue.threads.isEmpty() && !stealThread(queue)) {
+        queue.lock.release();
+        System::getService<Kernel::MemoryService>().handlePendingTlbShootdown();
+        asm volatile ("pause");
+
+        // Do not use acquire() here, since it would recursively yield
+        while (!queue.lock.tryAcquire()) {
+            asm volatile ("pause");
+        }
+
+        checkSleepList(queue);
+    }
 }
 
-void Scheduler::dispatch(Thread &nextThread) {
-    auto &oldThread = *currentThread;
-    currentThread = &nextThread;
+void Scheduler::dispatch(RunQueue &queue, Thread &nextThread) {
+    auto &oldThread = *queue.currentThread;
+    queue.currentThread = &nextThread;
+    nextThread.cpuId = getCurrentCpuId();
+    if (nextThread.wakeupPending) {
+        recordWakeupLatency(queue, nextThread);
+    }
+
     if (fpuAvailable) {
         Device::Fpu::armFpuMonitor();
     }
@@ -149,74 +228,244 @@ void Scheduler::dispatch(Thread &nextThread) {
     switch_context(&oldThread.kernelContext, &nextThread.kernelContext);
 }
 
+bool Scheduler::stealThread(RunQueue &queue) {
+    auto &schedulerService = System::getService<SchedulerService>();
+    for (uint32_t i = 0; i < runQueues.length(); i++) {
+        auto *victim = runQueues[i];
+
+        // Checking the size without holding the lock is racy, but it saves us from touching foreign locks in vain
+        if (victim == &queue || victim->threads.isEmpty() || !victim->lock.tryAcquire()) {
+            continue;
+        }
+
+        // Only the head of the victim's highest non-empty priority level is considered. This may be the running thread
+        // (e.g. if it is the only thread with its priority), in which case nothing is stolen from this victim,
+        // instead of taking a thread with lower priority.
+        // A thread, whose FPU context is still loaded on the victim's CPU, must stay there.
+        auto *thread = victim->threads.peek();
+        if (thread != nullptr && thread != victim->currentThread && !schedulerService.isFpuContextLoaded(*thread, i)) {
+            victim->threads.remove(thread);
+            victim->lostThreads++;
+            victim->lock.release();
+
+            queue.threads.offer(thread);
+            queue.stolenThreads++;
+            return true;
+        }
+
+        victim->lock.release();
+    }
+
+    return false;
+}
+
+void Scheduler::removeFromRunQueues(Thread &thread) {
+    for (auto *queue : runQueues) {
+        queue->threads.remove(&thread);
+    }
+}
+
 uint32_t Scheduler::getThreadCount() const {
-    return threadQueue.size();
+    uint32_t count = 0;
+    for (const auto *queue : runQueues) {
+        count += queue->threads.size();
+    }
+
+    return count;
+}
+
+uint32_t Scheduler::getCpuCount() const {
+    return runQueues.length();
+}
+
+Scheduler::RunQueueStatus Scheduler::getRunQueueStatus(uint32_t cpuId) const {
+    const auto &queue = *runQueues[cpuId];
+    RunQueueStatus status{queue.threads.size(), queue.stolenThreads, queue.lostThreads, {}};
+    for (uint32_t i = 0; i < LATENCY_BUCKETS; i++) {
+        status.wakeupLatencies[i] = queue.wakeupLatencies[i];
+    }
+
+    return status;
+}
+
+void Scheduler::lockCurrentRunQueue() {
+    getCurrentRunQueue().lock.acquire();
+}
+
+void Scheduler::unlockCurrentRunQueue() {
+    getCurrentRunQueue().lock.release();
 }
 
 void Scheduler::block() {
-    lock.acquire();
-    threadQueue.remove(currentThread);
+    auto &queue = getCurrentRunQueue();
+    queue.lock.acquire();
+    queue.threads.remove(queue.currentThread);
+    queue.lock.release();
+
+    yield(true);
+}
+
+void Scheduler::blockAndRelease(Util::Async::Spinlock &lock) {
+    auto &queue = getCurrentRunQueue();
+    queue.lock.acquire();
+    queue.threads.remove(queue.currentThread);
     lock.release();
+    queue.lock.release();
 
     yield(true);
 }
 
 void Scheduler::unblock(Thread &thread) {
-    lock.acquire();
-    threadQueue.offer(&thread);
-    lock.release();
+    // Prefer the CPU the thread ran on most recently (its FPU context may still be loaded there)
+    auto &queue = *runQueues[thread.cpuId];
+    queue.lock.acquire();
+    prepareWakeup(thread);
+    queue.threads.offer(&thread);
+    queue.lock.release();
 }
 
 void Scheduler::sleep(const Util::Time::Timestamp &time) {
     auto systemTime = System::getService<TimeService>().getSystemTime().toMilliseconds();
+    auto &queue = getCurrentRunQueue();
+    auto &currentThread = *queue.currentThread;
 
+    // The thread must have left its run queue, before another CPU is able to wake it up again
+    queue.lock.acquire();
+    queue.threads.remove(&currentThread);
     sleepLock.acquire();
-    sleepList.add(SleepEntry{currentThread, systemTime + time.toMilliseconds()});
+    sleepQueue.insert(currentThread, systemTime + time.toMilliseconds());
     sleepLock.release();
+    queue.lock.release();
 
-    block();
+    yield(true);
 }
 
-void Scheduler::checkSleepList() {
-    if (sleepLock.tryAcquire()) {
-        auto systemTime = System::getService<TimeService>().getSystemTime().toMilliseconds();
-        for (uint32_t i = 0; i < sleepList.size(); i++) {
-            const auto &entry = sleepList.get(i);
-            if (systemTime >= entry.wakeupTime) {
-                threadQueue.offer(entry.thread);
-                sleepList.remove(entry);
-            }
-        }
+bool Scheduler::getNextWakeupTime(uint32_t &wakeupTime) {
+    sleepLock.acquire();
+    auto sleeping = sleepQueue.getNextWakeupTime(wakeupTime);
+    sleepLock.release();
+
+    return sleeping;
+}
+
+void Scheduler::queueInterruptEvent(Util::Async::InterruptEvent &event) {
+    Util::Async::Atomic<uint32_t> head(interruptEvents);
+    uint32_t first;
+    do {
+        first = head.get();
+        event.next = reinterpret_cast<Util::Async::InterruptEvent*>(first);
+    } while (!head.compareAndSet(first, reinterpret_cast<uint32_t>(&event)));
+}
+
+Util::Async::InterruptEvent* Scheduler::takeInterruptEvents() {
+    Util::Async::Atomic<uint32_t> head(interruptEvents);
+    return reinterpret_cast<Util::Async::InterruptEvent*>(head.getAndSet(0));
+}
+
+void Scheduler::checkSleepList(RunQueue &queue) {
+    if (!sleepLock.tryAcquire()) {
+        return;
+    }
+
+    // Interrupt handlers cannot wake up threads themselves -> Let the interrupt event thread run at once.
+    // If it is not sleeping yet, it either still sees the new events or is woken up at the next check.
+    if (interruptEventThread != nullptr && Util::Async::Atomic<uint32_t>(interruptEvents).get() != 0 && sleepQueue.remove(*interruptEventThread)) {
+        sleepQueue.insert(*interruptEventThread, 0);
+    }
+
+    // Checking the earliest deadline first avoids asking the time service on every yield
+    uint32_t nextWakeupTime;
+    if (!sleepQueue.getNextWakeupTime(nextWakeupTime)) {
+        sleepLock.release();
+        return;
+    }
+
+    auto systemTime = System::getService<TimeService>().getSystemTime().toMilliseconds();
+    if (systemTime < nextWakeupTime) {
         sleepLock.release();
+        return;
     }
+
+    for (auto *thread = sleepQueue.pollExpired(systemTime); thread != nullptr; thread = sleepQueue.pollExpired(systemTime)) {
+        auto &targetQueue = *runQueues[thread->cpuId];
+        if (&targetQueue == &queue) {
+            prepareWakeup(*thread);
+            queue.threads.offer(thread);
+        } else if (targetQueue.lock.tryAcquire()) {
+            prepareWakeup(*thread);
+            targetQueue.threads.offer(thread);
+            targetQueue.lock.release();
+        } else {
+            // The thread's CPU is busy scheduling -> Try again at the next check
+            sleepQueue.insert(*thread, systemTime);
+            break;
+        }
+    }
+
+    sleepLock.release();
 }
 
-Thread* Scheduler::getThread(uint32_t id) {
-    lock.acquire();
-    sleepLock.acquire();
-    for (auto *thread : threadQueue) {
-        if (thread->getId() == id) {
-            sleepLock.release();
-            lock.release();
-            return thread;
+void Scheduler::setPriority(Thread &thread, Util::Async::Thread::Priority priority) {
+    for (auto *queue : runQueues) {
+        queue->lock.acquire();
+        if (queue->threads.remove(&thread)) {
+            thread.priority = priority;
+            queue->threads.offer(&thread);
+            queue->lock.release();
+            return;
         }
+        queue->lock.release();
+    }
+
+    // The thread is currently blocked or sleeping -> The new priority takes effect, once it is woken up
+    thread.priority = priority;
+}
+
+void Scheduler::prepareWakeup(Thread &thread) {
+    thread.boosted = true;
+    thread.wakeupPending = true;
+    thread.wakeupTime = System::getService<TimeService>().getSystemTime().toMicroseconds();
+}
+
+void Scheduler::recordWakeupLatency(RunQueue &queue, Thread &thread) {
+    // Microsecond values wrap around, but their difference is still correct
+    auto now = System::getService<TimeService>().getSystemTime().toMicroseconds();
+    auto latency = (now - thread.wakeupTime) / 1000;
+
+    uint32_t bucket = 0;
+    while (latency > 0 && bucket < LATENCY_BUCKETS - 1) {
+        latency >>= 1;
+        bucket++;
     }
 
-    for (auto &sleepEntry : sleepList) {
-        if (sleepEntry.thread->getId() == id) {
-            sleepLock.release();
-            lock.release();
-            return sleepEntry.thread;
+    queue.wakeupLatencies[bucket]++;
+    thread.wakeupPending = false;
+}
+
+Thread* Scheduler::getThread(uint32_t id) {
+    for (auto *queue : runQueues) {
+        queue->lock.acquire();
+        auto *thread = queue->threads.getThread(id);
+        queue->lock.release();
+
+        if (thread != nullptr) {
+            return thread;
         }
     }
 
+    sleepLock.acquire();
+    auto *thread = sleepQueue.getThread(id);
     sleepLock.release();
-    lock.release();
-    return nullptr;
+
+    return thread;
+}
+
+uint8_t Scheduler::getCurrentCpuId() const {
+    return System::getService<InterruptService>().getCpuId();
 }
 
-bool Scheduler::SleepEntry::operator!=(const Scheduler::SleepEntry &other) const {
-    return thread->getId() != other.thread->getId();
+Scheduler::RunQueue& Scheduler::getCurrentRunQueue() const {
+    return *runQueues[getCurrentCpuId()];
 }
 
 }
@@ -20,18 +20,23 @@
 
 #include <cstdint>
 
-#include "lib/util/collection/ArrayListBlockingQueue.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/collection/Collection.h"
 #include "lib/util/collection/Iterator.h"
 #include "kernel/process/Thread.h"
+#include "kernel/process/SleepQueue.h"
+#include "kernel/process/PriorityThreadQueue.h"
+#include "lib/util/async/Thread.h"
 
 namespace Util {
 namespace Time {
 class Timestamp;
 }  // namespace Time
+namespace Async {
+class InterruptEvent;
+}  // namespace Async
 }  // namespace Util
 
 namespace Kernel {
@@ -41,10 +46,27 @@ class Scheduler {
     friend class SchedulerService;
 
 public:
+
+    /**
+     * Woken up threads are counted by the time it took until they were running again.
+     * Bucket 0 counts latencies below 1 ms, bucket i > 0 counts latencies in [2^(i-1) ms, 2^i ms),
+     * and the last bucket also counts all latencies above.
+     */
+    static const constexpr uint32_t LATENCY_BUCKETS = 8;
+
+    struct RunQueueStatus {
+        uint32_t threadCount;
+        uint32_t stolenThreads;
+        uint32_t lostThreads;
+        uint32_t wakeupLatencies[LATENCY_BUCKETS];
+    };
+
     /**
      * Constructor.
+     *
+     * @param cpuCount The amount of run queues to create (one per local APIC id)
      */
-    explicit Scheduler() = default;
+    explicit Scheduler(uint32_t cpuCount);
 
     /**
      * Copy Constructor.
@@ -63,6 +85,12 @@ public:
 
     void start();
 
+    /**
+     * Start scheduling on the executing application processor.
+     * Waits until a thread can be taken from another CPU's run queue and switches to it.
+     */
+    [[noreturn]] void startApplicationProcessor();
+
     /**
      * Registers a new Thread.
      *
@@ -84,14 +112,54 @@ public:
      */
     void kill(Thread &thread);
 
+    /**
+     * Kills a specific Thread without locking the run queues (e.g. because the caller holds the current run queue's lock).
+     * Taking a wait queue's lock is not allowed while holding a run queue lock,
+     * so the caller must remove a blocked thread from its wait queue first (see SchedulerService::cancelWait()).
+     *
+     * @param thread A Thread
+     */
     void killWithoutLock(Thread &thread);
 
     void block();
 
+    /**
+     * Block the current thread and release the given lock, after the thread has left its run queue.
+     * This way, a thread that is woken up by another thread holding the same lock can never miss its wakeup.
+     */
+    void blockAndRelease(Util::Async::Spinlock &lock);
+
     void unblock(Thread &thread);
 
     void sleep(const Util::Time::Timestamp &time);
 
+    /**
+     * Change the priority of a thread. If the thread is runnable, it is moved to the corresponding level of its run queue.
+     */
+    void setPriority(Thread &thread, Util::Async::Thread::Priority priority);
+
+    /**
+     * Get the time at which the next sleeping thread needs to be woken up.
+     * This allows programming a one-shot timer instead of checking for expired sleepers periodically.
+     *
+     * @param wakeupTime Set to the wakeup time in milliseconds (system time), if a thread is sleeping
+     * @return true, if at least one thread is sleeping
+     */
+    bool getNextWakeupTime(uint32_t &wakeupTime);
+
+    /**
+     * Queue an event, that has been signaled by an interrupt handler. No locks are taken, so this is safe inside interrupt handlers.
+     * The interrupt event thread is woken up at the next check of the sleep list and dispatches the event.
+     */
+    void queueInterruptEvent(Util::Async::InterruptEvent &event);
+
+    /**
+     * Take all queued interrupt events.
+     *
+     * @return The first event (linked to the others via InterruptEvent::next), or nullptr if no event is queued
+     */
+    Util::Async::InterruptEvent* takeInterruptEvents();
+
     /**
      * Returns the activeFlag Thread.
      *
@@ -105,31 +173,90 @@ public:
 
     [[nodiscard]] uint32_t getThreadCount() const;
 
+    [[nodiscard]] uint32_t getCpuCount() const;
+
+    [[nodiscard]] RunQueueStatus getRunQueueStatus(uint32_t cpuId) const;
+
+    /**
+     * Acquire the run queue lock of the executing CPU.
+     * It is released by the next thread after a context switch, or by calling unlockCurrentRunQueue().
+     */
+    void lockCurrentRunQueue();
+
+    void unlockCurrentRunQueue();
+
 private:
+
+    /**
+     * Every CPU (identified by its local APIC id) owns a run queue, which is protected by its own lock.
+     * The lock of a run queue is held during a context switch on its CPU and released by the next thread.
+     * The run queue also contains the thread, that is currently running on its CPU.
+     */
+    struct RunQueue {
+        Util::Async::Spinlock lock;
+        PriorityThreadQueue threads;
+        Thread *currentThread = nullptr;
+        uint32_t stolenThreads = 0;
+        uint32_t lostThreads = 0;
+        uint32_t wakeupLatencies[LATENCY_BUCKETS]{};
+    };
+
     /**
      * Switches to the given Thread.
      *
+     * @param queue The run queue of the executing CPU
      * @param nextThread A Thread
      */
-    void dispatch(Thread &nextThread);
+    void dispatch(RunQueue &queue, Thread &nextThread);
 
-    void checkSleepList();
+    /**
+     * Wake up threads, whose sleep time is over. A thread is offered to the run queue of the CPU it ran on most recently.
+     * The given queue must be locked, foreign queues are only locked via tryAcquire().
+     */
+    void checkSleepList(RunQueue &queue);
 
-private:
+    /**
+     * Boost a thread, that is about to become runnable again after blocking or sleeping,
+     * and remember the wakeup time for measuring its wakeup-to-run latency.
+     */
+    static void prepareWakeup(Thread &thread);
 
-    struct SleepEntry {
-        Thread *thread;
-        uint32_t wakeupTime;
+    /**
+     * Count the wakeup-to-run latency of a thread, that has just been dispatched after waking up.
+     */
+    static void recordWakeupLatency(RunQueue &queue, Thread &thread);
 
-        bool operator!=(const SleepEntry &other) const;
-    };
+    /**
+     * Idle until the given (locked) run queue contains a thread.
+     * The lock is temporarily released while idling, so that other CPUs are able to hand over threads.
+     */
+    void waitForThread(RunQueue &queue);
+
+    /**
+     * Try to move a waiting thread from another CPU's run queue into the given (empty) run queue.
+     * Only tryAcquire() is used on foreign locks, so that two idle CPUs can never deadlock.
+     *
+     * @return true, if a thread has been stolen
+     */
+    bool stealThread(RunQueue &queue);
+
+    /**
+     * Remove a thread from every run queue. The locks of the run queues are not acquired.
+     */
+    void removeFromRunQueues(Thread &thread);
+
+    [[nodiscard]] uint8_t getCurrentCpuId() const;
+
+    [[nodiscard]] RunQueue& getCurrentRunQueue() const;
+
+    Util::Array<RunQueue*> runQueues;
 
-    Util::Async::Spinlock lock;
     Util::Async::Spinlock sleepLock;
+    SleepQueue sleepQueue;
 
-    Util::ArrayListBlockingQueue<Thread*> threadQueue;
-    Util::ArrayList<SleepEntry> sleepList;
-    Thread *currentThread = nullptr;
+    // Lock-free stack of queued interrupt events (stored as address, since atomics are only available for integers)
+    uint32_t interruptEvents = 0;
+    Thread *interruptEventThread = nullptr;
 
     static bool fpuAvailable;
 };
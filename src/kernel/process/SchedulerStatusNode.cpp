@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SchedulerStatusNode.h"
+
+#include "kernel/system/System.h"
+#include "kernel/service/SchedulerService.h"
+
+namespace Kernel {
+
+SchedulerStatusNode::SchedulerStatusNode(const Util::String &name) : StringNode(name) {}
+
+Util::String SchedulerStatusNode::getString() {
+    auto &schedulerService = System::getService<SchedulerService>();
+    Util::String result;
+
+    for (uint32_t i = 0; i < schedulerService.getRunQueueCount(); i++) {
+        auto status = schedulerService.getRunQueueStatus(i);
+        result += Util::String::format("CPU %u: Threads: [%u], Stolen: [%u], Lost: [%u]\n", i, status.threadCount, status.stolenThreads, status.lostThreads);
+
+        result += "  Wakeup latency:";
+        for (uint32_t j = 0; j < Scheduler::LATENCY_BUCKETS; j++) {
+            auto lowerBound = j == 0 ? 0 : 1 << (j - 1);
+            auto format = j == Scheduler::LATENCY_BUCKETS - 1 ? " >=%ums: [%u]" : " %ums: [%u]";
+            result += Util::String::format(format, lowerBound, status.wakeupLatencies[j]);
+        }
+        result += "\n";
+    }
+
+    return result;
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SCHEDULERSTATUSNODE_H
+#define HHUOS_SCHEDULERSTATUSNODE_H
+
+#include "filesystem/memory/StringNode.h"
+#include "lib/util/base/String.h"
+
+namespace Kernel {
+
+/**
+ * Reports the length of every per-CPU run queue and how many threads have been stolen from or by it.
+ */
+class SchedulerStatusNode : public Filesystem::Memory::StringNode {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit SchedulerStatusNode(const Util::String &name);
+
+    /**
+     * Copy Constructor.
+     */
+    SchedulerStatusNode(const SchedulerStatusNode &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SchedulerStatusNode& operator=(const SchedulerStatusNode &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SchedulerStatusNode() override = default;
+
+    /**
+     * Overriding function from StringNode.
+     */
+    Util::String getString() override;
+};
+
+}
+
+#endif
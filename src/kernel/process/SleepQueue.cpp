@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include "SleepQueue.h"
+
+#include "kernel/process/Thread.h"
+
+namespace Kernel {
+
+void SleepQueue::insert(Thread &thread, uint32_t wakeupTime) {
+    heap.add(Entry{&thread, wakeupTime});
+    siftUp(heap.size() - 1);
+}
+
+bool SleepQueue::remove(Thread &thread) {
+    for (uint32_t i = 0; i < heap.size(); i++) {
+        if (heap.get(i).thread->getId() == thread.getId()) {
+            removeIndex(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Thread* SleepQueue::pollExpired(uint32_t systemTime) {
+    if (heap.isEmpty() || heap.get(0).wakeupTime > systemTime) {
+        return nullptr;
+    }
+
+    auto *thread = heap.get(0).thread;
+    removeIndex(0);
+
+    return thread;
+}
+
+bool SleepQueue::getNextWakeupTime(uint32_t &wakeupTime) const {
+    if (heap.isEmpty()) {
+        return false;
+    }
+
+    wakeupTime = heap.get(0).wakeupTime;
+    return true;
+}
+
+Thread* SleepQueue::getThread(uint32_t id) const {
+    for (const auto &entry : heap) {
+        if (entry.thread->getId() == id) {
+            return entry.thread;
+        }
+    }
+
+    return nullptr;
+}
+
+bool SleepQueue::isEmpty() const {
+    return heap.isEmpty();
+}
+
+uint32_t SleepQueue::size() const {
+    return heap.size();
+}
+
+void SleepQueue::removeIndex(uint32_t index) {
+    // Move the last entry into the gap (removing the last index of an ArrayList does not shift any elements)
+    auto lastIndex = heap.size() - 1;
+    if (index != lastIndex) {
+        swap(index, lastIndex);
+    }
+
+    heap.removeIndex(lastIndex);
+    if (index < heap.size()) {
+        siftDown(index);
+        siftUp(index);
+    }
+}
+
+void SleepQueue::siftUp(uint32_t index) {
+    while (index > 0) {
+        auto parent = (index - 1) / 2;
+        if (heap.get(parent).wakeupTime <= heap.get(index).wakeupTime) {
+            return;
+        }
+
+        swap(index, parent);
+        index = parent;
+    }
+}
+
+void SleepQueue::siftDown(uint32_t index) {
+    while (true) {
+        auto left = 2 * index + 1;
+        auto right = left + 1;
+        auto smallest = index;
+
+        if (left < heap.size() && heap.get(left).wakeupTime < heap.get(smallest).wakeupTime) {
+            smallest = left;
+        }
+
+        if (right < heap.size() && heap.get(right).wakeupTime < heap.get(smallest).wakeupTime) {
+            smallest = right;
+        }
+
+        if (smallest == index) {
+            return;
+        }
+
+        swap(index, smallest);
+        index = smallest;
+    }
+}
+
+void SleepQueue::swap(uint32_t first, uint32_t second) {
+    auto entry = heap.get(first);
+    heap.set(first, heap.get(second));
+    heap.set(second, entry);
+}
+
+bool SleepQueue::Entry::operator!=(const SleepQueue::Entry &other) const {
+    return thread != other.thread || wakeupTime != other.wakeupTime;
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_SLEEPQUEUE_H
+#define HHUOS_SLEEPQUEUE_H
+
+#include <cstdint>
+
+#include "lib/util/collection/ArrayList.h"
+
+namespace Kernel {
+
+class Thread;
+
+/**
+ * Sleeping threads, ordered by their wakeup time in a binary min-heap.
+ * Inserting a thread and taking the next expired one both cost O(log n),
+ * while querying the next deadline (e.g. for programming a one-shot timer) is O(1).
+ * The queue is not synchronized, the scheduler protects it with its sleep lock.
+ */
+class SleepQueue {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    SleepQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    SleepQueue(const SleepQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SleepQueue &operator=(const SleepQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SleepQueue() = default;
+
+    void insert(Thread &thread, uint32_t wakeupTime);
+
+    /**
+     * Remove a thread from the queue (e.g. when it is killed while sleeping).
+     *
+     * @return true, if the thread has been sleeping
+     */
+    bool remove(Thread &thread);
+
+    /**
+     * Take the thread with the earliest wakeup time, if that time has been reached.
+     *
+     * @param systemTime The current system time in milliseconds
+     * @return The woken up thread, or nullptr if no thread needs to be woken up yet
+     */
+    Thread* pollExpired(uint32_t systemTime);
+
+    /**
+     * Get the earliest wakeup time of all sleeping threads.
+     * 0 is a valid wakeup time, so emptiness is reported separately.
+     *
+     * @param wakeupTime Set to the wakeup time in milliseconds, if a thread is sleeping
+     * @return true, if at least one thread is sleeping
+     */
+    bool getNextWakeupTime(uint32_t &wakeupTime) const;
+
+    [[nodiscard]] Thread* getThread(uint32_t id) const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] uint32_t size() const;
+
+private:
+
+    struct Entry {
+        Thread *thread;
+        uint32_t wakeupTime;
+
+        bool operator!=(const Entry &other) const;
+    };
+
+    void removeIndex(uint32_t index);
+
+    void siftUp(uint32_t index);
+
+    void siftDown(uint32_t index);
+
+    void swap(uint32_t first, uint32_t second);
+
+    Util::ArrayList<Entry> heap;
+};
+
+}
+
+#endif
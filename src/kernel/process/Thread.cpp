@@ -99,7 +99,7 @@ Thread& Thread::createUserThread(const Util::String &name, Process &parent, uint
     return *thread;
 }
 
-Thread& Thread::createMainUserThread(const Util::String &name, Process &parent, uint32_t eip, uint32_t argc, char **argv, void *envp, uint32_t heapStartAddress) {
+Thread& Thread::createMainUserThread(const Util::String &name, Process &parent, uint32_t eip, uint32_t argc, char **argv, void *envp, uint32_t heapStartAddress, Util::HeapMemoryManagerType heapMemoryManagerType) {
     auto *kernelStack = Stack::createKernelStack(DEFAULT_STACK_SIZE);
     auto *userStack = Stack::createMainUserStack();
     auto *thread = new Thread(name, parent, nullptr, kernelStack, userStack);
@@ -117,6 +117,7 @@ Thread& Thread::createMainUserThread(const Util::String &name, Process &parent,
     thread->interruptFrame.ebx = reinterpret_cast<uint32_t>(argv);
     thread->interruptFrame.ecx = reinterpret_cast<uint32_t>(envp);
     thread->interruptFrame.edx = heapStartAddress;
+    thread->interruptFrame.esi = heapMemoryManagerType;
     thread->interruptFrame.ebp = reinterpret_cast<uint32_t>(userStack->getStart());
     thread->interruptFrame.uesp = reinterpret_cast<uint32_t>(userStack->getStart());
     thread->interruptFrame.eflags = 0x200;
@@ -149,6 +150,14 @@ uint8_t *Thread::getFpuContext() const {
     return fpuContext;
 }
 
+Util::Async::Thread::Priority Thread::getPriority() const {
+    return priority;
+}
+
+bool Thread::isBoosted() const {
+    return boosted;
+}
+
 void Thread::join() {
     auto &schedulerService = System::getService<SchedulerService>();
     joinLock.acquire();
@@ -21,8 +21,10 @@
 #include <cstdint>
 
 #include "lib/util/base/String.h"
+#include "lib/util/base/Constants.h"
 #include "lib/util/collection/ArrayList.h"
 #include "lib/util/async/Spinlock.h"
+#include "lib/util/async/Thread.h"
 #include "lib/util/collection/Array.h"
 #include "lib/util/collection/Collection.h"
 #include "lib/util/collection/Iterator.h"
@@ -37,6 +39,7 @@ template <typename T> class IdGenerator;
 namespace Kernel {
 
 class Process;
+class WaitQueue;
 struct Context;
 struct InterruptFrame;
 
@@ -44,6 +47,7 @@ class Thread {
 
     friend class ThreadScheduler;
     friend class Scheduler;
+    friend class WaitQueue;
 
 public:
 
@@ -94,7 +98,7 @@ public:
     static Thread &createUserThread(const Util::String &name, Process &parent, uint32_t eip,
                                     Util::Async::Runnable *runnable);
 
-    static Thread& createMainUserThread(const Util::String &name, Process &parent, uint32_t eip, uint32_t argc, char **argv, void *envp, uint32_t heapStartAddress);
+    static Thread& createMainUserThread(const Util::String &name, Process &parent, uint32_t eip, uint32_t argc, char **argv, void *envp, uint32_t heapStartAddress, Util::HeapMemoryManagerType heapMemoryManagerType);
 
     [[nodiscard]] uint32_t getId() const;
 
@@ -106,6 +110,14 @@ public:
 
     [[nodiscard]] uint8_t* getFpuContext() const;
 
+    [[nodiscard]] Util::Async::Thread::Priority getPriority() const;
+
+    /**
+     * Check, if the thread has been woken up recently and is therefore scheduled one level above its priority.
+     * The boost is consumed, once the thread has been dispatched.
+     */
+    [[nodiscard]] bool isBoosted() const;
+
     void join();
 
     void unblockJoinList();
@@ -127,6 +139,14 @@ private:
     InterruptFrame &interruptFrame;
     Context *kernelContext;
     uint8_t *fpuContext;
+    uint8_t cpuId = 0; // The CPU, on which this thread has been scheduled most recently
+
+    Util::Async::Thread::Priority priority = Util::Async::Thread::NORMAL;
+    bool boosted = false;
+    bool wakeupPending = false; // Set, if the wakeup-to-run latency needs to be measured at the next dispatch
+    uint32_t wakeupTime = 0;    // System time in microseconds, at which the thread has been woken up
+    WaitQueue *waitQueue = nullptr; // The wait queue, in which this thread is blocked (if any)
+
 
     Util::ArrayList<Thread*> joinList;
     Util::Async::Spinlock joinLock;
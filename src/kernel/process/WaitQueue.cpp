@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#include "WaitQueue.h"
+
+#include "kernel/system/System.h"
+#include "kernel/service/SchedulerService.h"
+#include "kernel/process/Thread.h"
+
+namespace Kernel {
+
+void WaitQueue::wait() {
+    lock();
+    waitAndUnlock();
+}
+
+void WaitQueue::waitAndUnlock() {
+    auto &schedulerService = System::getService<SchedulerService>();
+    auto &thread = schedulerService.getCurrentThread();
+    thread.waitQueue = this;
+    threads.add(&thread);
+    schedulerService.blockAndRelease(queueLock);
+}
+
+uint32_t WaitQueue::wake(uint32_t count) {
+    auto &schedulerService = System::getService<SchedulerService>();
+    uint32_t woken = 0;
+
+    lock();
+    while (woken < count && !threads.isEmpty()) {
+        auto *thread = threads.removeIndex(0);
+        thread->waitQueue = nullptr;
+        schedulerService.unblock(*thread);
+        woken++;
+    }
+    unlock();
+
+    return woken;
+}
+
+uint32_t WaitQueue::wakeAll() {
+    return wake(UINT32_MAX);
+}
+
+bool WaitQueue::remove(Thread &thread) {
+    lock();
+    auto removed = threads.remove(&thread);
+    if (removed) {
+        thread.waitQueue = nullptr;
+    }
+    unlock();
+
+    return removed;
+}
+
+bool WaitQueue::removeFromWaitQueue(Thread &thread) {
+    // The queue cannot vanish, while the thread is blocked in it (its owner is still referenced by the thread)
+    auto *queue = thread.waitQueue;
+    return queue != nullptr && queue->remove(thread);
+}
+
+void WaitQueue::lock() {
+    queueLock.acquire();
+}
+
+void WaitQueue::unlock() {
+    queueLock.release();
+}
+
+bool WaitQueue::isEmpty() const {
+    return threads.isEmpty();
+}
+
+}
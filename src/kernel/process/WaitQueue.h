@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+#ifndef HHUOS_WAITQUEUE_H
+#define HHUOS_WAITQUEUE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/collection/ArrayList.h"
+
+namespace Kernel {
+
+class Thread;
+
+/**
+ * A queue of blocked threads, which are waiting for an event.
+ * Waiting threads are taken out of the scheduler completely, instead of repeatedly yielding.
+ * To check a condition without losing a wakeup, lock the queue, check the condition and call waitAndUnlock().
+ */
+class WaitQueue {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    WaitQueue() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    WaitQueue(const WaitQueue &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    WaitQueue &operator=(const WaitQueue &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~WaitQueue() = default;
+
+    /**
+     * Block the current thread, until it is woken up by wake() or wakeAll().
+     */
+    void wait();
+
+    /**
+     * Block the current thread, until it is woken up by wake() or wakeAll().
+     * The queue must have been locked by the current thread. It is unlocked atomically with blocking the thread.
+     */
+    void waitAndUnlock();
+
+    /**
+     * Wake up waiting threads in FIFO order.
+     *
+     * @param count The maximum amount of threads to wake up
+     * @return The amount of threads, that have been woken up
+     */
+    uint32_t wake(uint32_t count = 1);
+
+    uint32_t wakeAll();
+
+    /**
+     * Remove a blocked thread from the queue without waking it up (e.g. because it is killed).
+     *
+     * @return true, if the thread has been waiting in this queue
+     */
+    bool remove(Thread &thread);
+
+    /**
+     * Remove a thread from the wait queue, in which it is blocked (if any), without waking it up.
+     * Must be called before a blocked thread is freed, since a later wakeup would otherwise access freed memory.
+     *
+     * @return true, if the thread has been waiting in a queue
+     */
+    static bool removeFromWaitQueue(Thread &thread);
+
+    void lock();
+
+    void unlock();
+
+    [[nodiscard]] bool isEmpty() const;
+
+private:
+
+    Util::Async::Spinlock queueLock;
+    Util::ArrayList<Thread*> threads;
+};
+
+}
+
+#endif
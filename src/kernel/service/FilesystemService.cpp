@@ -21,7 +21,9 @@
 #include "ProcessService.h"
 #include "FilesystemService.h"
 #include "filesystem/core/Node.h"
+#include "filesystem/pipe/PipeDriver.h"
 #include "kernel/file/FileDescriptorManager.h"
+#include "kernel/file/OpenFile.h"
 #include "kernel/process/Process.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/system/SystemCall.h"
@@ -31,7 +33,7 @@
 
 namespace Kernel {
 
-FilesystemService::FilesystemService() {
+FilesystemService::FilesystemService() : pipeDriver(new Filesystem::Pipe::PipeDriver()) {
     SystemCall::registerSystemCall(Util::System::MOUNT, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 3) {
             return false;
@@ -81,6 +83,20 @@ FilesystemService::FilesystemService() {
         return true;
     });
 
+    SystemCall::registerSystemCall(Util::System::CREATE_PIPE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 3) {
+            return false;
+        }
+
+        auto &filesystemService = System::getService<FilesystemService>();
+        auto &readFileDescriptor = *va_arg(arguments, int32_t*);
+        auto &writeFileDescriptor = *va_arg(arguments, int32_t*);
+        auto &id = *va_arg(arguments, int32_t*);
+
+        id = filesystemService.createPipe(readFileDescriptor, writeFileDescriptor);
+        return id >= 0;
+    });
+
     SystemCall::registerSystemCall(Util::System::CREATE_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 2) {
             return false;
@@ -116,7 +132,7 @@ FilesystemService::FilesystemService() {
         auto fileDescriptor = va_arg(arguments, int32_t);
         auto &type = *va_arg(arguments, Util::Io::File::Type*);
 
-        type = System::getService<FilesystemService>().getNode(fileDescriptor).getType();
+        type = System::getService<FilesystemService>().getFile(fileDescriptor).getType();
         return true;
     });
 
@@ -170,7 +186,7 @@ FilesystemService::FilesystemService() {
         auto length = va_arg(arguments, uint64_t);
         auto &written = *va_arg(arguments, uint64_t*);
 
-        written = filesystemService.getNode(fileDescriptor).writeData(sourceBuffer, pos, length);
+        written = filesystemService.getFile(fileDescriptor).writeAt(sourceBuffer, pos, length);
         return true;
     });
 
@@ -186,7 +202,82 @@ FilesystemService::FilesystemService() {
         auto length = va_arg(arguments, uint64_t);
         auto &read = *va_arg(arguments, uint64_t*);
 
-        read = filesystemService.getNode(fileDescriptor).readData(targetBuffer, pos, length);
+        read = filesystemService.getFile(fileDescriptor).readAt(targetBuffer, pos, length);
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::WRITE_TO_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 4) {
+            return false;
+        }
+
+        auto &filesystemService = System::getService<FilesystemService>();
+        auto fileDescriptor = va_arg(arguments, int32_t);
+        auto *sourceBuffer = va_arg(arguments, uint8_t*);
+        auto length = va_arg(arguments, uint64_t);
+        auto &written = *va_arg(arguments, uint64_t*);
+
+        written = filesystemService.getFile(fileDescriptor).write(sourceBuffer, length);
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::READ_FROM_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 4) {
+            return false;
+        }
+
+        auto &filesystemService = System::getService<FilesystemService>();
+        auto fileDescriptor = va_arg(arguments, int32_t);
+        auto *targetBuffer = va_arg(arguments, uint8_t*);
+        auto length = va_arg(arguments, uint64_t);
+        auto &read = *va_arg(arguments, uint64_t*);
+
+        read = filesystemService.getFile(fileDescriptor).read(targetBuffer, length);
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::READ_FROM_FILE_VECTORED, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 4) {
+            return false;
+        }
+
+        auto &filesystemService = System::getService<FilesystemService>();
+        auto fileDescriptor = va_arg(arguments, int32_t);
+        auto *vectors = va_arg(arguments, const Util::Io::File::IoVector*);
+        auto count = va_arg(arguments, uint32_t);
+        auto &read = *va_arg(arguments, uint64_t*);
+
+        read = filesystemService.getFile(fileDescriptor).read(vectors, count);
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::WRITE_TO_FILE_VECTORED, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 4) {
+            return false;
+        }
+
+        auto &filesystemService = System::getService<FilesystemService>();
+        auto fileDescriptor = va_arg(arguments, int32_t);
+        auto *vectors = va_arg(arguments, const Util::Io::File::IoVector*);
+        auto count = va_arg(arguments, uint32_t);
+        auto &written = *va_arg(arguments, uint64_t*);
+
+        written = filesystemService.getFile(fileDescriptor).write(vectors, count);
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::SEEK_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 4) {
+            return false;
+        }
+
+        auto &filesystemService = System::getService<FilesystemService>();
+        auto fileDescriptor = va_arg(arguments, int32_t);
+        auto offset = va_arg(arguments, int64_t);
+        auto mode = static_cast<Util::Io::File::SeekMode>(va_arg(arguments, uint32_t));
+        auto &position = *va_arg(arguments, uint64_t*);
+
+        position = filesystemService.getFile(fileDescriptor).seek(offset, mode);
         return true;
     });
 
@@ -254,7 +345,12 @@ bool FilesystemService::createDirectory(const Util::String &path) {
 }
 
 bool FilesystemService::deleteFile(const Util::String &path) {
-    return filesystem.deleteFile(path);
+    if (!filesystem.deleteFile(path)) {
+        return false;
+    }
+
+    System::getService<MemoryService>().invalidateSharedSegments(Util::Io::File::getCanonicalPath(path));
+    return true;
 }
 
 int32_t FilesystemService::openFile(const Util::String &path) {
@@ -269,14 +365,26 @@ void FilesystemService::closeFile(int32_t fileDescriptor) {
     return System::getService<ProcessService>().getCurrentProcess().getFileDescriptorManager().closeFile(fileDescriptor);
 }
 
+int32_t FilesystemService::createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor) {
+    return System::getService<ProcessService>().getCurrentProcess().getFileDescriptorManager().createPipe(readFileDescriptor, writeFileDescriptor);
+}
+
 Filesystem::Node& FilesystemService::getNode(int32_t fileDescriptor) {
     return System::getService<ProcessService>().getCurrentProcess().getFileDescriptorManager().getNode(fileDescriptor);
 }
 
+OpenFile& FilesystemService::getFile(int32_t fileDescriptor) {
+    return System::getService<ProcessService>().getCurrentProcess().getFileDescriptorManager().getFile(fileDescriptor);
+}
+
 Filesystem::Filesystem& FilesystemService::getFilesystem() {
     return filesystem;
 }
 
+Filesystem::Pipe::PipeDriver& FilesystemService::getPipeDriver() {
+    return *pipeDriver;
+}
+
 Util::Array<Filesystem::MountInformation> FilesystemService::getMountInformation() {
     return filesystem.getMountInformation();
 }
@@ -27,9 +27,14 @@
 
 namespace Filesystem {
 class Node;
+
+namespace Pipe {
+class PipeDriver;
+}  // namespace Pipe
 }  // namespace Filesystem
 
 namespace Kernel {
+class OpenFile;
 
 class FilesystemService : public Service {
 
@@ -72,10 +77,16 @@ public:
 
     void closeFile(int32_t fileDescriptor);
 
+    int32_t createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor);
+
     Filesystem::Node& getNode(int32_t fileDescriptor);
 
+    OpenFile& getFile(int32_t fileDescriptor);
+
     [[nodiscard]] Filesystem::Filesystem& getFilesystem();
 
+    [[nodiscard]] Filesystem::Pipe::PipeDriver& getPipeDriver();
+
     [[nodiscard]] Util::Array<Filesystem::MountInformation> getMountInformation();
 
     static const constexpr uint8_t SERVICE_ID = 0;
@@ -83,6 +94,7 @@ public:
 private:
 
     Filesystem::Filesystem filesystem;
+    Filesystem::Pipe::PipeDriver *pipeDriver;
 };
 
 }
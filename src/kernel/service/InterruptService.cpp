@@ -93,4 +93,8 @@ Device::Apic &InterruptService::getApic() {
     return *apic;
 }
 
+uint8_t InterruptService::getCpuId() const {
+    return usesApic() ? Device::LocalApic::getId() : 0;
+}
+
 }
\ No newline at end of file
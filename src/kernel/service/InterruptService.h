@@ -77,6 +77,12 @@ public:
 
     [[nodiscard]] Device::Apic& getApic();
 
+    /**
+     * Get the id of the executing CPU (its local APIC id).
+     * If the APIC is not used, only one CPU is running and 0 is returned.
+     */
+    [[nodiscard]] uint8_t getCpuId() const;
+
     static const constexpr uint8_t SERVICE_ID = 1;
 
 private:
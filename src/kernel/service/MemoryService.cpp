@@ -34,11 +34,18 @@
 #include "lib/util/base/Exception.h"
 #include "lib/util/base/HeapMemoryManager.h"
 #include "lib/util/base/System.h"
+#include "device/interrupt/apic/LocalApic.h"
+#include "kernel/file/OpenFile.h"
+#include "kernel/paging/FileMapping.h"
+#include "kernel/paging/SharedSegment.h"
+#include "lib/util/base/Address.h"
+#include "kernel/service/FilesystemService.h"
 
 namespace Kernel {
 
 MemoryService::MemoryService(PageFrameAllocator *pageFrameAllocator, PagingAreaManager *pagingAreaManager, VirtualAddressSpace *kernelAddressSpace)
-        : pageFrameAllocator(*pageFrameAllocator), pagingAreaManager(*pagingAreaManager), currentAddressSpace(kernelAddressSpace), kernelAddressSpace(*kernelAddressSpace) {
+        : pageFrameAllocator(*pageFrameAllocator), pagingAreaManager(*pagingAreaManager), kernelAddressSpace(*kernelAddressSpace) {
+    currentAddressSpaces[0] = kernelAddressSpace;
     addressSpaces.add(kernelAddressSpace);
     lowerMemoryManager.initialize(MemoryLayout::BIOS_CODE_MEMORY.toVirtual().endAddress + 1, MemoryLayout::USABLE_LOWER_MEMORY.toVirtual().endAddress);
     lowerMemoryManager.disableAutomaticUnmapping();
@@ -73,6 +80,34 @@ MemoryService::MemoryService(PageFrameAllocator *pageFrameAllocator, PagingAreaM
         mappedAddress = memoryService.mapIO(physicalAddress, size, false);
         return true;
     });
+
+    SystemCall::registerSystemCall(Util::System::MAP_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 5) {
+            return false;
+        }
+
+        auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
+        auto &filesystemService = Kernel::System::getService<Kernel::FilesystemService>();
+        auto fileDescriptor = va_arg(arguments, int32_t);
+        auto offset = va_arg(arguments, uint32_t);
+        auto length = va_arg(arguments, uint32_t);
+        auto mode = static_cast<Util::Io::File::MapMode>(va_arg(arguments, uint32_t));
+        void *&mappedAddress = *va_arg(arguments, void**);
+
+        mappedAddress = memoryService.mapFile(filesystemService.getFile(fileDescriptor), offset, length, mode);
+        return mappedAddress != nullptr;
+    });
+
+    SystemCall::registerSystemCall(Util::System::UNMAP_FILE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 1) {
+            return false;
+        }
+
+        auto &memoryService = Kernel::System::getService<Kernel::MemoryService>();
+        auto *address = va_arg(arguments, void*);
+
+        return memoryService.unmapFile(address);
+    });
 }
 
 MemoryService::~MemoryService() {
@@ -97,15 +132,15 @@ void MemoryService::freeKernelMemory(void *pointer, uint32_t alignment) {
 }
 
 void *MemoryService::allocateUserMemory(uint32_t size, uint32_t alignment) {
-    return currentAddressSpace->getMemoryManager().allocateMemory(size, alignment);
+    return getCurrentAddressSpace().getMemoryManager().allocateMemory(size, alignment);
 }
 
 void *MemoryService::reallocateUserMemory(void *pointer, uint32_t size, uint32_t alignment) {
-    return currentAddressSpace->getMemoryManager().reallocateMemory(pointer, size, alignment);
+    return getCurrentAddressSpace().getMemoryManager().reallocateMemory(pointer, size, alignment);
 }
 
 void MemoryService::freeUserMemory(void *pointer, uint32_t alignment) {
-    currentAddressSpace->getMemoryManager().freeMemory(pointer, alignment);
+    getCurrentAddressSpace().getMemoryManager().freeMemory(pointer, alignment);
 }
 
 void *MemoryService::allocateLowerMemory(uint32_t size, uint32_t alignment) {
@@ -152,7 +187,9 @@ void Kernel::MemoryService::mapPhysicalAddress(uint32_t virtualAddress, uint32_t
     // Mark the physical page frame as used
     physicalAddress = reinterpret_cast<uint32_t>(pageFrameAllocator.allocateBlockAtAddress(reinterpret_cast<void*>(physicalAddress)));
     // Map the page into the directory
-    currentAddressSpace->getPageDirectory().map(physicalAddress, virtualAddress, flags);
+    pagingLock.acquire();
+    getCurrentAddressSpace().getPageDirectory().map(physicalAddress, virtualAddress, flags);
+    pagingLock.release();
 }
 
 void Kernel::MemoryService::mapRange(uint32_t virtualStartAddress, uint32_t virtualEndAddress, uint16_t flags) {
@@ -171,23 +208,24 @@ void Kernel::MemoryService::map(uint32_t virtualAddress, uint16_t flags) {
     // Allocate a physical page frame where the page should be mapped
     const auto physicalAddress = reinterpret_cast<uint32_t>(pageFrameAllocator.allocateBlock());
     // Map the page into the directory
-    currentAddressSpace->getPageDirectory().map(physicalAddress, virtualAddress, flags);
+    pagingLock.acquire();
+    getCurrentAddressSpace().getPageDirectory().map(physicalAddress, virtualAddress, flags);
+    pagingLock.release();
 }
 
 uint32_t Kernel::MemoryService::unmap(uint32_t virtualAddress) {
-    uint32_t physAddress = currentAddressSpace->getPageDirectory().unmap(virtualAddress);
+    pagingLock.acquire();
+    uint32_t physAddress = getCurrentAddressSpace().getPageDirectory().unmap(virtualAddress);
+    pagingLock.release();
+
     if (!physAddress) {
         return 0;
     }
 
+    // Invalidate entry in TLB (on all CPUs), before the page frame may be reused
+    invalidateTlbEntry(virtualAddress);
     pageFrameAllocator.freeBlock(reinterpret_cast<void*>(physAddress));
 
-    // Invalidate entry in TLB
-    asm volatile("push %%edx;"
-                 "movl %0,%%edx;"
-                 "invlpg (%%edx);"
-                 "pop %%edx;"  : : "r"(virtualAddress));
-
     return physAddress;
 }
 
@@ -240,7 +278,7 @@ void *Kernel::MemoryService::mapIO(uint32_t physicalAddress, uint32_t size, bool
     pageCnt += (size % Kernel::Paging::PAGESIZE == 0) ? 0 : 1;
 
     // Allocate 4 KiB aligned virtual memory
-    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : currentAddressSpace->getMemoryManager();
+    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : getCurrentAddressSpace().getMemoryManager();
     void *virtualStartAddress = manager.allocateMemory(pageCnt * Kernel::Paging::PAGESIZE, Kernel::Paging::PAGESIZE);
 
     // Map the allocated virtual memory to physical addresses
@@ -265,67 +303,206 @@ void *MemoryService::mapIO(uint32_t size, bool mapToKernelHeap) {
     uint32_t pageCnt = size / Kernel::Paging::PAGESIZE;
     pageCnt += (size % Kernel::Paging::PAGESIZE == 0) ? 0 : 1;
 
-    // Allocate block of physical memory
-    void *physicalStartAddress = pageFrameAllocator.allocateBlock();
-    void *currentPhysicalAddress = physicalStartAddress;
-    void *lastPhysicalAddress;
-    bool contiguous;
-
-    do {
-        contiguous = true;
-
-        for (uint32_t i = 1; i < pageCnt; i++) {
-            lastPhysicalAddress = currentPhysicalAddress;
-            currentPhysicalAddress = pageFrameAllocator.allocateBlockAfterAddress(physicalStartAddress);
-
-            if (reinterpret_cast<uint32_t>(currentPhysicalAddress) - reinterpret_cast<uint32_t>(lastPhysicalAddress) != Kernel::Paging::PAGESIZE) {
-                contiguous = false;
-
-                for (uint32_t j = 0; j < i; j++) {
-                    pageFrameAllocator.freeBlock(reinterpret_cast<void *>(reinterpret_cast<uint32_t>(physicalStartAddress) + j * Kernel::Paging::PAGESIZE));
-                }
-
-                physicalStartAddress = currentPhysicalAddress;
-                break;
-            }
-        }
-    } while (!contiguous);
+    // Allocate physically contiguous page frames (e.g. for DMA)
+    void *physicalStartAddress = pageFrameAllocator.allocateContiguousBlocks(pageCnt);
 
     // See mapIO(uint32_t physicalAddress, uint32_t size, bool mapToKernelHeap) for comments
-    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : currentAddressSpace->getMemoryManager();
+    auto &manager = mapToKernelHeap ? kernelAddressSpace.getMemoryManager() : getCurrentAddressSpace().getMemoryManager();
     void *virtualStartAddress = manager.allocateMemory(pageCnt * Kernel::Paging::PAGESIZE, Kernel::Paging::PAGESIZE);
 
     for (uint32_t i = 0; i < pageCnt; i++) {
         uint32_t virtualAddress = reinterpret_cast<uint32_t>(virtualStartAddress) + i * Kernel::Paging::PAGESIZE;
         uint32_t physicalAddress = reinterpret_cast<uint32_t>(physicalStartAddress) + i * Kernel::Paging::PAGESIZE;
         unmap(virtualAddress);
-        currentAddressSpace->getPageDirectory().map(physicalAddress, virtualAddress, Paging::PRESENT | Paging::READ_WRITE | Paging::CACHE_DISABLE | (virtualAddress < Kernel::MemoryLayout::KERNEL_START ? Paging::USER_ACCESS : 0));
+
+        pagingLock.acquire();
+        getCurrentAddressSpace().getPageDirectory().map(physicalAddress, virtualAddress, Paging::PRESENT | Paging::READ_WRITE | Paging::CACHE_DISABLE | (virtualAddress < Kernel::MemoryLayout::KERNEL_START ? Paging::USER_ACCESS : 0));
+        pagingLock.release();
     }
 
     return virtualStartAddress;
 }
 
+void *MemoryService::mapFile(OpenFile &file, uint32_t offset, uint32_t length, Util::Io::File::MapMode mode) {
+    auto &addressSpace = getCurrentAddressSpace();
+    if (addressSpace.isKernelAddressSpace() || file.getType() != Util::Io::File::REGULAR) {
+        return nullptr;
+    }
+
+    auto fileLength = file.getNode().getLength();
+    if (offset >= fileLength || length == 0) {
+        return nullptr;
+    }
+
+    if (offset + length > fileLength || offset + length < offset) {
+        length = fileLength - offset;
+    }
+
+    // Reserve virtual memory in the process' heap
+    auto size = FileMapping::calculateSize(file, offset, length);
+    auto startAddress = reinterpret_cast<uint32_t>(allocateUserMemory(size, Paging::PAGESIZE));
+    if (startAddress == 0) {
+        return nullptr;
+    }
+
+    // The heap may have already mapped some of these pages (e.g. for its own bookkeeping),
+    // but they need to be populated from the file on first access
+    unmap(startAddress, startAddress + size - 1);
+
+    auto *mapping = new FileMapping(startAddress, file, offset, length, mode);
+    addressSpace.addFileMapping(mapping);
+
+    return reinterpret_cast<void*>(mapping->getMappedAddress());
+}
+
+bool MemoryService::mapFileAt(uint32_t address, OpenFile &file, uint32_t offset, uint32_t length, uint32_t size, Util::Io::File::MapMode mode, const Util::String &path) {
+    auto &addressSpace = getCurrentAddressSpace();
+    if (addressSpace.isKernelAddressSpace() || file.getType() != Util::Io::File::REGULAR) {
+        return false;
+    }
+
+    if (address % Paging::PAGESIZE != 0 || size == 0 || size < length || address + size < address || address + size > Kernel::MemoryLayout::KERNEL_START) {
+        return false;
+    }
+
+    auto alignedSize = Util::Address<uint32_t>(size).alignUp(Paging::PAGESIZE).get();
+    auto *mapping = new FileMapping(address, file, offset, length, alignedSize, mode);
+    if (!path.isEmpty()) {
+        mapping->setSharedSegment(acquireSharedSegment(path, offset, length, alignedSize));
+    }
+
+    addressSpace.addFileMapping(mapping);
+    return true;
+}
+
+void MemoryService::releaseSharedSegment(SharedSegment &segment) {
+    // Releasing under the lock ensures, that a segment without references is never found again by acquireSharedSegment()
+    sharedSegmentLock.acquire();
+    if (!segment.release()) {
+        sharedSegmentLock.release();
+        return;
+    }
+
+    sharedSegments.remove(&segment);
+    sharedSegmentLock.release();
+
+    for (auto frame : segment.getFrames()) {
+        if (frame != 0) {
+            pageFrameAllocator.freeBlock(reinterpret_cast<void*>(frame));
+        }
+    }
+
+    delete &segment;
+}
+
+void MemoryService::invalidateSharedSegments(const Util::String &path) {
+    // An invalidated segment is deleted by releaseSharedSegment(), once its last mapping has been removed
+    sharedSegmentLock.acquire();
+    for (uint32_t i = 0; i < sharedSegments.size();) {
+        if (sharedSegments.get(i)->getPath() == path) {
+            sharedSegments.removeIndex(i);
+        } else {
+            i++;
+        }
+    }
+
+    sharedSegmentLock.release();
+}
+
+SharedSegment& MemoryService::acquireSharedSegment(const Util::String &path, uint32_t offset, uint32_t length, uint32_t size) {
+    sharedSegmentLock.acquire();
+    for (auto *segment : sharedSegments) {
+        if (segment->matches(path, offset, length, size)) {
+            segment->retain();
+            return sharedSegmentLock.releaseAndReturn<SharedSegment&>(*segment);
+        }
+    }
+
+    auto *segment = new SharedSegment(path, offset, length, size);
+    sharedSegments.add(segment);
+    return sharedSegmentLock.releaseAndReturn<SharedSegment&>(*segment);
+}
+
+bool MemoryService::unmapFile(void *address) {
+    auto &addressSpace = getCurrentAddressSpace();
+    auto *mapping = addressSpace.removeFileMapping(reinterpret_cast<uint32_t>(address));
+    if (mapping == nullptr) {
+        return false;
+    }
+
+    auto &pageDirectory = addressSpace.getPageDirectory();
+    auto startAddress = mapping->getStartAddress();
+    for (uint32_t pageAddress = startAddress; pageAddress < startAddress + mapping->getSize(); pageAddress += Paging::PAGESIZE) {
+        pagingLock.acquire();
+        if ((pageDirectory.getPageFlags(pageAddress) & Paging::DO_NOT_UNMAP) != 0) {
+            // Page is borrowed from the file's memory -> Remove the mapping, but do not free the page frame
+            pageDirectory.unsetPageFlags(pageAddress, Paging::DO_NOT_UNMAP);
+            pageDirectory.unmap(pageAddress);
+            pagingLock.release();
+            invalidateTlbEntry(pageAddress);
+        } else {
+            pagingLock.release();
+            unmap(pageAddress);
+        }
+    }
+
+    if (!mapping->isFixed()) {
+        freeUserMemory(reinterpret_cast<void*>(startAddress), Paging::PAGESIZE);
+    }
+
+    delete mapping;
+
+    return true;
+}
+
 VirtualAddressSpace& MemoryService::createAddressSpace() {
     auto addressSpace = new VirtualAddressSpace(kernelAddressSpace.getPageDirectory());
-    addressSpaces.add(addressSpace);
 
+    pagingLock.acquire();
+    for (const auto &page : globalUserPages) {
+        addressSpace->getPageDirectory().map(page.second, page.first, Paging::PRESENT | Paging::USER_ACCESS | Paging::DO_NOT_UNMAP);
+    }
+    pagingLock.release();
+
+    addressSpaces.add(addressSpace);
     return *addressSpace;
 }
 
+void MemoryService::mapGlobalUserPage(void *kernelPage, uint32_t userAddress) {
+    if (reinterpret_cast<uint32_t>(kernelPage) % Paging::PAGESIZE != 0 || userAddress % Paging::PAGESIZE != 0 || userAddress >= MemoryLayout::KERNEL_START) {
+        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "MemoryService: Global user pages must be page aligned and reside in user space!");
+    }
+
+    auto physicalAddress = reinterpret_cast<uint32_t>(getPhysicalAddress(kernelPage));
+
+    pagingLock.acquire();
+    globalUserPages.add(Util::Pair<uint32_t, uint32_t>(userAddress, physicalAddress));
+    for (auto *addressSpace : addressSpaces) {
+        auto &pageDirectory = addressSpace->getPageDirectory();
+        if (!addressSpace->isKernelAddressSpace() && pageDirectory.getPageFlags(userAddress) == 0) {
+            pageDirectory.map(physicalAddress, userAddress, Paging::PRESENT | Paging::USER_ACCESS | Paging::DO_NOT_UNMAP);
+        }
+    }
+    pagingLock.release();
+}
+
 void MemoryService::switchAddressSpace(VirtualAddressSpace &addressSpace) {
+    auto *&currentAddressSpace = currentAddressSpaces[getCurrentCpuId()];
     if (currentAddressSpace == &addressSpace) {
         return;
     }
 
-    // Set current address space
+    // Set current address space (for the executing CPU)
     currentAddressSpace = &addressSpace;
     // load cr3-register with phys. address of Page Directory
     load_page_directory(addressSpace.getPageDirectory().getPageDirectoryPhysicalAddress());
 }
 
 void MemoryService::removeAddressSpace(VirtualAddressSpace &addressSpace) {
-    if (currentAddressSpace == &addressSpace) {
-        Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "MemoryService: Trying to delete the currently active address space!");
+    for (const auto *currentAddressSpace : currentAddressSpaces) {
+        if (currentAddressSpace == &addressSpace) {
+            Util::Exception::throwException(Util::Exception::INVALID_ARGUMENT, "MemoryService: Trying to delete the currently active address space!");
+        }
     }
 
     addressSpaces.remove(&addressSpace);
@@ -333,14 +510,21 @@ void MemoryService::removeAddressSpace(VirtualAddressSpace &addressSpace) {
 }
 
 void* MemoryService::getPhysicalAddress(void *virtualAddress) {
-    return currentAddressSpace->getPageDirectory().getPhysicalAddress(virtualAddress);
+    return getCurrentAddressSpace().getPageDirectory().getPhysicalAddress(virtualAddress);
 }
 
 void MemoryService::plugin() {
-    System::getService<Kernel::InterruptService>().assignInterrupt(InterruptVector::PAGE_FAULT, *this);
+    auto &interruptService = System::getService<Kernel::InterruptService>();
+    interruptService.assignInterrupt(InterruptVector::PAGE_FAULT, *this);
+    interruptService.assignInterrupt(InterruptVector::TLB_SHOOTDOWN, *this);
 }
 
 void MemoryService::trigger(const Kernel::InterruptFrame &frame) {
+    if (frame.interrupt == InterruptVector::TLB_SHOOTDOWN) {
+        handlePendingTlbShootdown();
+        return;
+    }
+
     // Get page fault address and flags
     uint32_t faultAddress = 0;
     // The faulted linear address is loaded in the cr2 register
@@ -351,21 +535,284 @@ void MemoryService::trigger(const Kernel::InterruptFrame &frame) {
         Util::Exception::throwException(Util::Exception::NULL_POINTER, "Page fault at address 0x00000000!");
     }
 
+    // Writing to a copy-on-write page (error code: present and write access) replaces it with a private copy
+    if (faultAddress < Kernel::MemoryLayout::KERNEL_START && (frame.error & 0x00000003u) == 0x00000003u) {
+        if (handleCopyOnWriteFault(faultAddress & 0xFFFFF000)) {
+            return;
+        }
+    }
+
+    // Pages of file mappings are populated from their file
+    if (faultAddress < Kernel::MemoryLayout::KERNEL_START) {
+        auto *mapping = getCurrentAddressSpace().findFileMapping(faultAddress);
+        if (mapping != nullptr) {
+            handleFileMappingFault(*mapping, faultAddress, frame.error);
+            return;
+        }
+    }
+
     // check if page fault was caused by illegal page access
     if ((frame.error & 0x00000001u) > 0) {
         Util::Exception::throwException(Util::Exception::ILLEGAL_PAGE_ACCESS, "Privilege level not sufficient to access page!");
     }
 
-    // Map the faulted Page
-    map(faultAddress, Paging::PRESENT | Paging::READ_WRITE | (faultAddress < Kernel::MemoryLayout::KERNEL_START ? Paging::USER_ACCESS : 0));
+    // Map the faulted Page. Another CPU may have mapped it in the meantime (e.g. a kernel heap page),
+    // so the page directory needs to be checked again, after the paging lock has been acquired.
+    auto &pageDirectory = getCurrentAddressSpace().getPageDirectory();
+    auto *physicalAddress = pageFrameAllocator.allocateBlock();
+
+    pagingLock.acquire();
+    if (pageDirectory.getPhysicalAddress(reinterpret_cast<void*>(faultAddress)) != nullptr) {
+        pagingLock.release();
+        pageFrameAllocator.freeBlock(physicalAddress);
+        return;
+    }
+
+    pageDirectory.map(reinterpret_cast<uint32_t>(physicalAddress), faultAddress, Paging::PRESENT | Paging::READ_WRITE | (faultAddress < Kernel::MemoryLayout::KERNEL_START ? Paging::USER_ACCESS : 0));
+    pagingLock.release();
     // TODO: Check other Faults
 }
 
+void MemoryService::handleFileMappingFault(FileMapping &mapping, uint32_t faultAddress, uint32_t error) {
+    auto &pageDirectory = getCurrentAddressSpace().getPageDirectory();
+    auto pageAddress = faultAddress & 0xFFFFF000;
+    auto present = (error & 0x00000001u) != 0;
+    auto write = (error & 0x00000002u) != 0;
+
+    if (!present) {
+        if (mapping.isZeroCopy()) {
+            // Map the file's memory directly. The frame is not owned by the process, so it must never be freed on unmapping.
+            auto physicalAddress = reinterpret_cast<uint32_t>(getPhysicalAddress(reinterpret_cast<void*>(mapping.getMemoryPage(pageAddress))));
+            pagingLock.acquire();
+            if (pageDirectory.getPageFlags(pageAddress) == 0) {
+                pageDirectory.map(physicalAddress & 0xFFFFF000, pageAddress, Paging::PRESENT | Paging::USER_ACCESS | Paging::DO_NOT_UNMAP);
+            }
+            pagingLock.release();
+            return;
+        }
+
+        auto *segment = mapping.getSharedSegment();
+        auto pageIndex = (pageAddress - mapping.getStartAddress()) / Paging::PAGESIZE;
+        auto sharedFlags = Paging::PRESENT | Paging::USER_ACCESS | (mapping.getMode() == Util::Io::File::COPY_ON_WRITE ? Paging::COPY_ON_WRITE : 0);
+        if (segment != nullptr) {
+            auto sharedFrame = segment->getFrame(pageIndex);
+            if (sharedFrame != 0) {
+                // Another process has already loaded this page -> Use its frame (the segment keeps it alive meanwhile)
+                static_cast<void>(pageFrameAllocator.allocateBlockAtAddress(reinterpret_cast<void*>(sharedFrame)));
+                pagingLock.acquire();
+                if (pageDirectory.getPageFlags(pageAddress) != 0) {
+                    pagingLock.release();
+                    pageFrameAllocator.freeBlock(reinterpret_cast<void*>(sharedFrame));
+                    return;
+                }
+
+                pageDirectory.map(sharedFrame, pageAddress, sharedFlags);
+                pagingLock.release();
+                return;
+            }
+        }
+
+        auto *physicalAddress = pageFrameAllocator.allocateBlock();
+        pagingLock.acquire();
+        if (pageDirectory.getPageFlags(pageAddress) != 0) {
+            pagingLock.release();
+            pageFrameAllocator.freeBlock(physicalAddress);
+            return;
+        }
+
+        // The page is only accessible by the kernel, until it has been filled.
+        // User threads touching it in the meantime fault again, until it is ready.
+        pageDirectory.map(reinterpret_cast<uint32_t>(physicalAddress), pageAddress, Paging::PRESENT | Paging::READ_WRITE);
+        pagingLock.release();
+
+        mapping.loadPage(pageAddress);
+
+        // Publish the page for other processes. If another process was faster, this process just keeps its private copy.
+        auto shared = segment != nullptr && segment->setFrame(pageIndex, reinterpret_cast<uint32_t>(physicalAddress));
+        if (shared) {
+            static_cast<void>(pageFrameAllocator.allocateBlockAtAddress(physicalAddress));
+        }
+
+        pagingLock.acquire();
+        if (shared) {
+            pageDirectory.unsetPageFlags(pageAddress, Paging::READ_WRITE);
+            pageDirectory.setPageFlags(pageAddress, sharedFlags);
+        } else {
+            pageDirectory.setPageFlags(pageAddress, Paging::USER_ACCESS);
+            if (mapping.getMode() == Util::Io::File::READ_ONLY) {
+                pageDirectory.unsetPageFlags(pageAddress, Paging::READ_WRITE);
+            }
+        }
+        pagingLock.release();
+
+        invalidateTlbEntry(pageAddress);
+        return;
+    }
+
+    auto flags = pageDirectory.getPageFlags(pageAddress);
+    if ((flags & Paging::USER_ACCESS) == 0) {
+        // Page is currently being filled by another thread -> Retry
+        return;
+    }
+
+    if (write && mapping.getMode() == Util::Io::File::COPY_ON_WRITE && (flags & Paging::DO_NOT_UNMAP) != 0) {
+        // First write to a borrowed page -> Replace it with a private copy
+        auto *copy = new uint8_t[Paging::PAGESIZE];
+        Util::Address<uint32_t>(copy).copyRange(Util::Address<uint32_t>(pageAddress), Paging::PAGESIZE);
+        auto *physicalAddress = pageFrameAllocator.allocateBlock();
+
+        pagingLock.acquire();
+        if ((pageDirectory.getPageFlags(pageAddress) & Paging::DO_NOT_UNMAP) == 0) {
+            // Another thread has already copied the page
+            pagingLock.release();
+            pageFrameAllocator.freeBlock(physicalAddress);
+            delete[] copy;
+            return;
+        }
+
+        pageDirectory.unsetPageFlags(pageAddress, Paging::DO_NOT_UNMAP);
+        pageDirectory.unmap(pageAddress);
+        pageDirectory.map(reinterpret_cast<uint32_t>(physicalAddress), pageAddress, Paging::PRESENT | Paging::READ_WRITE);
+        pagingLock.release();
+        invalidateTlbEntry(pageAddress);
+
+        Util::Address<uint32_t>(pageAddress).copyRange(Util::Address<uint32_t>(copy), Paging::PAGESIZE);
+        delete[] copy;
+
+        pagingLock.acquire();
+        pageDirectory.setPageFlags(pageAddress, Paging::USER_ACCESS);
+        pagingLock.release();
+        return;
+    }
+
+    Util::Exception::throwException(Util::Exception::ILLEGAL_PAGE_ACCESS, "Write access to a read-only file mapping!");
+}
+
+bool MemoryService::handleCopyOnWriteFault(uint32_t pageAddress) {
+    auto &pageDirectory = getCurrentAddressSpace().getPageDirectory();
+
+    pagingLock.acquire();
+    auto flags = pageDirectory.getPageFlags(pageAddress);
+    if ((flags & Paging::COPY_ON_WRITE) == 0) {
+        pagingLock.release();
+        return false;
+    }
+
+    if ((flags & Paging::USER_ACCESS) == 0) {
+        // Page is currently being copied by another thread -> Retry
+        pagingLock.release();
+        return true;
+    }
+
+    auto *oldFrame = pageDirectory.getPhysicalAddress(reinterpret_cast<void*>(pageAddress));
+    if (pageFrameAllocator.getUseCount(oldFrame) == 1) {
+        // No one else uses the frame anymore (any sharer would hold its own reference) -> Take it over
+        pageDirectory.unsetPageFlags(pageAddress, Paging::COPY_ON_WRITE);
+        pageDirectory.setPageFlags(pageAddress, Paging::READ_WRITE);
+        pagingLock.release();
+        invalidateTlbEntry(pageAddress);
+        return true;
+    }
+
+    // Hide the page from user threads, while it is being copied (they fault and retry until it is ready)
+    pageDirectory.unsetPageFlags(pageAddress, Paging::USER_ACCESS);
+    pagingLock.release();
+    invalidateTlbEntry(pageAddress);
+
+    auto *copy = new uint8_t[Paging::PAGESIZE];
+    Util::Address<uint32_t>(copy).copyRange(Util::Address<uint32_t>(pageAddress), Paging::PAGESIZE);
+    auto *newFrame = pageFrameAllocator.allocateBlock();
+
+    pagingLock.acquire();
+    pageDirectory.unmap(pageAddress);
+    pageDirectory.map(reinterpret_cast<uint32_t>(newFrame), pageAddress, Paging::PRESENT | Paging::READ_WRITE | Paging::COPY_ON_WRITE);
+    pagingLock.release();
+    invalidateTlbEntry(pageAddress);
+
+    Util::Address<uint32_t>(pageAddress).copyRange(Util::Address<uint32_t>(copy), Paging::PAGESIZE);
+    delete[] copy;
+
+    pagingLock.acquire();
+    pageDirectory.unsetPageFlags(pageAddress, Paging::COPY_ON_WRITE);
+    pageDirectory.setPageFlags(pageAddress, Paging::USER_ACCESS);
+    pagingLock.release();
+
+    pageFrameAllocator.freeBlock(oldFrame);
+    return true;
+}
+
+void MemoryService::handlePendingTlbShootdown() {
+    auto cpuId = getCurrentCpuId();
+    if (tlbShootdownPending[cpuId]) {
+        invalidateLocalTlbEntry(tlbShootdownAddress);
+        tlbShootdownPending[cpuId] = false;
+    }
+}
+
+void MemoryService::invalidateTlbEntry(uint32_t virtualAddress) {
+    invalidateLocalTlbEntry(virtualAddress);
+
+    auto cpuId = getCurrentCpuId();
+    auto *addressSpace = currentAddressSpaces[cpuId];
+    auto kernelAddress = virtualAddress >= MemoryLayout::KERNEL_START;
+
+    // Kernel pages are mapped in every address space, while user pages may only be cached by CPUs using the same address space
+    bool shootdownNeeded = false;
+    for (uint32_t i = 0; i < MAX_CPU_COUNT; i++) {
+        if (i != cpuId && currentAddressSpaces[i] != nullptr && (kernelAddress || currentAddressSpaces[i] == addressSpace)) {
+            shootdownNeeded = true;
+            break;
+        }
+    }
+
+    if (!shootdownNeeded) {
+        return;
+    }
+
+    // Keep handling shootdowns, requested by other CPUs, while waiting (they may be waiting for us)
+    while (!tlbShootdownLock.tryAcquire()) {
+        handlePendingTlbShootdown();
+    }
+
+    tlbShootdownAddress = virtualAddress;
+    for (uint32_t i = 0; i < MAX_CPU_COUNT; i++) {
+        if (i != cpuId && currentAddressSpaces[i] != nullptr && (kernelAddress || currentAddressSpaces[i] == addressSpace)) {
+            tlbShootdownPending[i] = true;
+            Device::LocalApic::sendFixedInterProcessorInterrupt(i, InterruptVector::TLB_SHOOTDOWN);
+        }
+    }
+
+    for (uint32_t i = 0; i < MAX_CPU_COUNT; i++) {
+        while (tlbShootdownPending[i]) {
+            asm volatile ("pause");
+        }
+    }
+
+    tlbShootdownLock.release();
+}
+
+void MemoryService::invalidateLocalTlbEntry(uint32_t virtualAddress) {
+    asm volatile("push %%edx;"
+                 "movl %0,%%edx;"
+                 "invlpg (%%edx);"
+                 "pop %%edx;"  : : "r"(virtualAddress));
+}
+
+uint8_t MemoryService::getCurrentCpuId() {
+    return System::isServiceRegistered(InterruptService::SERVICE_ID) ? System::getService<InterruptService>().getCpuId() : 0;
+}
+
 MemoryService::MemoryStatus MemoryService::getMemoryStatus() {
-    return {pageFrameAllocator.getTotalMemory(), pageFrameAllocator.getFreeMemory(),
+    MemoryStatus status = {pageFrameAllocator.getTotalMemory(), pageFrameAllocator.getFreeMemory(),
             lowerMemoryManager.getTotalMemory(), lowerMemoryManager.getFreeMemory(),
             kernelAddressSpace.getMemoryManager().getTotalMemory(), kernelAddressSpace.getMemoryManager().getFreeMemory(),
-            pagingAreaManager.getTotalMemory(), pagingAreaManager.getFreeMemory()};
+            pagingAreaManager.getTotalMemory(), pagingAreaManager.getFreeMemory(), {}};
+
+    for (uint8_t order = 0; order <= BuddyMemoryManager::MAX_ORDER; order++) {
+        status.freePhysicalRuns[order] = pageFrameAllocator.getFreeRunCount(order);
+    }
+
+    return status;
 }
 
 VirtualAddressSpace& MemoryService::getKernelAddressSpace() const {
@@ -373,7 +820,7 @@ VirtualAddressSpace& MemoryService::getKernelAddressSpace() const {
 }
 
 VirtualAddressSpace &MemoryService::getCurrentAddressSpace() const {
-    return *currentAddressSpace;
+    return *currentAddressSpaces[getCurrentCpuId()];
 }
 
 }
\ No newline at end of file
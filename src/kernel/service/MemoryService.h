@@ -28,8 +28,16 @@
 #include "lib/util/collection/Iterator.h"
 #include "lib/util/base/FreeListMemoryManager.h"
 #include "kernel/paging/VirtualAddressSpace.h"
+#include "kernel/memory/BuddyMemoryManager.h"
+#include "lib/util/async/Spinlock.h"
+#include "lib/util/io/file/File.h"
+#include "lib/util/base/String.h"
+#include "lib/util/collection/Pair.h"
 
 namespace Kernel {
+class FileMapping;
+class SharedSegment;
+class OpenFile;
 class PageDirectory;
 class PageFrameAllocator;
 class PagingAreaManager;
@@ -51,6 +59,7 @@ public:
         uint32_t freeKernelHeapMemory;
         uint32_t totalPagingAreaMemory;
         uint32_t freePagingAreaMemory;
+        uint32_t freePhysicalRuns[BuddyMemoryManager::MAX_ORDER + 1];
     };
 
     /**
@@ -166,6 +175,62 @@ public:
      */
     void *mapIO(uint32_t size, bool mapToKernelHeap = true);
 
+    /**
+     * Map a range of an open file into the current address space. Pages are populated on first access.
+     * Files, that reside in memory (e.g. inside the initial ramdisk) are mapped without copying. Writing to a
+     * copy-on-write mapping of such a file copies the affected page first.
+     *
+     * @param file The file to map
+     * @param offset The file offset of the first mapped byte
+     * @param length The amount of bytes to map (truncated at the end of the file)
+     * @param mode Whether the mapping is read-only or copy-on-write
+     *
+     * @return The address of the first mapped byte (or nullptr on failure). Is not necessarily page aligned.
+     */
+    void* mapFile(OpenFile &file, uint32_t offset, uint32_t length, Util::Io::File::MapMode mode);
+
+    /**
+     * Map a range of an open file at a fixed address into the current address space, without reserving it in the user heap.
+     * This is used for program segments, which reside below the heap. Pages are populated on first access and
+     * memory behind the file range is zero filled. The range must not overlap any other file mapping.
+     * If a path is given, loaded pages are shared with all processes, that map the same range of the same binary.
+     * Shared pages of copy-on-write mappings are copied on the first write access.
+     *
+     * @param address The page aligned virtual start address
+     * @param file The file to map
+     * @param offset The file offset of the byte, that is mapped at the start address
+     * @param length The amount of bytes to map from the file
+     * @param size The total amount of mapped memory (at least length)
+     * @param mode Whether the mapping is read-only or copy-on-write
+     * @param path The path of the mapped binary (empty for private pages)
+     *
+     * @return true on success
+     */
+    bool mapFileAt(uint32_t address, OpenFile &file, uint32_t offset, uint32_t length, uint32_t size, Util::Io::File::MapMode mode, const Util::String &path);
+
+    /**
+     * Remove a reference from a shared segment. After the last reference is gone,
+     * the segment gives back its references on the loaded page frames.
+     */
+    void releaseSharedSegment(SharedSegment &segment);
+
+    /**
+     * Stop sharing the loaded pages of a binary, because its content has changed.
+     * Existing mappings keep their segments, but new mappings of the binary load its pages again.
+     *
+     * @param path The canonical path of the binary
+     */
+    void invalidateSharedSegments(const Util::String &path);
+
+    /**
+     * Remove a file mapping from the current address space.
+     *
+     * @param address The address, that has been returned by mapFile()
+     *
+     * @return true on success
+     */
+    bool unmapFile(void *address);
+
     /**
      * Unmap a page at a given virtual address.
      *
@@ -202,6 +267,15 @@ public:
      */
     VirtualAddressSpace &createAddressSpace();
 
+    /**
+     * Map a page of kernel memory read-only into every user address space, including the ones created later.
+     * The page frame stays owned by the kernel, so it is never freed, when an address space is destroyed.
+     *
+     * @param kernelPage Page aligned kernel memory
+     * @param userAddress The page aligned user space address, at which the page is mapped
+     */
+    void mapGlobalUserPage(void *kernelPage, uint32_t userAddress);
+
     /**
      * Switch to a given address space.
      *
@@ -226,6 +300,13 @@ public:
      */
     void trigger(const Kernel::InterruptFrame &frame) override;
 
+    /**
+     * Invalidate the TLB entry, that has been requested by another CPU via a TLB shootdown, if there is one pending.
+     * The shootdown IPI does the same, but a CPU that is waiting for a lock with interrupts disabled
+     * needs to poll, so that the requesting CPU does not wait forever.
+     */
+    void handlePendingTlbShootdown();
+
     [[nodiscard]] VirtualAddressSpace& getKernelAddressSpace() const;
 
     [[nodiscard]] VirtualAddressSpace& getCurrentAddressSpace() const;
@@ -234,16 +315,67 @@ public:
 
     static const constexpr uint8_t SERVICE_ID = 2;
 
+    static const constexpr uint32_t MAX_CPU_COUNT = 256;
+
 private:
 
+    /**
+     * Get the id of the executing CPU. Before the APIC has been initialized, only the BSP is running and 0 is returned.
+     */
+    [[nodiscard]] static uint8_t getCurrentCpuId();
+
+    /**
+     * Resolve a page fault inside a file mapping.
+     *
+     * @param mapping The mapping, containing the faulted address
+     * @param faultAddress The faulted address
+     * @param error The error code, pushed by the CPU
+     */
+    void handleFileMappingFault(FileMapping &mapping, uint32_t faultAddress, uint32_t error);
+
+    /**
+     * Resolve a write access to a copy-on-write page by giving the faulting address space a private copy.
+     * If no one else uses the page frame anymore, the page is made writable without copying.
+     *
+     * @return false, if the page is not marked as copy-on-write
+     */
+    bool handleCopyOnWriteFault(uint32_t pageAddress);
+
+    /**
+     * Find the shared segment for a range of a binary and add a reference to it, or create a new one.
+     */
+    SharedSegment& acquireSharedSegment(const Util::String &path, uint32_t offset, uint32_t length, uint32_t size);
+
+    /**
+     * Invalidate a TLB entry on the executing CPU and on every other CPU, that may have cached it.
+     * Must not be called while holding the paging lock, since other CPUs may need it before they can handle the IPI.
+     */
+    void invalidateTlbEntry(uint32_t virtualAddress);
+
+    static void invalidateLocalTlbEntry(uint32_t virtualAddress);
+
     Util::FreeListMemoryManager lowerMemoryManager;
 
     PageFrameAllocator &pageFrameAllocator;
     PagingAreaManager &pagingAreaManager;
 
     Util::ArrayList<VirtualAddressSpace*> addressSpaces;
-    VirtualAddressSpace *currentAddressSpace;
+    VirtualAddressSpace *currentAddressSpaces[MAX_CPU_COUNT]{}; // Indexed by local APIC id, nullptr for CPUs that are not running yet
     VirtualAddressSpace &kernelAddressSpace;
+
+    // Protects the page directories against concurrent modification by multiple CPUs
+    Util::Async::Spinlock pagingLock;
+
+    Util::ArrayList<SharedSegment*> sharedSegments;
+
+    // Pages, that are mapped into every user address space (user address, physical address)
+    Util::ArrayList<Util::Pair<uint32_t, uint32_t>> globalUserPages;
+    Util::Async::Spinlock sharedSegmentLock;
+
+    // Only one TLB shootdown can be in progress at a time
+    Util::Async::Spinlock tlbShootdownLock;
+    volatile uint32_t tlbShootdownAddress = 0;
+    volatile bool tlbShootdownPending[MAX_CPU_COUNT]{};
 };
 
 }
@@ -22,6 +22,7 @@
 #include "kernel/system/SystemCall.h"
 #include "lib/util/hardware/Machine.h"
 #include "kernel/system/System.h"
+#include "kernel/service/StorageService.h"
 #include "device/power/Machine.h"
 #include "lib/util/base/System.h"
 
@@ -52,10 +53,13 @@ PowerManagementService::~PowerManagementService() {
 }
 
 void PowerManagementService::shutdownMachine() {
+    // Write back cached blocks, before the machine is turned off
+    System::getService<StorageService>().getBlockCache().flush();
     machine.shutdown();
 }
 
 void PowerManagementService::rebootMachine() {
+    System::getService<StorageService>().getBlockCache().flush();
     machine.reboot();
 }
 
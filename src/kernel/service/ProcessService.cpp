@@ -144,6 +144,10 @@ void ProcessService::killProcess(Process &process) {
     }
 
     auto &schedulerService = System::getService<SchedulerService>();
+    for (auto *thread : process.getThreads()) {
+        schedulerService.cancelWait(*thread);
+    }
+
     schedulerService.lockScheduler();
     for (auto *thread : process.getThreads()) {
         schedulerService.killWithoutLock(*thread);
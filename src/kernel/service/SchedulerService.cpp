@@ -20,14 +20,17 @@
 #include "kernel/system/System.h"
 #include "SchedulerService.h"
 #include "ProcessService.h"
+#include "InterruptService.h"
 #include "kernel/service/SchedulerService.h"
 #include "device/cpu/Fpu.h"
 #include "kernel/log/Logger.h"
+#include "kernel/process/InterruptEventDispatcher.h"
 #include "kernel/process/Process.h"
 #include "kernel/process/SchedulerCleaner.h"
 #include "kernel/process/Thread.h"
 #include "kernel/service/MemoryService.h"
 #include "kernel/system/SystemCall.h"
+#include "kernel/paging/MemoryLayout.h"
 #include "lib/util/async/Spinlock.h"
 #include "lib/util/base/Address.h"
 #include "lib/util/base/System.h"
@@ -45,13 +48,13 @@ namespace Kernel {
 
 Logger SchedulerService::log = Logger::get("Scheduler");
 
-SchedulerService::SchedulerService() {
+SchedulerService::SchedulerService() : scheduler(getCpuCount()) {
     defaultFpuContext = static_cast<uint8_t*>(System::getService<MemoryService>().allocateKernelMemory(512, 16));
     Util::Address<uint32_t>(defaultFpuContext).setRange(0, 512);
 
     if (Device::Fpu::isAvailable()) {
         log.info("FPU detected -> Enabling FPU context switching");
-        fpu = new Device::Fpu(defaultFpuContext);
+        fpu = new Device::Fpu(defaultFpuContext, getCpuCount());
         fpu->plugin();
     } else {
         log.warn("No FPU present");
@@ -125,6 +128,62 @@ SchedulerService::SchedulerService() {
         System::getService<SchedulerService>().exitCurrentThread();
         return true;
     });
+
+    SystemCall::registerSystemCall(Util::System::FUTEX_WAIT, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto *address = va_arg(arguments, uint32_t*);
+        auto expectedValue = va_arg(arguments, uint32_t);
+        if (reinterpret_cast<uint32_t>(address) >= MemoryLayout::KERNEL_START) {
+            return false;
+        }
+
+        return System::getService<SchedulerService>().futexWait(address, expectedValue);
+    });
+
+    SystemCall::registerSystemCall(Util::System::FUTEX_WAKE, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto *address = va_arg(arguments, uint32_t*);
+        auto count = va_arg(arguments, uint32_t);
+        if (reinterpret_cast<uint32_t>(address) >= MemoryLayout::KERNEL_START) {
+            return false;
+        }
+
+        System::getService<SchedulerService>().futexWake(address, count);
+        return true;
+    });
+
+    SystemCall::registerSystemCall(Util::System::SET_THREAD_PRIORITY, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto &schedulerService = System::getService<SchedulerService>();
+        auto threadId = va_arg(arguments, uint32_t);
+        auto priority = static_cast<Util::Async::Thread::Priority>(va_arg(arguments, uint32_t));
+        if (priority > Util::Async::Thread::HIGH) {
+            return false;
+        }
+
+        auto *thread = schedulerService.getThread(threadId);
+        if (thread == nullptr) {
+            return false;
+        }
+
+        // A process may only change the priority of its own threads (the kernel may change any thread's priority)
+        auto &caller = schedulerService.getCurrentThread().getParent();
+        if (!caller.isKernelProcess() && &thread->getParent() != &caller) {
+            return false;
+        }
+
+        schedulerService.setPriority(*thread, priority);
+        return true;
+    });
 }
 
 void SchedulerService::kickoffThread() {
@@ -137,6 +196,11 @@ void SchedulerService::startScheduler() {
     cleaner = new Kernel::SchedulerCleaner();
     auto &schedulerCleanerThread = Kernel::Thread::createKernelThread("Scheduler-Cleaner", processService.getKernelProcess(), cleaner);
     ready(schedulerCleanerThread);
+
+    interruptEventDispatcher = new Kernel::InterruptEventDispatcher();
+    auto &interruptEventThread = Kernel::Thread::createKernelThread("Interrupt-Events", processService.getKernelProcess(), interruptEventDispatcher);
+    scheduler.interruptEventThread = &interruptEventThread;
+    ready(interruptEventThread);
     
     scheduler.start();
 }
@@ -145,12 +209,20 @@ void SchedulerService::ready(Thread &thread) {
     scheduler.ready(thread);
 }
 
+void SchedulerService::startApplicationProcessor() {
+    if (fpu != nullptr) {
+        Device::Fpu::configureCurrentCpu();
+    }
+
+    scheduler.startApplicationProcessor();
+}
+
 void SchedulerService::lockScheduler() {
-    scheduler.lock.acquire();
+    scheduler.lockCurrentRunQueue();
 }
 
 void SchedulerService::unlockScheduler() {
-    scheduler.lock.release();
+    scheduler.unlockCurrentRunQueue();
 }
 
 void SchedulerService::yield() {
@@ -178,6 +250,25 @@ void SchedulerService::block() {
     scheduler.block();
 }
 
+void SchedulerService::blockAndRelease(Util::Async::Spinlock &lock) {
+    scheduler.blockAndRelease(lock);
+}
+
+bool SchedulerService::futexWait(uint32_t *address, uint32_t expectedValue) {
+    return futexTable.wait(address, expectedValue);
+}
+
+uint32_t SchedulerService::futexWake(uint32_t *address, uint32_t count) {
+    return futexTable.wake(address, count);
+}
+
+void SchedulerService::cancelWait(Thread &thread) {
+    // Futex queues are checked first, because the thread's reference on the futex must be released as well
+    if (!futexTable.cancelWait(thread)) {
+        WaitQueue::removeFromWaitQueue(thread);
+    }
+}
+
 void SchedulerService::unblock(Thread &thread) {
     auto &processService = System::getService<ProcessService>();
     auto &process = thread.getParent();
@@ -188,6 +279,10 @@ void SchedulerService::unblock(Thread &thread) {
     }
 }
 
+void SchedulerService::setPriority(Thread &thread, Util::Async::Thread::Priority priority) {
+    scheduler.setPriority(thread, priority);
+}
+
 void SchedulerService::kill(Thread &thread) {
     scheduler.kill(thread);
 }
@@ -208,4 +303,33 @@ void SchedulerService::sleep(const Util::Time::Timestamp &time) {
     scheduler.sleep(time);
 }
 
+bool SchedulerService::getNextWakeupTime(uint32_t &wakeupTime) {
+    return scheduler.getNextWakeupTime(wakeupTime);
+}
+
+void SchedulerService::queueInterruptEvent(Util::Async::InterruptEvent &event) {
+    scheduler.queueInterruptEvent(event);
+}
+
+Util::Async::InterruptEvent* SchedulerService::takeInterruptEvents() {
+    return scheduler.takeInterruptEvents();
+}
+
+bool SchedulerService::isFpuContextLoaded(const Thread &thread, uint8_t cpuId) const {
+    return fpu != nullptr && fpu->isContextLoaded(thread, cpuId);
+}
+
+uint32_t SchedulerService::getRunQueueCount() const {
+    return scheduler.getCpuCount();
+}
+
+Scheduler::RunQueueStatus SchedulerService::getRunQueueStatus(uint32_t cpuId) const {
+    return scheduler.getRunQueueStatus(cpuId);
+}
+
+uint32_t SchedulerService::getCpuCount() {
+    auto &interruptService = System::getService<InterruptService>();
+    return interruptService.usesApic() ? interruptService.getApic().getCpuCount() : 1;
+}
+
 }
\ No newline at end of file
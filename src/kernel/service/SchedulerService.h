@@ -21,6 +21,7 @@
 #include <cstdint>
 
 #include "kernel/process/Scheduler.h"
+#include "kernel/process/FutexTable.h"
 #include "Service.h"
 
 namespace Device {
@@ -30,9 +31,13 @@ namespace Util {
 namespace Time {
 class Timestamp;
 }  // namespace Time
+namespace Async {
+class InterruptEvent;
+}  // namespace Async
 }  // namespace Util
 
 namespace Kernel {
+class InterruptEventDispatcher;
 class Logger;
 class Process;
 class SchedulerCleaner;
@@ -65,6 +70,12 @@ public:
 
     void startScheduler();
 
+    /**
+     * Start scheduling threads on the executing application processor.
+     * This must be called after the BSP has started the scheduler. It does not return.
+     */
+    [[noreturn]] void startApplicationProcessor();
+
     void ready(Thread &thread);
 
     void yield();
@@ -79,10 +90,39 @@ public:
 
     void block();
 
+    void blockAndRelease(Util::Async::Spinlock &lock);
+
+    bool futexWait(uint32_t *address, uint32_t expectedValue);
+
+    uint32_t futexWake(uint32_t *address, uint32_t count);
+
+    /**
+     * Remove a thread from any wait queue (futex, pipe, ...), in which it is blocked, without waking it up.
+     * Must be called before a blocked thread is freed.
+     */
+    void cancelWait(Thread &thread);
+
     void unblock(Thread &thread);
 
     void sleep(const Util::Time::Timestamp &time);
 
+    /**
+     * Get the system time (in milliseconds) at which the next sleeping thread needs to be woken up.
+     *
+     * @return true, if at least one thread is sleeping (otherwise, 'wakeupTime' is left untouched)
+     */
+    bool getNextWakeupTime(uint32_t &wakeupTime);
+
+    /**
+     * Queue an event, that has been signaled by an interrupt handler, for being dispatched by the interrupt event thread.
+     * Takes no locks, so it may be called from interrupt handlers.
+     */
+    void queueInterruptEvent(Util::Async::InterruptEvent &event);
+
+    [[nodiscard]] Util::Async::InterruptEvent* takeInterruptEvents();
+
+    void setPriority(Thread &thread, Util::Async::Thread::Priority priority);
+
     void kill(Thread &thread);
 
     void killWithoutLock(Thread &thread);
@@ -95,12 +135,26 @@ public:
 
     [[nodiscard]] uint8_t* getDefaultFpuContext();
 
+    [[nodiscard]] bool isFpuContextLoaded(const Thread &thread, uint8_t cpuId) const;
+
+    [[nodiscard]] uint32_t getRunQueueCount() const;
+
+    [[nodiscard]] Scheduler::RunQueueStatus getRunQueueStatus(uint32_t cpuId) const;
+
     static const constexpr uint8_t SERVICE_ID = 4;
 
 private:
 
+    /**
+     * Get the amount of CPUs, which is the amount of run queues needed by the scheduler.
+     * Run queues are indexed by local APIC id, so this is the highest local APIC id + 1.
+     */
+    static uint32_t getCpuCount();
+
     Scheduler scheduler;
+    FutexTable futexTable;
     SchedulerCleaner *cleaner = nullptr;
+    InterruptEventDispatcher *interruptEventDispatcher = nullptr;
     Device::Fpu *fpu = nullptr;
     uint8_t *defaultFpuContext = nullptr;
 
@@ -20,6 +20,8 @@
 #include "device/storage/PartitionHandler.h"
 #include "device/storage/Partition.h"
 #include "device/storage/StorageDevice.h"
+#include "device/storage/queue/BlockRequestQueue.h"
+#include "kernel/multiboot/Multiboot.h"
 #include "kernel/log/Logger.h"
 #include "lib/util/base/Exception.h"
 
@@ -28,7 +30,16 @@ namespace Kernel {
 Logger StorageService::log = Logger::get("Storage");
 Util::HashMap<Util::String, uint32_t> StorageService::nameMap;
 
+StorageService::StorageService() {
+    auto capacity = Multiboot::hasKernelOption("block_cache_size") ?
+            static_cast<uint32_t>(Util::String::parseInt(Multiboot::getKernelOption("block_cache_size"))) : Device::Storage::BlockCache::DEFAULT_CAPACITY;
+    blockCache = new Device::Storage::BlockCache(capacity);
+}
+
 StorageService::~StorageService() {
+    blockCache->flush();
+    delete blockCache;
+
     for (const auto &key : deviceMap.keys()) {
         delete deviceMap.get(key);
     }
@@ -48,6 +59,10 @@ Util::String StorageService::registerDevice(Device::Storage::StorageDevice *devi
     log.info("Registered device [%s]",static_cast<char*>(name));
 
     if (lock.getDepth() == 1) {
+        // Only physical devices get a request queue -> Partitions forward their requests to their parent device's queue
+        auto schedulerName = Multiboot::hasKernelOption("io_scheduler") ? Multiboot::getKernelOption("io_scheduler") : "deadline";
+        device->setRequestQueue(new Device::Storage::BlockRequestQueue(*device, Device::Storage::BlockRequestQueue::createScheduler(schedulerName)));
+
         log.info("Scanning device [%s] for partitions", static_cast<char *>(name));
         auto partitionReader = Device::Storage::PartitionHandler(*device);
         for (const auto &info: partitionReader.readPartitionTable()) {
@@ -73,6 +88,10 @@ Device::Storage::StorageDevice &StorageService::getDevice(const Util::String &de
     return result;
 }
 
+Device::Storage::BlockCache& StorageService::getBlockCache() {
+    return *blockCache;
+}
+
 bool StorageService::isDeviceRegistered(const Util::String &deviceName) {
     lock.acquire();
     auto result = deviceMap.containsKey(deviceName);
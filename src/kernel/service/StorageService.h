@@ -28,6 +28,7 @@
 #include "lib/util/collection/Iterator.h"
 #include "lib/util/base/String.h"
 #include "device/storage/StorageDevice.h"
+#include "device/storage/cache/BlockCache.h"
 
 namespace Kernel {
 class Logger;
@@ -38,7 +39,7 @@ public:
     /**
      * Constructor.
      */
-    StorageService() = default;
+    StorageService();
 
     /**
      * Copy Constructor.
@@ -61,12 +62,15 @@ public:
 
     bool isDeviceRegistered(const Util::String &deviceName);
 
+    Device::Storage::BlockCache& getBlockCache();
+
     static const constexpr uint8_t SERVICE_ID = 5;
 
 private:
 
     Util::Async::ReentrantSpinlock lock;
     Util::HashMap<Util::String, Device::Storage::StorageDevice*> deviceMap;
+    Device::Storage::BlockCache *blockCache;
 
     static Logger log;
     static Util::HashMap<Util::String, uint32_t> nameMap;
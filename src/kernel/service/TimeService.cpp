@@ -25,10 +25,25 @@
 #include "device/time/TimeProvider.h"
 #include "kernel/service/SchedulerService.h"
 #include "lib/util/base/System.h"
+#include "lib/util/base/Constants.h"
+#include "lib/util/hardware/CpuId.h"
+#include "lib/util/time/TimePage.h"
+#include "kernel/service/MemoryService.h"
+#include "kernel/paging/Paging.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/base/operators.h"
 
 namespace Kernel {
 
 TimeService::TimeService(Device::TimeProvider *timeProvider, Device::DateProvider *dateProvider) : timeProvider(timeProvider), dateProvider(dateProvider) {
+    // Processes read the system time from this page without a system call
+    auto &memoryService = System::getService<MemoryService>();
+    auto useTimestampCounter = Util::Hardware::CpuId::isAvailable() && (Util::Hardware::CpuId::getCpuFeatureBits() & Util::Hardware::CpuId::TSC) != 0;
+    auto *page = memoryService.allocateKernelMemory(Paging::PAGESIZE, Paging::PAGESIZE);
+    Util::Address<uint32_t>(page).setRange(0, Paging::PAGESIZE);
+    timePage = new (page) Util::Time::TimePage(useTimestampCounter);
+    memoryService.mapGlobalUserPage(page, Util::USER_SPACE_TIME_PAGE_ADDRESS);
+
     SystemCall::registerSystemCall(Util::System::GET_SYSTEM_TIME, [](uint32_t paramCount, va_list arguments) -> bool {
         if (paramCount < 1) {
             return false;
@@ -71,6 +86,10 @@ TimeService::~TimeService() {
     delete dateProvider;
 }
 
+void TimeService::publishSystemTime(const Util::Time::Timestamp &time) {
+    timePage->update(time);
+}
+
 Util::Time::Timestamp TimeService::getSystemTime() const {
     if (timeProvider != nullptr) {
         return timeProvider->getTime();
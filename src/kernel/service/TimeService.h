@@ -29,6 +29,11 @@ namespace Device {
 class DateProvider;
 class TimeProvider;
 }  // namespace Device
+namespace Util {
+namespace Time {
+class TimePage;
+}  // namespace Time
+}  // namespace Util
 
 namespace Kernel {
 
@@ -63,6 +68,12 @@ public:
 
     void busyWait(const Util::Time::Timestamp &time) const;
 
+    /**
+     * Publish the system time on the time page, which is mapped into every process.
+     * Called by the time provider on every tick.
+     */
+    void publishSystemTime(const Util::Time::Timestamp &time);
+
     static const constexpr uint8_t SERVICE_ID = 6;
 
     Device::Rtc* getRtc();
@@ -71,6 +82,7 @@ private:
 
     Device::TimeProvider *timeProvider;
     Device::DateProvider *dateProvider;
+    Util::Time::TimePage *timePage;
 };
 
 }
@@ -49,6 +49,7 @@
 #include "lib/util/collection/Array.h"
 #include "lib/util/base/FreeListMemoryManager.h"
 #include "lib/util/base/HeapMemoryManager.h"
+#include "lib/util/base/SlabMemoryManager.h"
 #include "device/interrupt/apic/Apic.h"
 
 namespace Kernel {
@@ -58,6 +59,7 @@ bool System::initialized = false;
 Util::Async::Spinlock System::serviceLock;
 Service* System::serviceMap[256]{};
 Util::HeapMemoryManager *System::kernelHeapMemoryManager{};
+Util::HeapMemoryManagerType System::heapMemoryManagerType = Util::SLAB_MEMORY_MANAGER;
 InterruptHandler *System::pagefaultHandler{};
 TaskStateSegment System::taskStateSegment{};
 SystemCall System::systemCall{};
@@ -109,6 +111,8 @@ void System::initializeSystem() {
             log.warn("Failed to initialize APIC -> Falling back to PIC");
         } else {
             interruptService->useApic(apic);
+            // CPUs are now identified by their local APIC id, so the BSP's address space needs to be registered again
+            memoryService->switchAddressSpace(*kernelAddressSpace);
         }
 
         if (apic->isSymmetricMultiprocessingSupported()) {
@@ -163,6 +167,7 @@ void System::initializeSystem() {
 
     // Register memory manager
     Util::Reflection::InstanceFactory::registerPrototype(new Util::FreeListMemoryManager());
+    Util::Reflection::InstanceFactory::registerPrototype(new Util::SlabMemoryManager());
 
     // Register storage service
     registerService(StorageService::SERVICE_ID, new StorageService());
@@ -170,6 +175,10 @@ void System::initializeSystem() {
     // Enable system calls
     log.info("Enabling system calls");
     systemCall.plugin();
+    if (SystemCall::isFastEntrySupported()) {
+        log.info("Enabling fast system calls via sysenter");
+        SystemCall::initializeFastEntry(taskStateSegment);
+    }
 
     // Protect kernel code
     if (!Multiboot::hasKernelOption("debug_port")) {
@@ -327,7 +336,17 @@ Util::HeapMemoryManager& System::initializeKernelHeap() {
         const auto &block = blockMap[i];
 
         if (block.type == Multiboot::HEAP_RESERVED) {
-            static Util::FreeListMemoryManager heapMemoryManager;
+            // The slab allocator is used by default, but the plain free list can still be selected with 'heap_manager=Util::FreeListMemoryManager'.
+            // The option names a prototype, but it cannot be resolved by the InstanceFactory here: The factory keeps its prototypes
+            // in a HashMap and clones them with 'new', so it needs a heap itself. Thus, the option is matched without allocating memory.
+            if (Multiboot::hasEarlyKernelOption("heap_manager", "Util::FreeListMemoryManager")) {
+                heapMemoryManagerType = Util::FREE_LIST_MEMORY_MANAGER;
+                static Util::FreeListMemoryManager heapMemoryManager;
+                heapMemoryManager.initialize(block.virtualStartAddress, Kernel::MemoryLayout::KERNEL_HEAP_END_ADDRESS);
+                return heapMemoryManager;
+            }
+
+            static Util::SlabMemoryManager heapMemoryManager;
             heapMemoryManager.initialize(block.virtualStartAddress, Kernel::MemoryLayout::KERNEL_HEAP_END_ADDRESS);
             return heapMemoryManager;
         }
@@ -337,9 +356,24 @@ Util::HeapMemoryManager& System::initializeKernelHeap() {
 }
 
 TaskStateSegment &System::getTaskStateSegment() {
+    // Application processors use their own TSS, which has been allocated by the APIC during their startup
+    if (isServiceRegistered(InterruptService::SERVICE_ID)) {
+        auto &interruptService = getService<InterruptService>();
+        if (interruptService.usesApic()) {
+            auto *applicationProcessorTss = interruptService.getApic().getCurrentTaskStateSegment();
+            if (applicationProcessorTss != nullptr) {
+                return *applicationProcessorTss;
+            }
+        }
+    }
+
     return taskStateSegment;
 }
 
+Util::HeapMemoryManagerType System::getHeapMemoryManagerType() {
+    return heapMemoryManagerType;
+}
+
 void System::handleEarlyInterrupt(const InterruptFrame &frame) {
     if (frame.interrupt == InterruptVector::PAGE_FAULT) {
         pagefaultHandler->trigger(frame);
@@ -21,6 +21,7 @@
 #include <cstdint>
 
 #include "lib/util/base/Exception.h"
+#include "lib/util/base/Constants.h"
 
 namespace Util {
 class HeapMemoryManager;
@@ -143,6 +144,12 @@ public:
 
     static TaskStateSegment& getTaskStateSegment();
 
+    /**
+     * Get the type of the kernel heap memory manager (selected by the kernel option 'heap_manager').
+     * User space heaps use the same type, so that the option affects the whole system.
+     */
+    static Util::HeapMemoryManagerType getHeapMemoryManagerType();
+
 private:
 
     /**
@@ -161,6 +168,7 @@ private:
 
     static TaskStateSegment taskStateSegment;
     static Util::HeapMemoryManager *kernelHeapMemoryManager;
+    static Util::HeapMemoryManagerType heapMemoryManagerType;
     static InterruptHandler *pagefaultHandler;
     static SystemCall systemCall;
     static Logger log; // Use only after _init() has finished!
@@ -16,11 +16,20 @@
  */
 
 #include "kernel/service/InterruptService.h"
+#include "lib/util/base/Address.h"
 #include "lib/util/base/Exception.h"
 #include "SystemCall.h"
 #include "System.h"
 #include "kernel/interrupt/InterruptDispatcher.h"
 #include "kernel/process/ThreadState.h"
+#include "kernel/paging/MemoryLayout.h"
+#include "kernel/system/TaskStateSegment.h"
+#include "device/cpu/ModelSpecificRegister.h"
+#include "lib/util/hardware/CpuId.h"
+
+extern "C" {
+void fast_system_call_entry();
+}
 
 namespace Kernel {
 
@@ -36,9 +45,47 @@ void SystemCall::registerSystemCall(Util::System::Code code, bool(*func)(uint32_
 
 void SystemCall::plugin() {
     Kernel::System::getService<Kernel::InterruptService>().assignInterrupt(Kernel::InterruptVector::SYSTEM_CALL, *this);
+
+    // Does nothing; used to measure the cost of entering and leaving the kernel
+    registerSystemCall(Util::System::NO_OPERATION, [](uint32_t, va_list) -> bool {
+        return true;
+    });
+
+    registerSystemCall(Util::System::ENTER_SYSTEM_CALL_RING, [](uint32_t paramCount, va_list arguments) -> bool {
+        if (paramCount < 2) {
+            return false;
+        }
+
+        auto *ring = va_arg(arguments, Util::SystemCallRing::Header*);
+        auto &executed = *va_arg(arguments, uint32_t*);
+
+        // The ring and its entries must reside in user space
+        if (reinterpret_cast<uint32_t>(ring) + sizeof(Util::SystemCallRing::Header) > MemoryLayout::KERNEL_START) {
+            return false;
+        }
+
+        // Other threads of the process may change the header at any time -> Validate and use kernel copies only
+        uint32_t mask = ring->mask;
+        auto *submissions = ring->submissions;
+        auto *completions = ring->completions;
+        asm volatile ("" ::: "memory");
+
+        auto entries = static_cast<uint64_t>(mask) + 1;
+        if (reinterpret_cast<uint32_t>(submissions) + entries * sizeof(Util::SystemCallRing::Submission) > MemoryLayout::KERNEL_START ||
+            reinterpret_cast<uint32_t>(completions) + entries * sizeof(Util::SystemCallRing::Completion) > MemoryLayout::KERNEL_START) {
+            return false;
+        }
+
+        executed = processRing(*ring, mask, submissions, completions);
+        return true;
+    });
 }
 
 void SystemCall::trigger(const Kernel::InterruptFrame &frame) {
+    dispatch(frame);
+}
+
+void SystemCall::dispatch(const Kernel::InterruptFrame &frame) {
     uint16_t code = frame.eax & 0x000000ff;
     uint16_t paramCount = frame.eax >> 8;
     auto params = reinterpret_cast<va_list>(frame.ebx);
@@ -47,4 +94,44 @@ void SystemCall::trigger(const Kernel::InterruptFrame &frame) {
     result = systemCalls[code](paramCount, params);
 }
 
+uint32_t SystemCall::processRing(Util::SystemCallRing::Header &ring, uint32_t mask, Util::SystemCallRing::Submission *submissions, Util::SystemCallRing::Completion *completions) {
+    uint32_t executed = 0;
+    // The indices are still read from user space, but they are only used masked with the validated copy of the mask
+    while (ring.submissionHead != ring.submissionTail && ring.completionTail - ring.completionHead <= mask) {
+        // Copy the submission once, so that the program cannot change it while it is being checked and executed
+        Util::SystemCallRing::Submission submission{};
+        Util::Address<uint32_t>(&submission).copyRange(Util::Address<uint32_t>(&submissions[ring.submissionHead & mask]), sizeof(Util::SystemCallRing::Submission));
+        auto code = submission.code;
+
+        // Calls, which do not return (or would recurse), cannot be batched
+        auto result = false;
+        if (code != Util::System::EXIT_PROCESS && code != Util::System::EXIT_THREAD && code != Util::System::ENTER_SYSTEM_CALL_RING && systemCalls[code] != nullptr) {
+            result = systemCalls[code](submission.paramCount, reinterpret_cast<va_list>(submission.arguments));
+        }
+
+        completions[ring.completionTail & mask] = Util::SystemCallRing::Completion{submission.userData, result};
+        ring.completionTail = ring.completionTail + 1;
+        ring.submissionHead = ring.submissionHead + 1;
+        executed++;
+    }
+
+    return executed;
+}
+
+bool SystemCall::isFastEntrySupported() {
+    return Util::Hardware::CpuId::isAvailable() && (Util::Hardware::CpuId::getCpuFeatureBits() & Util::Hardware::CpuId::SEP) != 0;
+}
+
+void SystemCall::initializeFastEntry(TaskStateSegment &taskStateSegment) {
+    if (!isFastEntrySupported()) {
+        return;
+    }
+
+    // 'sysenter' loads CS from this register and SS from CS + 8; 'sysexit' uses CS + 16 and CS + 24 for user space.
+    // This matches the layout of our GDTs (kernel code, kernel data, user code, user data).
+    Device::ModelSpecificRegister(SYSENTER_CS).writeQuadWord(0x08);
+    Device::ModelSpecificRegister(SYSENTER_ESP).writeQuadWord(reinterpret_cast<uint32_t>(&taskStateSegment.esp0));
+    Device::ModelSpecificRegister(SYSENTER_EIP).writeQuadWord(reinterpret_cast<uint32_t>(&fast_system_call_entry));
+}
+
 }
\ No newline at end of file
@@ -23,9 +23,11 @@
 
 #include "kernel/interrupt/InterruptHandler.h"
 #include "lib/util/base/System.h"
+#include "lib/util/base/SystemCallRing.h"
 
 namespace Kernel {
 struct InterruptFrame;
+struct TaskStateSegment;
 
 class SystemCall : public Kernel::InterruptHandler {
 
@@ -56,10 +58,47 @@ public:
 
     void trigger(const Kernel::InterruptFrame &frame) override;
 
+    /**
+     * Execute the system call described by an interrupt frame.
+     * Used by both the interrupt based entry and the 'sysenter' based fast entry.
+     */
+    static void dispatch(const Kernel::InterruptFrame &frame);
+
+    /**
+     * Check whether the CPU supports the 'sysenter' and 'sysexit' instructions.
+     */
+    [[nodiscard]] static bool isFastEntrySupported();
+
+    /**
+     * Program the SYSENTER model specific registers of the current CPU.
+     * The stack pointer register is set to the esp0 entry of the given TSS,
+     * which always holds the kernel stack of the thread running on this CPU.
+     * Must be called on every CPU, since user space uses 'sysenter' once the CPU supports it.
+     *
+     * @param taskStateSegment The task state segment of the current CPU
+     */
+    static void initializeFastEntry(TaskStateSegment &taskStateSegment);
+
 private:
 
+    /**
+     * Execute the queued submissions of a system call ring and post their completions.
+     *
+     * @param ring The ring header in user space (only its indices are read from it)
+     * @param mask The validated kernel copy of the ring's mask
+     * @param submissions The validated kernel copy of the submission array address
+     * @param completions The validated kernel copy of the completion array address
+     *
+     * @return The amount of executed submissions
+     */
+    static uint32_t processRing(Util::SystemCallRing::Header &ring, uint32_t mask, Util::SystemCallRing::Submission *submissions, Util::SystemCallRing::Completion *completions);
+
     static bool(*systemCalls[256])(uint32_t paramCount, va_list params);
 
+    static const constexpr uint32_t SYSENTER_CS = 0x174;
+    static const constexpr uint32_t SYSENTER_ESP = 0x175;
+    static const constexpr uint32_t SYSENTER_EIP = 0x176;
+
 };
 
 }
@@ -0,0 +1,93 @@
+; Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+; Institute of Computer Science, Department Operating Systems
+; Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner; Olaf Spinczyk, TU Dortmund
+;
+; This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+; License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+; later version.
+;
+; This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+; warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+; details.
+;
+; You should have received a copy of the GNU General Public License
+; along with this program.  If not, see <http://www.gnu.org/licenses/>
+
+; Export functions
+global fast_system_call_entry
+
+; Import functions
+extern dispatch_fast_system_call
+extern set_tss_stack_entry
+
+section .text
+
+; Entry point for the 'sysenter' instruction (see SystemCall::initializeFastEntry()).
+; The CPU has already loaded the kernel code and stack segment and interrupts are disabled.
+; Since the SYSENTER_ESP register points to the esp0 entry of the current CPU's TSS,
+; the first instruction can switch to the kernel stack of the calling thread.
+; User space passes the system call number in eax, the parameter list in ebx and the result address in esi.
+; The return address is passed in edx and the user stack pointer in ecx.
+fast_system_call_entry:
+    mov esp, [esp]
+
+    ; Build the same frame as 'int 0x86' would, so that the usual thread state layout is kept
+    push 0x23 ; User stack segment
+    push ecx ; User stack pointer
+    pushfd
+    or dword [esp], 0x200 ; Interrupts are always enabled in user space
+    push 0x1b ; User code segment
+    push edx ; Return address
+    push 0x00 ; Error code
+    push 0x86 ; System call interrupt number
+
+    ; The interrupt based system call passes the result address in ecx
+    mov ecx, esi
+
+    ; Save state
+    pushad
+    push ds
+    push es
+    push fs
+    push gs
+    cld
+
+    mov dx, 0x10
+    mov ds, dx
+    mov es, dx
+    mov fs, dx
+    mov gs, dx
+
+    ; System calls are executed with interrupts enabled, just like with the trap gate used by 'int 0x86'
+    sti
+
+    ; Call system call handler
+    push esp
+    call dispatch_fast_system_call
+    add  esp, 0x04
+
+    ; Interrupts must stay disabled until 'sysexit', because the TSS and the user segments are restored now
+    cli
+
+    ; Set TSS to current kernel stack (the thread may have been migrated while executing the system call)
+    push esp
+    call set_tss_stack_entry
+    add  esp, 0x04
+
+    ; Load user state
+    pop gs
+    pop fs
+    pop es
+    pop ds
+    popad
+
+    ; Remove error code and interrupt number
+    add esp, 0x08
+
+    ; 'sysexit' continues at edx with the stack pointer in ecx
+    mov edx, [esp]
+    mov ecx, [esp + 0x0c]
+
+    ; The interrupt shadow of 'sti' guarantees, that no interrupt occurs before 'sysexit'
+    sti
+    sysexit
@@ -26,10 +26,11 @@ _start:
     push ebx
     push eax
 
-    push 0xbfffefff        ; Push second parameter (endAddress) on the stack
+    push esi               ; Push third parameter (heap memory manager type) on the stack
+    push 0xbfffdfff        ; Push second parameter (endAddress) on the stack (the time page follows the heap)
     push edx               ; Push first parameter (startAddress) on the stack
     call initMemoryManager
-    add esp,8
+    add esp,12
 
     ; Initialize bss
     call clear_bss
@@ -3,15 +3,24 @@
 #include "lib/util/base/operators.h"
 #include "lib/util/base/Constants.h"
 #include "lib/util/base/FreeListMemoryManager.h"
+#include "lib/util/base/SlabMemoryManager.h"
 
 // Export functions
 extern "C" {
-void initMemoryManager(uint32_t, uint32_t);
+void initMemoryManager(uint32_t, uint32_t, uint32_t);
 void _exit(int32_t);
 }
 
-void initMemoryManager(uint32_t startAddress, uint32_t endAddress) {
-    auto *memoryManager = new (reinterpret_cast<void*>(Util::USER_SPACE_MEMORY_MANAGER_ADDRESS)) Util::FreeListMemoryManager();
+void initMemoryManager(uint32_t startAddress, uint32_t endAddress, uint32_t type) {
+    // The kernel passes the type of its own heap memory manager, so that the 'heap_manager' option applies to user space as well
+    auto *address = reinterpret_cast<void*>(Util::USER_SPACE_MEMORY_MANAGER_ADDRESS);
+    Util::HeapMemoryManager *memoryManager;
+    if (type == Util::FREE_LIST_MEMORY_MANAGER) {
+        memoryManager = new (address) Util::FreeListMemoryManager();
+    } else {
+        memoryManager = new (address) Util::SlabMemoryManager();
+    }
+
     memoryManager->initialize(startAddress, endAddress);
 }
 
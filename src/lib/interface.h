@@ -38,16 +38,20 @@ class Datagram;
 
 namespace Async {
 class Runnable;
+class InterruptEvent;
 }  // namespace Async
 }  // namespace Util
 
 void* allocateMemory(uint32_t size, uint32_t alignment = 0);
 void* reallocateMemory(void *pointer, uint32_t size, uint32_t alignment = 0);
 void freeMemory(void *pointer, uint32_t alignment = 0);
+uint32_t getHeapAllocationCount();
 
 bool isSystemInitialized();
 void* mapIO(uint32_t physicalAddress, uint32_t size);
 void unmap(uint32_t virtualStartAddress, uint32_t virtualEndAddress, uint32_t breakCount = 0);
+void* mapFile(int32_t fileDescriptor, uint32_t offset, uint32_t length, Util::Io::File::MapMode mode);
+bool unmapFile(void *address);
 
 bool mount(const Util::String &deviceName, const Util::String &targetPath, const Util::String &driverName);
 bool unmount(const Util::String &path);
@@ -55,11 +59,17 @@ bool createFile(const Util::String &path, Util::Io::File::Type type);
 bool deleteFile(const Util::String &path);
 int32_t openFile(const Util::String &path);
 void closeFile(int32_t fileDescriptor);
+int32_t createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor);
 Util::Io::File::Type getFileType(int32_t fileDescriptor);
 uint32_t getFileLength(int32_t fileDescriptor);
 Util::Array<Util::String> getFileChildren(int32_t fileDescriptor);
 uint64_t readFile(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t pos, uint64_t length);
 uint64_t writeFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t pos, uint64_t length);
+uint64_t readFromFile(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t length);
+uint64_t writeToFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t length);
+uint64_t readFromFileVectored(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, uint32_t count);
+uint64_t writeToFileVectored(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, uint32_t count);
+uint64_t seekFile(int32_t fileDescriptor, int64_t offset, Util::Io::File::SeekMode mode);
 bool controlFile(int32_t fileDescriptor, uint32_t request, const Util::Array<uint32_t> &parameters);
 bool changeDirectory(const Util::String &path);
 Util::Io::File getCurrentWorkingDirectory();
@@ -73,10 +83,14 @@ Util::Async::Process getCurrentProcess();
 Util::Async::Thread createThread(const Util::String &name, Util::Async::Runnable *runnable);
 Util::Async::Thread getCurrentThread();
 void joinThread(uint32_t id);
+void setThreadPriority(uint32_t id, Util::Async::Thread::Priority priority);
 void joinProcess(uint32_t id);
 void killProcess(uint32_t id);
 void sleep(const Util::Time::Timestamp &time);
 void yield();
+bool futexWait(uint32_t *address, uint32_t expectedValue);
+void futexWake(uint32_t *address, uint32_t count);
+void queueInterruptEvent(Util::Async::InterruptEvent &event);
 
 Util::Time::Timestamp getSystemTime();
 Util::Time::Date getCurrentDate();
@@ -27,6 +27,7 @@
 #include "kernel/service/PowerManagementService.h"
 #include "kernel/service/ProcessService.h"
 #include "filesystem/core/Node.h"
+#include "kernel/file/OpenFile.h"
 #include "kernel/process/Thread.h"
 #include "kernel/service/SchedulerService.h"
 #include "kernel/service/NetworkService.h"
@@ -35,6 +36,8 @@
 #include "lib/util/network/Datagram.h"
 #include "lib/util/async/Process.h"
 #include "lib/util/async/Thread.h"
+#include "lib/util/async/Atomic.h"
+#include "lib/util/async/InterruptEvent.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/base/String.h"
 #include "lib/util/collection/Array.h"
@@ -52,7 +55,12 @@ class Runnable;
 
 extern uint32_t scheduler_initialized;
 
+// Number of allocations and reallocations requested by this address space, used to measure allocation heavy code
+static uint32_t heapAllocationCount = 0;
+
 void *allocateMemory(uint32_t size, uint32_t alignment) {
+    Util::Async::Atomic<uint32_t>(heapAllocationCount).inc();
+
     if (Kernel::System::isInitialized()) {
         return Kernel::System::getService<Kernel::MemoryService>().allocateKernelMemory(size, alignment);
     } else {
@@ -65,6 +73,8 @@ void* reallocateMemory(void *pointer, uint32_t size, uint32_t alignment) {
         return allocateMemory(size, alignment);
     }
 
+    Util::Async::Atomic<uint32_t>(heapAllocationCount).inc();
+
     return Kernel::System::getService<Kernel::MemoryService>().reallocateKernelMemory(pointer, size, alignment);
 }
 
@@ -76,6 +86,10 @@ void freeMemory(void *pointer, uint32_t alignment) {
     }
 }
 
+uint32_t getHeapAllocationCount() {
+    return heapAllocationCount;
+}
+
 bool isSystemInitialized() {
     return Kernel::System::isInitialized();
 }
@@ -88,6 +102,15 @@ void unmap(uint32_t virtualStartAddress, uint32_t virtualEndAddress, uint32_t br
     Kernel::System::getService<Kernel::MemoryService>().unmap(virtualStartAddress, virtualEndAddress, breakCount);
 }
 
+void* mapFile(int32_t fileDescriptor, uint32_t offset, uint32_t length, Util::Io::File::MapMode mode) {
+    auto &file = Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor);
+    return Kernel::System::getService<Kernel::MemoryService>().mapFile(file, offset, length, mode);
+}
+
+bool unmapFile(void *address) {
+    return Kernel::System::getService<Kernel::MemoryService>().unmapFile(address);
+}
+
 bool mount(const Util::String &deviceName, const Util::String &targetPath, const Util::String &driverName) {
     return Kernel::System::getService<Kernel::FilesystemService>().mount(deviceName, targetPath, driverName);
 }
@@ -119,8 +142,12 @@ void closeFile(int32_t fileDescriptor) {
     Kernel::System::getService<Kernel::FilesystemService>().closeFile(fileDescriptor);
 }
 
+int32_t createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor) {
+    return Kernel::System::getService<Kernel::FilesystemService>().createPipe(readFileDescriptor, writeFileDescriptor);
+}
+
 Util::Io::File::Type getFileType(int32_t fileDescriptor) {
-    return Kernel::System::getService<Kernel::FilesystemService>().getNode(fileDescriptor).getType();
+    return Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor).getType();
 }
 
 uint32_t getFileLength(int32_t fileDescriptor) {
@@ -132,11 +159,31 @@ Util::Array<Util::String> getFileChildren(int32_t fileDescriptor) {
 }
 
 uint64_t readFile(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t pos, uint64_t length) {
-    return Kernel::System::getService<Kernel::FilesystemService>().getNode(fileDescriptor).readData(targetBuffer, pos, length);
+    return Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor).readAt(targetBuffer, pos, length);
 }
 
 uint64_t writeFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t pos, uint64_t length) {
-    return Kernel::System::getService<Kernel::FilesystemService>().getNode(fileDescriptor).writeData(sourceBuffer, pos, length);
+    return Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor).writeAt(sourceBuffer, pos, length);
+}
+
+uint64_t readFromFile(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t length) {
+    return Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor).read(targetBuffer, length);
+}
+
+uint64_t writeToFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t length) {
+    return Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor).write(sourceBuffer, length);
+}
+
+uint64_t readFromFileVectored(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, uint32_t count) {
+    return Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor).read(vectors, count);
+}
+
+uint64_t writeToFileVectored(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, uint32_t count) {
+    return Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor).write(vectors, count);
+}
+
+uint64_t seekFile(int32_t fileDescriptor, int64_t offset, Util::Io::File::SeekMode mode) {
+    return Kernel::System::getService<Kernel::FilesystemService>().getFile(fileDescriptor).seek(offset, mode);
 }
 
 bool controlFile(int32_t fileDescriptor, uint32_t request, const Util::Array<uint32_t> &parameters) {
@@ -204,6 +251,14 @@ void joinThread(uint32_t id) {
     }
 }
 
+void setThreadPriority(uint32_t id, Util::Async::Thread::Priority priority) {
+    auto &schedulerService = Kernel::System::getService<Kernel::SchedulerService>();
+    auto *thread = schedulerService.getThread(id);
+    if (thread != nullptr) {
+        schedulerService.setPriority(*thread, priority);
+    }
+}
+
 void joinProcess(uint32_t id) {
     auto *process = Kernel::System::getService<Kernel::ProcessService>().getProcess(id);
     if (process != nullptr) {
@@ -231,6 +286,29 @@ void yield() {
     Kernel::System::getService<Kernel::SchedulerService>().yield();
 }
 
+bool futexWait(uint32_t *address, uint32_t expectedValue) {
+    if (!scheduler_initialized) {
+        return false;
+    }
+
+    return Kernel::System::getService<Kernel::SchedulerService>().futexWait(address, expectedValue);
+}
+
+void futexWake(uint32_t *address, uint32_t count) {
+    if (scheduler_initialized) {
+        Kernel::System::getService<Kernel::SchedulerService>().futexWake(address, count);
+    }
+}
+
+void queueInterruptEvent(Util::Async::InterruptEvent &event) {
+    if (scheduler_initialized) {
+        Kernel::System::getService<Kernel::SchedulerService>().queueInterruptEvent(event);
+    } else {
+        // There are no threads to wake up yet (waiting only spins until then)
+        event.dispatch();
+    }
+}
+
 Util::Time::Timestamp getSystemTime() {
     return Kernel::System::getService<Kernel::TimeService>().getSystemTime();
 }
@@ -118,8 +118,8 @@ void LvglDriver::initialize() {
     lv_indev_set_cursor(mouse, cursor);
 
     running = true;
-    Util::Async::Thread::createThread("Keyboard-Listener", new KeyboardRunnable(*this));
-    Util::Async::Thread::createThread("Mouse-Listener", new MouseRunnable(*this));
+    Util::Async::Thread::createThread("Keyboard-Listener", new KeyboardRunnable(*this)).setPriority(Util::Async::Thread::HIGH);
+    Util::Async::Thread::createThread("Mouse-Listener", new MouseRunnable(*this)).setPriority(Util::Async::Thread::HIGH);
 }
 
 void LvglDriver::assignKeyboardToGroup(lv_group_t &group) {
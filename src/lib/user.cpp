@@ -25,6 +25,8 @@
 #include "lib/util/io/stream/PrintStream.h"
 #include "lib/util/async/Process.h"
 #include "lib/util/async/Thread.h"
+#include "lib/util/async/Atomic.h"
+#include "lib/util/async/InterruptEvent.h"
 #include "lib/util/base/Exception.h"
 #include "lib/util/base/String.h"
 #include "lib/util/collection/Array.h"
@@ -33,6 +35,7 @@
 #include "lib/util/network/Socket.h"
 #include "lib/util/time/Date.h"
 #include "lib/util/time/Timestamp.h"
+#include "lib/util/time/TimePage.h"
 
 namespace Util {
 namespace Network {
@@ -40,7 +43,11 @@ class Datagram;
 }  // namespace Network
 }  // namespace Util
 
+// Number of allocations and reallocations requested by this address space, used to measure allocation heavy code
+static uint32_t heapAllocationCount = 0;
+
 void* allocateMemory(uint32_t size, uint32_t alignment) {
+    Util::Async::Atomic<uint32_t>(heapAllocationCount).inc();
     auto *manager = reinterpret_cast<Util::HeapMemoryManager*>(Util::USER_SPACE_MEMORY_MANAGER_ADDRESS);
     return manager->allocateMemory(size, alignment);
 }
@@ -50,6 +57,8 @@ void* reallocateMemory(void *pointer, uint32_t size, uint32_t alignment) {
         return allocateMemory(size, alignment);
     }
 
+    Util::Async::Atomic<uint32_t>(heapAllocationCount).inc();
+
     auto *manager = reinterpret_cast<Util::HeapMemoryManager*>(Util::USER_SPACE_MEMORY_MANAGER_ADDRESS);
     return manager->reallocateMemory(pointer, size, alignment);
 }
@@ -59,6 +68,10 @@ void freeMemory(void *pointer, uint32_t alignment) {
     manager->freeMemory(pointer, alignment);
 }
 
+uint32_t getHeapAllocationCount() {
+    return heapAllocationCount;
+}
+
 bool isSystemInitialized() {
     return true;
 }
@@ -73,6 +86,16 @@ void unmap(uint32_t virtualStartAddress, uint32_t virtualEndAddress, uint32_t br
     Util::System::call(Util::System::UNMAP, 3, virtualStartAddress, virtualEndAddress, breakCount);
 }
 
+void* mapFile(int32_t fileDescriptor, uint32_t offset, uint32_t length, Util::Io::File::MapMode mode) {
+    void *mappedAddress = nullptr;
+    Util::System::call(Util::System::MAP_FILE, 5, fileDescriptor, offset, length, static_cast<uint32_t>(mode), &mappedAddress);
+    return mappedAddress;
+}
+
+bool unmapFile(void *address) {
+    return Util::System::call(Util::System::UNMAP_FILE, 1, address);
+}
+
 bool mount(const Util::String &deviceName, const Util::String &targetPath, const Util::String &driverName) {
     return Util::System::call(Util::System::MOUNT, 3, static_cast<const char*>(deviceName), static_cast<const char*>(targetPath), static_cast<const char*>(driverName)) ;
 }
@@ -99,6 +122,12 @@ void closeFile(int32_t fileDescriptor) {
     Util::System::call(Util::System::CLOSE_FILE, 1, fileDescriptor);
 }
 
+int32_t createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor) {
+    int32_t id;
+    auto result = Util::System::call(Util::System::CREATE_PIPE, 3, &readFileDescriptor, &writeFileDescriptor, &id);
+    return result ? id : -1;
+}
+
 Util::Io::File::Type getFileType(int32_t fileDescriptor) {
     Util::Io::File::Type type;
     Util::System::call(Util::System::FILE_TYPE, 2, fileDescriptor, &type);
@@ -138,6 +167,36 @@ uint64_t writeFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t
     return written;
 }
 
+uint64_t readFromFile(int32_t fileDescriptor, uint8_t *targetBuffer, uint64_t length) {
+    uint64_t read;
+    Util::System::call(Util::System::READ_FROM_FILE, 4, fileDescriptor, targetBuffer, length, &read);
+    return read;
+}
+
+uint64_t writeToFile(int32_t fileDescriptor, const uint8_t *sourceBuffer, uint64_t length) {
+    uint64_t written;
+    Util::System::call(Util::System::WRITE_TO_FILE, 4, fileDescriptor, sourceBuffer, length, &written);
+    return written;
+}
+
+uint64_t readFromFileVectored(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, uint32_t count) {
+    uint64_t read;
+    Util::System::call(Util::System::READ_FROM_FILE_VECTORED, 4, fileDescriptor, vectors, count, &read);
+    return read;
+}
+
+uint64_t writeToFileVectored(int32_t fileDescriptor, const Util::Io::File::IoVector *vectors, uint32_t count) {
+    uint64_t written;
+    Util::System::call(Util::System::WRITE_TO_FILE_VECTORED, 4, fileDescriptor, vectors, count, &written);
+    return written;
+}
+
+uint64_t seekFile(int32_t fileDescriptor, int64_t offset, Util::Io::File::SeekMode mode) {
+    uint64_t position;
+    Util::System::call(Util::System::SEEK_FILE, 4, fileDescriptor, offset, static_cast<uint32_t>(mode), &position);
+    return position;
+}
+
 bool controlFile(int32_t fileDescriptor, uint32_t request, const Util::Array<uint32_t> &parameters) {
     return Util::System::call(Util::System::CONTROL_FILE, 3, fileDescriptor, request, &parameters);
 }
@@ -200,6 +259,10 @@ void joinThread(uint32_t id) {
     Util::System::call(Util::System::JOIN_THREAD, 1, id);
 }
 
+void setThreadPriority(uint32_t id, Util::Async::Thread::Priority priority) {
+    Util::System::call(Util::System::SET_THREAD_PRIORITY, 2, id, priority);
+}
+
 void joinProcess(uint32_t id) {
     Util::System::call(Util::System::JOIN_PROCESS, 1, id);
 }
@@ -216,9 +279,27 @@ void yield() {
     Util::System::call(Util::System::YIELD, 0);
 }
 
+bool futexWait(uint32_t *address, uint32_t expectedValue) {
+    return Util::System::call(Util::System::FUTEX_WAIT, 2, address, expectedValue);
+}
+
+void futexWake(uint32_t *address, uint32_t count) {
+    Util::System::call(Util::System::FUTEX_WAKE, 2, address, count);
+}
+
+void queueInterruptEvent(Util::Async::InterruptEvent &event) {
+    // There are no interrupt handlers in user space, so the event can be dispatched right away
+    event.dispatch();
+}
+
 Util::Time::Timestamp getSystemTime() {
     Util::Time::Timestamp systemTime;
-    Util::System::call(Util::System::GET_SYSTEM_TIME, 1, &systemTime);
+    // The kernel publishes the system time on a page in every process; the system call is only needed before the first tick
+    const auto &timePage = *reinterpret_cast<const Util::Time::TimePage*>(Util::USER_SPACE_TIME_PAGE_ADDRESS);
+    if (!timePage.read(systemTime)) {
+        Util::System::call(Util::System::GET_SYSTEM_TIME, 1, &systemTime);
+    }
+
     return systemTime;
 }
 
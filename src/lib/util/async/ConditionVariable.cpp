@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "lib/interface.h"
+#include "Lock.h"
+#include "ConditionVariable.h"
+
+namespace Util::Async {
+
+ConditionVariable::ConditionVariable() : sequenceWrapper(sequence) {}
+
+void ConditionVariable::wait(Lock &lock) {
+    // A signal between releasing the lock and blocking changes the sequence number, so that the futex does not block
+    auto currentSequence = sequenceWrapper.get();
+    lock.release();
+    futexWait(&sequence, currentSequence);
+    lock.acquire();
+}
+
+void ConditionVariable::signal() {
+    sequenceWrapper.inc();
+    futexWake(&sequence, 1);
+}
+
+void ConditionVariable::signalAll() {
+    sequenceWrapper.inc();
+    futexWake(&sequence, UINT32_MAX);
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_CONDITIONVARIABLE_H
+#define HHUOS_CONDITIONVARIABLE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+
+namespace Util::Async {
+class Lock;
+
+/**
+ * A condition variable, based on futexes. Waiting threads are blocked by the kernel, until another thread signals them.
+ * As with all condition variables, a woken up thread must check its condition again, since wakeups may be spurious.
+ */
+class ConditionVariable {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    ConditionVariable();
+
+    /**
+     * Copy Constructor.
+     */
+    ConditionVariable(const ConditionVariable &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    ConditionVariable &operator=(const ConditionVariable &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~ConditionVariable() = default;
+
+    /**
+     * Release the given lock and block the current thread, until the condition is signaled.
+     * The lock is acquired again, before this function returns.
+     *
+     * @param lock The lock protecting the condition (must be held by the current thread)
+     */
+    void wait(Lock &lock);
+
+    /**
+     * Wake up a single thread waiting on this condition.
+     */
+    void signal();
+
+    /**
+     * Wake up all threads waiting on this condition.
+     */
+    void signalAll();
+
+private:
+
+    uint32_t sequence = 0;
+    Atomic<uint32_t> sequenceWrapper;
+};
+
+}
+
+#endif
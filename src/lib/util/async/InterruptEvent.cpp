@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "lib/interface.h"
+#include "InterruptEvent.h"
+
+namespace Util::Async {
+
+InterruptEvent::InterruptEvent() : sequenceWrapper(sequence), queuedWrapper(queued) {}
+
+void InterruptEvent::signal() {
+    sequenceWrapper.inc();
+    queue();
+}
+
+uint32_t InterruptEvent::getSequence() const {
+    return sequenceWrapper.get();
+}
+
+void InterruptEvent::wait(uint32_t lastSequence) {
+    while (getSequence() == lastSequence) {
+        futexWait(&sequence, lastSequence);
+    }
+}
+
+bool InterruptEvent::wait(uint32_t lastSequence, const Time::Timestamp &timeout) {
+    // The kernel learns about the deadline, when it dispatches the event
+    deadline = Time::getSystemTime().toMilliseconds() + timeout.toMilliseconds();
+    timed = true;
+    queue();
+
+    auto signaled = true;
+    while (getSequence() == lastSequence) {
+        if (Time::getSystemTime().toMilliseconds() >= deadline) {
+            signaled = false;
+            break;
+        }
+
+        futexWait(&sequence, lastSequence);
+    }
+
+    timed = false;
+    return signaled;
+}
+
+void InterruptEvent::dispatch() {
+    // Reset the flag before waking up, so that no signal is lost
+    queuedWrapper.set(0);
+    wakeUp();
+}
+
+void InterruptEvent::wakeUp() {
+    futexWake(&sequence, UINT32_MAX);
+}
+
+bool InterruptEvent::getDeadline(uint32_t &deadline) const {
+    if (!timed) {
+        return false;
+    }
+
+    deadline = this->deadline;
+    return true;
+}
+
+void InterruptEvent::queue() {
+    // An event is queued at most once, until the kernel has dispatched it
+    if (queuedWrapper.compareAndSet(0, 1)) {
+        queueInterruptEvent(*this);
+    }
+}
+
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_INTERRUPTEVENT_H
+#define HHUOS_INTERRUPTEVENT_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+#include "lib/util/time/Timestamp.h"
+
+namespace Util::Async {
+
+/**
+ * An event, which is signaled by an interrupt handler and waited for by threads.
+ * Interrupt handlers must not wake up threads themselves, since waking takes spinlocks, which the interrupted thread may hold.
+ * Instead, signal() only increments a sequence number and queues the event without taking any lock.
+ * The kernel wakes up the waiting threads from a thread context shortly afterwards.
+ *
+ * To wait for a condition without losing a wakeup, read the sequence number, check the condition
+ * and pass the sequence number to wait(), which returns as soon as the event has been signaled after reading it.
+ * Events must not be destroyed, while they are queued or while a timed wait may still be pending.
+ */
+class InterruptEvent {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    InterruptEvent();
+
+    /**
+     * Copy Constructor.
+     */
+    InterruptEvent(const InterruptEvent &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    InterruptEvent &operator=(const InterruptEvent &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~InterruptEvent() = default;
+
+    /**
+     * Signal the event. Never blocks and takes no locks, so it may be called from interrupt handlers.
+     */
+    void signal();
+
+    [[nodiscard]] uint32_t getSequence() const;
+
+    /**
+     * Block the current thread, until the event is signaled after the sequence number has been read.
+     *
+     * @param lastSequence The sequence number, as returned by getSequence() before checking the condition
+     */
+    void wait(uint32_t lastSequence);
+
+    /**
+     * Block the current thread, until the event is signaled after the sequence number has been read, or the timeout expires.
+     * Only one thread may wait with a timeout at a time.
+     *
+     * @param lastSequence The sequence number, as returned by getSequence() before checking the condition
+     * @param timeout The maximum time to wait
+     * @return false, if the timeout has expired without the event being signaled
+     */
+    bool wait(uint32_t lastSequence, const Time::Timestamp &timeout);
+
+    /**
+     * Wake up all threads waiting for the event and allow it to be queued again.
+     * Called by the kernel from a thread context, after the event has been queued.
+     */
+    void dispatch();
+
+    /**
+     * Wake up all threads waiting for the event, without touching its queue state.
+     * Called by the kernel, when a timed wait has expired.
+     */
+    void wakeUp();
+
+    /**
+     * Get the time (in milliseconds) at which a timed wait expires.
+     *
+     * @return false, if no timed wait is pending
+     */
+    bool getDeadline(uint32_t &deadline) const;
+
+    /**
+     * Link to the next queued event. Only used by the kernel, while the event is queued.
+     */
+    InterruptEvent *next = nullptr;
+
+private:
+
+    void queue();
+
+    uint32_t sequence = 0;
+    uint32_t queued = 0;
+    Atomic<uint32_t> sequenceWrapper;
+    Atomic<uint32_t> queuedWrapper;
+    volatile uint32_t deadline = 0;
+    volatile bool timed = false;
+};
+
+}
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "lib/interface.h"
+#include "Mutex.h"
+
+namespace Util::Async {
+
+Mutex::Mutex() : stateWrapper(state) {}
+
+void Mutex::acquire() {
+    if (stateWrapper.compareAndSet(UNLOCKED, LOCKED)) {
+        return;
+    }
+
+    // Mark the lock as contended, so that the owner knows it has to wake up a waiting thread on release.
+    // Once a thread has been blocked, it always acquires the lock as contended, since other threads may still be waiting.
+    do {
+        if (stateWrapper.get() == CONTENDED || stateWrapper.compareAndSet(LOCKED, CONTENDED)) {
+            futexWait(&state, CONTENDED);
+        }
+    } while (!stateWrapper.compareAndSet(UNLOCKED, CONTENDED));
+}
+
+bool Mutex::tryAcquire() {
+    return stateWrapper.compareAndSet(UNLOCKED, LOCKED);
+}
+
+void Mutex::release() {
+    if (stateWrapper.fetchAndDec() != LOCKED) {
+        stateWrapper.set(UNLOCKED);
+        futexWake(&state, 1);
+    }
+}
+
+bool Mutex::isLocked() {
+    return stateWrapper.get() != UNLOCKED;
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_MUTEX_H
+#define HHUOS_MUTEX_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+#include "Lock.h"
+
+namespace Util::Async {
+
+/**
+ * A sleeping lock, based on futexes. The uncontended case is handled with a single atomic instruction,
+ * while contending threads are blocked by the kernel instead of spinning until the lock becomes free.
+ * The lock variable is used as futex and must therefore not be moved, which is why mutexes are not copyable.
+ */
+class Mutex : public Lock {
+
+public:
+    /**
+     * Default Constructor.
+     */
+    Mutex();
+
+    /**
+     * Copy Constructor.
+     */
+    Mutex(const Mutex &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Mutex &operator=(const Mutex &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Mutex() override = default;
+
+    void acquire() override;
+
+    bool tryAcquire() override;
+
+    void release() override;
+
+    bool isLocked() override;
+
+private:
+
+    uint32_t state = UNLOCKED;
+    Atomic<uint32_t> stateWrapper;
+
+    static const constexpr uint32_t UNLOCKED = 0;
+    static const constexpr uint32_t LOCKED = 1;
+    static const constexpr uint32_t CONTENDED = 2;
+};
+
+}
+
+#endif
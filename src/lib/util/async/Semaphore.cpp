@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "lib/interface.h"
+#include "Semaphore.h"
+
+namespace Util::Async {
+
+Semaphore::Semaphore(uint32_t permits) : permits(permits), permitsWrapper(this->permits), waitersWrapper(waiters) {}
+
+void Semaphore::acquire() {
+    while (!tryAcquire()) {
+        waitersWrapper.inc();
+        futexWait(&permits, 0);
+        waitersWrapper.dec();
+    }
+}
+
+bool Semaphore::tryAcquire() {
+    auto available = permitsWrapper.get();
+    while (available > 0) {
+        if (permitsWrapper.compareAndSet(available, available - 1)) {
+            return true;
+        }
+
+        available = permitsWrapper.get();
+    }
+
+    return false;
+}
+
+void Semaphore::release() {
+    permitsWrapper.inc();
+    if (waitersWrapper.get() > 0) {
+        futexWake(&permits, 1);
+    }
+}
+
+uint32_t Semaphore::getPermits() const {
+    return permitsWrapper.get();
+}
+
+}
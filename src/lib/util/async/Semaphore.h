@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SEMAPHORE_H
+#define HHUOS_SEMAPHORE_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+
+namespace Util::Async {
+
+/**
+ * A counting semaphore, based on futexes. Threads trying to acquire a permit, while none are available,
+ * are blocked by the kernel. Releasing a permit may wake up a thread, which takes kernel locks,
+ * so interrupt handlers must use an InterruptEvent instead.
+ */
+class Semaphore {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param permits The initial amount of available permits
+     */
+    explicit Semaphore(uint32_t permits = 0);
+
+    /**
+     * Copy Constructor.
+     */
+    Semaphore(const Semaphore &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Semaphore &operator=(const Semaphore &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Semaphore() = default;
+
+    /**
+     * Take a permit, blocking the current thread until one becomes available.
+     */
+    void acquire();
+
+    /**
+     * Take a permit, if one is available.
+     *
+     * @return true, if a permit has been taken
+     */
+    bool tryAcquire();
+
+    /**
+     * Return a permit and wake up a waiting thread.
+     */
+    void release();
+
+    [[nodiscard]] uint32_t getPermits() const;
+
+private:
+
+    uint32_t permits;
+    uint32_t waiters = 0;
+    Atomic<uint32_t> permitsWrapper;
+    Atomic<uint32_t> waitersWrapper;
+};
+
+}
+
+#endif
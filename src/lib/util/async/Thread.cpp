@@ -55,4 +55,8 @@ void Thread::join() const {
     ::joinThread(id);
 }
 
+void Thread::setPriority(Priority priority) const {
+    ::setThreadPriority(id, priority);
+}
+
 }
\ No newline at end of file
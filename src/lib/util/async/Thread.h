@@ -36,6 +36,18 @@ namespace Util::Async {
 class Thread {
 
 public:
+    /**
+     * Scheduling priorities. Threads with a higher priority are always preferred,
+     * but threads with a lower priority still get some CPU time to prevent starvation.
+     * Threads, that have been woken up, are temporarily boosted by one level.
+     */
+    enum Priority : uint8_t {
+        IDLE,
+        LOW,
+        NORMAL,
+        HIGH
+    };
+
     /**
      * Constructor.
      */
@@ -68,6 +80,8 @@ public:
 
     void join() const;
 
+    void setPriority(Priority priority) const;
+
 private:
 
     uint32_t id;
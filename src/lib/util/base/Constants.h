@@ -16,7 +16,7 @@
  */
 
 #include <cstdint>
-#include "FreeListMemoryManager.h"
+#include "SlabMemoryManager.h"
 
 #ifndef HHUOS_CONSTANTS_H
 #define HHUOS_CONSTANTS_H
@@ -26,7 +26,16 @@ namespace Util {
 // pagesize = 4KB
 static const constexpr uint32_t PAGESIZE = 0x1000;
 static const constexpr uint32_t USER_SPACE_MEMORY_MANAGER_ADDRESS = 0x1000;
-static const constexpr uint32_t USER_SPACE_STACK_INSTANCE_ADDRESS = USER_SPACE_MEMORY_MANAGER_ADDRESS + sizeof(FreeListMemoryManager);
+// The slab memory manager embeds a free list memory manager, so it is the largest heap memory manager
+static const constexpr uint32_t USER_SPACE_STACK_INSTANCE_ADDRESS = USER_SPACE_MEMORY_MANAGER_ADDRESS + sizeof(SlabMemoryManager);
+
+// Heap memory manager, which a new process constructs at USER_SPACE_MEMORY_MANAGER_ADDRESS (passed in 'esi', see crt0.asm)
+enum HeapMemoryManagerType : uint32_t {
+    SLAB_MEMORY_MANAGER = 0,
+    FREE_LIST_MEMORY_MANAGER = 1
+};
+// Read-only page with the system time, located between the heap and the main thread's stack (see crt0.asm)
+static const constexpr uint32_t USER_SPACE_TIME_PAGE_ADDRESS = 0xbfffe000;
 
 }
 
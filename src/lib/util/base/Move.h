@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_MOVE_H
+#define HHUOS_MOVE_H
+
+namespace Util {
+
+/**
+ * Strip a reference from a type (freestanding replacement for std::remove_reference).
+ */
+template<typename T>
+struct RemoveReference {
+    typedef T Type;
+};
+
+template<typename T>
+struct RemoveReference<T&> {
+    typedef T Type;
+};
+
+template<typename T>
+struct RemoveReference<T&&> {
+    typedef T Type;
+};
+
+/**
+ * Cast a value to an rvalue reference, so that its resources may be taken over by the receiver
+ * (freestanding replacement for std::move).
+ */
+template<typename T>
+constexpr typename RemoveReference<T>::Type&& move(T &&value) noexcept {
+    return static_cast<typename RemoveReference<T>::Type&&>(value);
+}
+
+/**
+ * Pass on a forwarding reference with its original value category (freestanding replacement for std::forward).
+ */
+template<typename T>
+constexpr T&& forward(typename RemoveReference<T>::Type &value) noexcept {
+    return static_cast<T&&>(value);
+}
+
+template<typename T>
+constexpr T&& forward(typename RemoveReference<T>::Type &&value) noexcept {
+    return static_cast<T&&>(value);
+}
+
+/**
+ * Exchange two values by moving them (freestanding replacement for std::swap).
+ */
+template<typename T>
+void swap(T &first, T &second) {
+    T tmp = move(first);
+    first = move(second);
+    second = move(tmp);
+}
+
+}
+
+#endif
@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "lib/util/async/Atomic.h"
+#include "lib/util/base/Address.h"
+#include "lib/util/base/Exception.h"
+#include "SlabMemoryManager.h"
+
+namespace Util {
+
+void SlabMemoryManager::initialize(uint32_t startAddress, uint32_t endAddress) {
+    backend.initialize(startAddress, endAddress);
+    slabBase = startAddress - startAddress % SLAB_SIZE;
+
+    // One bit per possible slab position, telling whether a pointer belongs to a slab or to a block of the backend.
+    // Only the table of bitmap blocks is allocated here, so that a process does not pay for slabs it never creates.
+    auto slabCount = (endAddress - slabBase) / SLAB_SIZE + 1;
+    auto tableSize = ((slabCount + SLABS_PER_BITMAP_BLOCK - 1) / SLABS_PER_BITMAP_BLOCK) * sizeof(uint32_t);
+    slabBitmap = static_cast<uint32_t*>(backend.allocateMemory(tableSize, sizeof(uint32_t)));
+    if (slabBitmap == nullptr) {
+        Exception::throwException(Exception::OUT_OF_MEMORY, "SlabMemoryManager: Heap is too small!");
+    }
+
+    Address<uint32_t>(slabBitmap).setRange(0, tableSize);
+
+    for (uint32_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+        auto &sizeClass = sizeClasses[i];
+        sizeClass.objectSize = MIN_OBJECT_SIZE << i;
+        sizeClass.firstObjectOffset = Address<uint32_t>(sizeof(Slab)).alignUp(sizeClass.objectSize).get();
+        sizeClass.objectsPerSlab = (SLAB_SIZE - sizeClass.firstObjectOffset) / sizeClass.objectSize;
+    }
+}
+
+void *SlabMemoryManager::allocateMemory(uint32_t size, uint32_t alignment) {
+    auto index = getSizeClass(size, alignment);
+    if (index < 0) {
+        return backend.allocateMemory(size, alignment);
+    }
+
+    auto &sizeClass = sizeClasses[index];
+    sizeClass.lock.acquire();
+
+    auto *slab = sizeClass.partialSlabs;
+    if (slab == nullptr) {
+        if (sizeClass.emptySlab != nullptr) {
+            slab = sizeClass.emptySlab;
+            sizeClass.emptySlab = nullptr;
+        } else {
+            slab = createSlab(index);
+            if (slab == nullptr) {
+                return sizeClass.lock.releaseAndReturn<void*>(nullptr);
+            }
+
+            sizeClass.freeObjects += sizeClass.objectsPerSlab;
+        }
+
+        insertSlab(sizeClass.partialSlabs, slab);
+    }
+
+    auto *object = slab->freeList;
+    slab->freeList = *static_cast<void**>(object);
+    slab->freeObjects--;
+    sizeClass.freeObjects--;
+
+    if (slab->freeObjects == 0) {
+        removeSlab(sizeClass.partialSlabs, slab);
+    }
+
+    sizeClass.lock.release();
+    return object;
+}
+
+void *SlabMemoryManager::reallocateMemory(void *pointer, uint32_t size, uint32_t alignment) {
+    if (pointer == nullptr) {
+        return allocateMemory(size, alignment);
+    }
+
+    if (!isSlabObject(pointer)) {
+        return backend.reallocateMemory(pointer, size, alignment);
+    }
+
+    // Objects stay in place, as long as they still fit into their size class
+    auto objectSize = sizeClasses[getSlab(pointer)->sizeClass].objectSize;
+    if (size <= objectSize && (alignment == 0 || reinterpret_cast<uint32_t>(pointer) % alignment == 0)) {
+        return pointer;
+    }
+
+    auto *allocated = allocateMemory(size, alignment);
+    if (allocated != nullptr) {
+        Address<uint32_t>(allocated).copyRange(Address<uint32_t>(pointer), size < objectSize ? size : objectSize);
+        freeMemory(pointer, alignment);
+    }
+
+    return allocated;
+}
+
+void SlabMemoryManager::freeMemory(void *pointer, uint32_t alignment) {
+    if (pointer == nullptr) {
+        return;
+    }
+
+    if (!isSlabObject(pointer)) {
+        backend.freeMemory(pointer, alignment);
+        return;
+    }
+
+    auto *slab = getSlab(pointer);
+    auto &sizeClass = sizeClasses[slab->sizeClass];
+    sizeClass.lock.acquire();
+
+    *static_cast<void**>(pointer) = slab->freeList;
+    slab->freeList = pointer;
+    slab->freeObjects++;
+    sizeClass.freeObjects++;
+
+    if (slab->freeObjects == 1) {
+        // The slab has been full and is not part of the partial list
+        insertSlab(sizeClass.partialSlabs, slab);
+    }
+
+    if (slab->freeObjects == sizeClass.objectsPerSlab) {
+        // Keep one empty slab per size class, to avoid creating and destroying slabs in quick succession
+        removeSlab(sizeClass.partialSlabs, slab);
+        if (sizeClass.emptySlab == nullptr) {
+            sizeClass.emptySlab = slab;
+        } else {
+            sizeClass.freeObjects -= sizeClass.objectsPerSlab;
+            destroySlab(slab);
+        }
+    }
+
+    sizeClass.lock.release();
+}
+
+uint32_t SlabMemoryManager::getTotalMemory() const {
+    return backend.getTotalMemory();
+}
+
+uint32_t SlabMemoryManager::getFreeMemory() const {
+    auto freeMemory = backend.getFreeMemory();
+    for (const auto &sizeClass : sizeClasses) {
+        freeMemory += sizeClass.freeObjects * sizeClass.objectSize;
+    }
+
+    return freeMemory;
+}
+
+uint32_t SlabMemoryManager::getStartAddress() const {
+    return backend.getStartAddress();
+}
+
+uint32_t SlabMemoryManager::getEndAddress() const {
+    return backend.getEndAddress();
+}
+
+int32_t SlabMemoryManager::getSizeClass(uint32_t size, uint32_t alignment) {
+    if (size == 0) {
+        return -1;
+    }
+
+    auto required = size > alignment ? size : alignment;
+    if (required > MAX_OBJECT_SIZE) {
+        return -1;
+    }
+
+    int32_t index = 0;
+    while ((MIN_OBJECT_SIZE << index) < required) {
+        index++;
+    }
+
+    return index;
+}
+
+bool SlabMemoryManager::isSlabObject(const void *pointer) {
+    auto address = reinterpret_cast<uint32_t>(pointer);
+    if (address < backend.getStartAddress() || address > backend.getEndAddress()) {
+        return false;
+    }
+
+    auto index = (address - slabBase) / SLAB_SIZE;
+    auto *block = getBitmapBlock(index, false);
+    if (block == nullptr) {
+        return false;
+    }
+
+    index %= SLABS_PER_BITMAP_BLOCK;
+    return Async::Atomic<uint32_t>(block[index / 32]).bitTest(index % 32);
+}
+
+SlabMemoryManager::Slab *SlabMemoryManager::getSlab(const void *pointer) const {
+    auto address = reinterpret_cast<uint32_t>(pointer);
+    return reinterpret_cast<Slab*>(address - address % SLAB_SIZE);
+}
+
+SlabMemoryManager::Slab *SlabMemoryManager::createSlab(uint32_t sizeClass) {
+    // Slabs are aligned to their size, so that the slab header can be found from any of its objects
+    auto *memory = backend.allocateMemory(SLAB_SIZE, SLAB_SIZE);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+
+    auto index = (reinterpret_cast<uint32_t>(memory) - slabBase) / SLAB_SIZE;
+    auto *block = getBitmapBlock(index, true);
+    if (block == nullptr) {
+        backend.freeMemory(memory, SLAB_SIZE);
+        return nullptr;
+    }
+
+    auto &slabClass = sizeClasses[sizeClass];
+    auto *slab = static_cast<Slab*>(memory);
+    slab->prev = nullptr;
+    slab->next = nullptr;
+    slab->sizeClass = sizeClass;
+    slab->freeObjects = slabClass.objectsPerSlab;
+    slab->freeList = nullptr;
+
+    // Chain all objects, beginning with the last one, so that allocations are handed out in ascending order
+    auto firstObject = reinterpret_cast<uint32_t>(slab) + slabClass.firstObjectOffset;
+    for (uint32_t i = slabClass.objectsPerSlab; i > 0; i--) {
+        auto *object = reinterpret_cast<void**>(firstObject + (i - 1) * slabClass.objectSize);
+        *object = slab->freeList;
+        slab->freeList = object;
+    }
+
+    index %= SLABS_PER_BITMAP_BLOCK;
+    Async::Atomic<uint32_t>(block[index / 32]).bitSet(index % 32);
+
+    return slab;
+}
+
+void SlabMemoryManager::destroySlab(Slab *slab) {
+    // The bitmap block is kept, since other slabs in its range are likely to be created again
+    auto index = (reinterpret_cast<uint32_t>(slab) - slabBase) / SLAB_SIZE;
+    auto *block = getBitmapBlock(index, false);
+    index %= SLABS_PER_BITMAP_BLOCK;
+    Async::Atomic<uint32_t>(block[index / 32]).bitReset(index % 32);
+    backend.freeMemory(slab, SLAB_SIZE);
+}
+
+uint32_t *SlabMemoryManager::getBitmapBlock(uint32_t slabIndex, bool allocate) {
+    Async::Atomic<uint32_t> entry(slabBitmap[slabIndex / SLABS_PER_BITMAP_BLOCK]);
+    auto block = entry.get();
+    if (block != 0 || !allocate) {
+        return reinterpret_cast<uint32_t*>(block);
+    }
+
+    auto *newBlock = static_cast<uint32_t*>(backend.allocateMemory(BITMAP_BLOCK_SIZE, sizeof(uint32_t)));
+    if (newBlock == nullptr) {
+        return nullptr;
+    }
+
+    Address<uint32_t>(newBlock).setRange(0, BITMAP_BLOCK_SIZE);
+
+    // Size classes have separate locks, so another one may have allocated the same block in the meantime
+    if (!entry.compareAndSet(0, reinterpret_cast<uint32_t>(newBlock))) {
+        backend.freeMemory(newBlock, sizeof(uint32_t));
+        return reinterpret_cast<uint32_t*>(entry.get());
+    }
+
+    return newBlock;
+}
+
+void SlabMemoryManager::removeSlab(Slab *&list, Slab *slab) {
+    if (slab->prev != nullptr) {
+        slab->prev->next = slab->next;
+    } else {
+        list = slab->next;
+    }
+
+    if (slab->next != nullptr) {
+        slab->next->prev = slab->prev;
+    }
+
+    slab->prev = nullptr;
+    slab->next = nullptr;
+}
+
+void SlabMemoryManager::insertSlab(Slab *&list, Slab *slab) {
+    slab->prev = nullptr;
+    slab->next = list;
+    if (list != nullptr) {
+        list->prev = slab;
+    }
+
+    list = slab;
+}
+
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SLABMEMORYMANAGER_H
+#define HHUOS_SLABMEMORYMANAGER_H
+
+#include <cstdint>
+
+#include "lib/util/async/Spinlock.h"
+#include "FreeListMemoryManager.h"
+#include "HeapMemoryManager.h"
+#include "lib/util/base/String.h"
+#include "lib/util/reflection/Prototype.h"
+
+namespace Util {
+
+/**
+ * Memory manager, that serves small allocations (up to 2 KiB) from slabs of equally sized objects.
+ *
+ * Each power of two size class has its own lock and a list of partially used slabs, so that allocating and freeing
+ * a small object only needs to pop or push an element of a free list. Slabs and all larger allocations are taken
+ * from an internal FreeListMemoryManager. A bitmap over the managed area tells, whether a freed pointer belongs to a slab.
+ * The bitmap is split into blocks, which are only allocated once the first slab inside their range is created.
+ */
+class SlabMemoryManager : public HeapMemoryManager {
+
+public:
+    /**
+     * Constructor.
+     */
+    SlabMemoryManager() = default;
+
+    /**
+     * Copy Constructor.
+     */
+    SlabMemoryManager(const SlabMemoryManager &copy) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SlabMemoryManager& operator=(const SlabMemoryManager &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SlabMemoryManager() override = default;
+
+    PROTOTYPE_IMPLEMENT_CLONE(SlabMemoryManager);
+
+    PROTOTYPE_IMPLEMENT_GET_CLASS_NAME("Util::SlabMemoryManager")
+
+    /**
+     * Overriding function from HeapMemoryManager.
+     */
+    void initialize(uint32_t startAddress, uint32_t endAddress) override;
+
+    /**
+     * Overriding function from HeapMemoryManager.
+     */
+    [[nodiscard]] void* allocateMemory(uint32_t size, uint32_t alignment) override;
+
+    /**
+     * Overriding function from HeapMemoryManager.
+     */
+    [[nodiscard]] void* reallocateMemory(void *pointer, uint32_t size, uint32_t alignment) override;
+
+    /**
+     * Overriding function from HeapMemoryManager.
+     */
+    void freeMemory(void *pointer, uint32_t alignment) override;
+
+    /**
+     * Overriding function from MemoryManager.
+     */
+    [[nodiscard]] uint32_t getTotalMemory() const override;
+
+    /**
+     * Overriding function from MemoryManager.
+     */
+    [[nodiscard]] uint32_t getFreeMemory() const override;
+
+    /**
+     * Overriding function from MemoryManager.
+     */
+    [[nodiscard]] uint32_t getStartAddress() const override;
+
+    /**
+     * Overriding function from MemoryManager.
+     */
+    [[nodiscard]] uint32_t getEndAddress() const override;
+
+private:
+
+    static const constexpr uint32_t MIN_OBJECT_SIZE = 8;
+    static const constexpr uint32_t SIZE_CLASS_COUNT = 9;
+    static const constexpr uint32_t MAX_OBJECT_SIZE = MIN_OBJECT_SIZE << (SIZE_CLASS_COUNT - 1);
+    static const constexpr uint32_t SLAB_SIZE = 0x4000;
+    static const constexpr uint32_t BITMAP_BLOCK_SIZE = 512;
+    static const constexpr uint32_t SLABS_PER_BITMAP_BLOCK = BITMAP_BLOCK_SIZE * 8;
+
+    /**
+     * Header at the beginning of each slab. Free objects are chained through their first word.
+     */
+    struct Slab {
+        Slab *prev;
+        Slab *next;
+        void *freeList;
+        uint32_t freeObjects;
+        uint32_t sizeClass;
+    };
+
+    struct SizeClass {
+        Async::Spinlock lock;
+        Slab *partialSlabs = nullptr;
+        Slab *emptySlab = nullptr;
+        uint32_t objectSize = 0;
+        uint32_t firstObjectOffset = 0;
+        uint32_t objectsPerSlab = 0;
+        uint32_t freeObjects = 0;
+    };
+
+    [[nodiscard]] static int32_t getSizeClass(uint32_t size, uint32_t alignment);
+
+    [[nodiscard]] bool isSlabObject(const void *pointer);
+
+    [[nodiscard]] Slab* getSlab(const void *pointer) const;
+
+    /**
+     * Get the bitmap block, which contains the bit of the given slab position.
+     *
+     * @param slabIndex The slab position, relative to the beginning of the managed area
+     * @param allocate Allocate the block, if it does not exist yet
+     * @return The bitmap block, or nullptr if it does not exist (and could not be allocated)
+     */
+    uint32_t* getBitmapBlock(uint32_t slabIndex, bool allocate);
+
+    Slab* createSlab(uint32_t sizeClass);
+
+    void destroySlab(Slab *slab);
+
+    static void removeSlab(Slab *&list, Slab *slab);
+
+    static void insertSlab(Slab *&list, Slab *slab);
+
+    FreeListMemoryManager backend;
+    SizeClass sizeClasses[SIZE_CLASS_COUNT];
+    // Addresses of the bitmap blocks (0, if not allocated yet)
+    uint32_t *slabBitmap = nullptr;
+    uint32_t slabBase = 0;
+};
+
+}
+
+#endif
@@ -18,7 +18,6 @@
 #include <cstdarg>
 #include <cstdint>
 
-#include "lib/interface.h"
 #include "lib/util/io/stream/ByteArrayOutputStream.h"
 #include "lib/util/io/stream/PrintStream.h"
 #include "lib/util/collection/ArrayList.h"
@@ -27,120 +26,154 @@
 #include "lib/util/collection/Collection.h"
 #include "lib/util/collection/Iterator.h"
 #include "lib/util/base/String.h"
+#include "lib/util/base/Move.h"
 #include "lib/util/collection/Array.h"
 
 namespace Util {
 
 String::String() noexcept {
-    len = 0;
-    buffer = new char[1];
-    buffer[0] = '\0';
+    initialize(nullptr, 0);
 }
 
 String::String(char character) noexcept {
-    len = 1;
-    buffer = new char[2];
-    buffer[0] = character;
-    buffer[1] = '\0';
+    initialize(&character, 1);
 }
 
 String::String(const char *string) noexcept {
-    auto address = Address<uint32_t>(string);
-
-    if (string == nullptr) {
-        len = 0;
-    } else {
-        len = address.stringLength();
-    }
-
-    buffer = new char[len + 1];
-    Address<uint32_t>(buffer).copyRange(address, len);
-    buffer[len] = '\0';
+    initialize(string, string == nullptr ? 0 : Address<uint32_t>(string).stringLength());
 }
 
 String::String(const uint8_t *data, uint32_t length) noexcept {
-    auto address = Address<uint32_t>(data);
+    initialize(reinterpret_cast<const char*>(data), length);
+}
 
-    len = length;
-    buffer = new char[len + 1];
-    Address<uint32_t>(buffer).copyRange(address, len);
-    buffer[len] = '\0';
+String::String(const StringView &view) noexcept {
+    initialize(view.data(), view.length());
 }
 
 String::String(const String &other) noexcept {
+    initialize(other.buffer, other.len);
+}
+
+String::String(String &&other) noexcept {
+    if (other.isInline()) {
+        initialize(other.buffer, other.len);
+        other.len = 0;
+        other.buffer[0] = '\0';
+        return;
+    }
+
+    buffer = other.buffer;
     len = other.len;
-    buffer = new char[len + 1];
-    Address<uint32_t>(buffer).copyRange(Address<uint32_t>(other.buffer), len);
-    buffer[len] = '\0';
+    capacity = other.capacity;
+    other.initialize(nullptr, 0);
 }
 
 String::~String() {
-    delete[] buffer;
+    if (!isInline()) {
+        delete[] buffer;
+    }
 }
 
-uint32_t String::hashCode() const {
-    uint32_t hash = 0;
+void String::initialize(const char *data, uint32_t length) {
+    len = length;
 
-    for (uint32_t i = 0; i < len; i++) {
-        hash += buffer[i];
+    if (length <= INLINE_CAPACITY) {
+        buffer = inlineBuffer;
+        capacity = INLINE_CAPACITY;
+    } else {
+        buffer = new char[length + 1];
+        capacity = length;
     }
 
-    return hash;
-}
+    if (length > 0) {
+        Address<uint32_t>(buffer).copyRange(Address<uint32_t>(data), length);
+    }
 
-String String::substring(uint32_t begin) const {
-    return substring(begin, length());
+    buffer[length] = '\0';
 }
 
-String String::substring(uint32_t begin, uint32_t end) const {
-    if (begin > end || begin >= len) {
-        return "";
+void String::append(const char *data, uint32_t length) {
+    if (length == 0) {
+        return;
     }
 
-    if (end > len) {
-        end = len;
-    }
+    uint32_t newLength = len + length;
+    if (newLength > capacity) {
+        // Grow geometrically, so that appending in a loop only reallocates a logarithmic number of times
+        uint32_t newCapacity = capacity * 2 > newLength ? capacity * 2 : newLength;
+        auto *newBuffer = new char[newCapacity + 1];
+        Address<uint32_t>(newBuffer).copyRange(Address<uint32_t>(buffer), len);
+        // 'data' may point into the old buffer (e.g. when appending a string to itself), so it is freed afterwards
+        Address<uint32_t>(newBuffer + len).copyRange(Address<uint32_t>(data), length);
+
+        if (!isInline()) {
+            delete[] buffer;
+        }
 
-    uint32_t length = end - begin;
-    char *newBuffer = new char[length + 1];
-    Address<uint32_t>(newBuffer).copyRange(Address<uint32_t>(this->buffer + begin), length);
-    newBuffer[length] = '\0';
+        buffer = newBuffer;
+        capacity = newCapacity;
+    } else {
+        Address<uint32_t>(buffer + len).copyRange(Address<uint32_t>(data), length);
+    }
 
-    String ret(newBuffer);
-    delete[] newBuffer;
+    len = newLength;
+    buffer[len] = '\0';
+}
 
-    return ret;
+bool String::isInline() const {
+    return buffer == inlineBuffer;
 }
 
-Util::Array<String> String::split(const String &delimiter, uint32_t limit) const {
-    Util::ArrayList<String> result;
+uint32_t String::getCapacity() const {
+    return capacity;
+}
 
-    if (len == 0) {
-        return result.toArray();
+void String::ensureCapacity(uint32_t newCapacity) {
+    if (newCapacity <= capacity) {
+        return;
     }
 
-    uint32_t start = 0;
-    uint32_t end = indexOf(delimiter);
-    String element;
+    auto *newBuffer = new char[newCapacity + 1];
+    Address<uint32_t>(newBuffer).copyRange(Address<uint32_t>(buffer), len + 1);
 
-    while (end != UINT32_MAX && result.size() + 1 != limit) {
-        element = substring(start, end);
+    if (!isInline()) {
+        delete[] buffer;
+    }
 
-        if (!element.isEmpty()) {
-            result.add(element);
-        }
+    buffer = newBuffer;
+    capacity = newCapacity;
+}
+
+uint32_t String::hashCode() const {
+    // FNV-1a, so that strings with the same characters in a different order (e.g. "ab" and "ba") do not collide
+    uint32_t hash = 2166136261;
 
-        start = end + delimiter.len;
-        end = indexOf(delimiter, start);
+    for (uint32_t i = 0; i < len; i++) {
+        hash ^= static_cast<uint8_t>(buffer[i]);
+        hash *= 16777619;
     }
 
-    element = substring(start, len);
+    return hash;
+}
+
+String String::substring(uint32_t begin) const {
+    return substring(begin, length());
+}
+
+String String::substring(uint32_t begin, uint32_t end) const {
+    return String(StringView(*this).substring(begin, end));
+}
 
-    if (!element.isEmpty()) {
-        result.add(element);
+Util::Array<String> String::split(const StringView &delimiter, uint32_t limit) const {
+    auto tokens = StringView(*this).split(delimiter, limit);
+    auto result = Util::Array<String>(tokens.length());
+
+    for (uint32_t i = 0; i < tokens.length(); i++) {
+        result[i] = String(tokens[i]);
     }
 
-    return result.toArray();
+    return result;
 }
 
 bool String::isEmpty() const {
@@ -157,60 +190,49 @@ uint32_t String::indexOf(char character, uint32_t start) const {
     return UINT32_MAX;
 }
 
-uint32_t String::indexOf(const String &other, uint32_t start) const {
-    uint32_t i;
-    uint32_t j = 0;
-
-    for (i = start; i < len; i++) {
-        if (buffer[i] == other.buffer[0]) {
-            for (j = 1; j < other.len; j++) {
-                if (i + j >= len) {
-                    return UINT32_MAX;
-                }
-
-                if (buffer[i + j] != other.buffer[j]) {
-                    break;
-                }
-            }
-        }
-
-        if (j == other.len) {
-            return i;
-        }
-    }
-
-    return UINT32_MAX;
-
+uint32_t String::indexOf(const StringView &other, uint32_t start) const {
+    return StringView(*this).indexOf(other, start);
 }
 
-
-String String::remove(const String &string) const {
+String String::remove(const StringView &string) const {
     uint32_t index = indexOf(string);
 
     if (index == UINT32_MAX) {
-        return String(buffer);
+        return *this;
     }
 
-    return substring(0, index) + substring(index + string.len, len);
+    String tmp;
+    tmp.ensureCapacity(len - string.length());
+    tmp.append(buffer, index);
+    tmp.append(buffer + index + string.length(), len - index - string.length());
+
+    return tmp;
 }
 
-String String::removeAll(const String &string) const {
-    Util::Array<String> tokens = split(string);
+String String::removeAll(const StringView &string) const {
+    if (string.isEmpty()) {
+        return *this;
+    }
+
     String tmp;
+    tmp.ensureCapacity(len);
 
-    for (const String &token : tokens) {
-        tmp += token;
+    uint32_t start = 0;
+    for (uint32_t index = indexOf(string); index != UINT32_MAX; index = indexOf(string, start)) {
+        tmp.append(buffer + start, index - start);
+        start = index + string.length();
     }
 
+    tmp.append(buffer + start, len - start);
     return tmp;
 }
 
-bool String::beginsWith(const String &string) const {
-    return substring(0, string.len) == string;
+bool String::beginsWith(const StringView &string) const {
+    return StringView(*this).beginsWith(string);
 }
 
-bool String::endsWith(const String &string) const {
-    return substring(len - string.len, len) == string;
+bool String::endsWith(const StringView &string) const {
+    return StringView(*this).endsWith(string);
 }
 
 
@@ -231,59 +253,97 @@ String &String::operator=(const String &other) {
         return *this;
     }
 
-    delete buffer;
-    buffer = nullptr;
+    if (other.len > capacity) {
+        if (!isInline()) {
+            delete[] buffer;
+        }
+
+        buffer = new char[other.len + 1];
+        capacity = other.len;
+    }
+
     len = other.len;
-    buffer = new char[len + 1];
+    Address<uint32_t>(buffer).copyRange(Address<uint32_t>(other.buffer), len + 1);
 
-    if (other.buffer != nullptr) {
-        Address<uint32_t>(buffer).copyRange(Address<uint32_t>(other.buffer), len + 1);
+    return *this;
+}
+
+String &String::operator=(String &&other) noexcept {
+    if (&other == this) {
+        return *this;
+    }
+
+    if (other.isInline()) {
+        *this = other;
+        other.len = 0;
+        other.buffer[0] = '\0';
+        return *this;
     }
 
+    if (!isInline()) {
+        delete[] buffer;
+    }
+
+    buffer = other.buffer;
+    len = other.len;
+    capacity = other.capacity;
+    other.initialize(nullptr, 0);
+
     return *this;
 }
 
-String &String::operator+=(const String &other) {
-    buffer = static_cast<char*>(reallocateMemory(buffer, len + other.len + 1));
-    Address<uint32_t>(buffer + len).copyRange(Address<uint32_t>(other.buffer), other.len + 1);
-    len += other.len;
+String &String::operator+=(const StringView &other) {
+    append(other.data(), other.length());
+    return *this;
+}
 
+String &String::operator+=(char other) {
+    append(&other, 1);
     return *this;
 }
 
-String operator+(const String &first, const String &second) {
-    String tmp = first;
+static String concatenate(const StringView &first, const StringView &second) {
+    String tmp;
+    tmp.ensureCapacity(first.length() + second.length());
+    tmp += first;
     tmp += second;
 
     return tmp;
 }
 
-String operator+(const String &first, char second) {
-    String tmp = first;
-    tmp += String(second);
+String operator+(const String &first, const String &second) {
+    return concatenate(first, second);
+}
 
-    return tmp;
+String operator+(const String &first, char second) {
+    return concatenate(first, StringView(&second, 1));
 }
 
 String operator+(const String &first, const char *second) {
-    String tmp = first;
-    tmp += String(second);
-
-    return tmp;
+    return concatenate(first, second);
 }
 
 String operator+(char first, const String &second) {
-    String tmp(first);
-    tmp += second;
-
-    return tmp;
+    return concatenate(StringView(&first, 1), second);
 }
 
 String operator+(const char *first, const String &second) {
-    String tmp(first);
-    tmp += second;
+    return concatenate(first, second);
+}
 
-    return tmp;
+String operator+(String &&first, const String &second) {
+    first += second;
+    return move(first);
+}
+
+String operator+(String &&first, char second) {
+    first += second;
+    return move(first);
+}
+
+String operator+(String &&first, const char *second) {
+    first += second;
+    return move(first);
 }
 
 String::operator char *() const {
@@ -311,24 +371,31 @@ char &String::operator[](uint32_t index) {
 }
 
 String::operator uint32_t() const {
-    uint32_t hash = 0;
-
-    for (uint32_t i = 0; i < len; i++) {
-        hash += buffer[i];
-    }
-
-    return hash;
+    return hashCode();
 }
 
 String String::join(const String &separator, const Util::Array<String> &elements) {
-    String tmp = "";
+    String tmp;
     uint32_t size = elements.length();
 
-    for (uint32_t i = 0; i < size - 1; i++) {
-        tmp += elements[i] + separator;
+    if (size == 0) {
+        return tmp;
+    }
+
+    uint32_t length = separator.len * (size - 1);
+    for (const auto &element : elements) {
+        length += element.len;
+    }
+
+    tmp.ensureCapacity(length);
+    for (uint32_t i = 0; i < size; i++) {
+        if (i > 0) {
+            tmp += separator;
+        }
+
+        tmp += elements[i];
     }
 
-    tmp += elements[size - 1];
     return tmp;
 }
 
@@ -21,10 +21,15 @@
 #include <cstdint>
 #include <cstdarg>
 #include "lib/util/collection/Array.h"
+#include "lib/util/base/StringView.h"
 
 namespace Util {
 
 /**
+ * Strings of up to INLINE_CAPACITY characters are stored inside the object itself (small string optimization),
+ * so that short strings do not touch the heap. Longer strings keep their heap buffer with spare capacity,
+ * which is reused by assignments and appends.
+ *
  * @author Filip Krakowski
  */
 class String {
@@ -39,8 +44,12 @@ public:
 
     String(const uint8_t *data, uint32_t length) noexcept;
 
+    explicit String(const StringView &view) noexcept;
+
     String(const String &other) noexcept;
 
+    String(String &&other) noexcept;
+
     ~String();
 
     [[nodiscard]] uint32_t hashCode() const;
@@ -49,25 +58,35 @@ public:
 
     [[nodiscard]] uint32_t indexOf(char character, uint32_t start = 0) const;
 
-    [[nodiscard]] uint32_t indexOf(const String &other, uint32_t start = 0) const;
+    [[nodiscard]] uint32_t indexOf(const StringView &other, uint32_t start = 0) const;
 
     [[nodiscard]] bool isEmpty() const;
 
+    /**
+     * Get the number of characters, that fit into the current buffer without reallocating it.
+     */
+    [[nodiscard]] uint32_t getCapacity() const;
+
+    /**
+     * Make sure, that at least `capacity` characters fit into the buffer (e.g. before appending in a loop).
+     */
+    void ensureCapacity(uint32_t capacity);
+
     [[nodiscard]] String substring(uint32_t begin) const;
 
     [[nodiscard]] String substring(uint32_t begin, uint32_t end) const;
 
     [[nodiscard]] String strip() const;
 
-    [[nodiscard]] Array<String> split(const String &delimiter, uint32_t limit = 0) const;
+    [[nodiscard]] Array<String> split(const StringView &delimiter, uint32_t limit = 0) const;
 
-    [[nodiscard]] String remove(const String &string) const;
+    [[nodiscard]] String remove(const StringView &string) const;
 
-    [[nodiscard]] String removeAll(const String &string) const;
+    [[nodiscard]] String removeAll(const StringView &string) const;
 
-    [[nodiscard]] bool beginsWith(const String &string) const;
+    [[nodiscard]] bool beginsWith(const StringView &string) const;
 
-    [[nodiscard]] bool endsWith(const String &string) const;
+    [[nodiscard]] bool endsWith(const StringView &string) const;
 
     [[nodiscard]] bool contains(char c) const;
 
@@ -99,7 +118,11 @@ public:
 
     String &operator=(const String &other);
 
-    String &operator+=(const String &other);
+    String &operator=(String &&other) noexcept;
+
+    String &operator+=(const StringView &other);
+
+    String &operator+=(char other);
 
     friend String operator+(const String &first, const String &second);
 
@@ -107,6 +130,12 @@ public:
 
     friend String operator+(const String &first, const char *second);
 
+    friend String operator+(String &&first, const String &second);
+
+    friend String operator+(String &&first, char second);
+
+    friend String operator+(String &&first, const char *second);
+
     friend String operator+(char first, const String &string);
 
     friend String operator+(const char *first, const String &second);
@@ -127,10 +156,19 @@ public:
 
 private:
 
-    char *buffer;
-    uint32_t len;
+    void initialize(const char *data, uint32_t length);
+
+    void append(const char *data, uint32_t length);
+
+    [[nodiscard]] bool isInline() const;
 
     static const constexpr uint8_t CASE_OFFSET = 32;
+    static const constexpr uint32_t INLINE_CAPACITY = 19;
+
+    char *buffer;
+    uint32_t len;
+    uint32_t capacity;
+    char inlineBuffer[INLINE_CAPACITY + 1];
 };
 
 }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "StringView.h"
+
+#include "lib/util/base/Address.h"
+#include "lib/util/base/String.h"
+
+namespace Util {
+
+StringView::StringView(const char *string) {
+    if (string != nullptr) {
+        characters = string;
+        len = Address<uint32_t>(string).stringLength();
+    }
+}
+
+StringView::StringView(const char *data, uint32_t length) : characters(data), len(length) {}
+
+StringView::StringView(const String &string) : characters(static_cast<const char*>(string)), len(string.length()) {}
+
+const char* StringView::data() const {
+    return characters;
+}
+
+uint32_t StringView::length() const {
+    return len;
+}
+
+bool StringView::isEmpty() const {
+    return len == 0;
+}
+
+uint32_t StringView::indexOf(char character, uint32_t start) const {
+    for (uint32_t i = start; i < len; i++) {
+        if (characters[i] == character) {
+            return i;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+uint32_t StringView::indexOf(const StringView &other, uint32_t start) const {
+    if (other.len == 0) {
+        return start <= len ? start : UINT32_MAX;
+    }
+
+    if (other.len > len) {
+        return UINT32_MAX;
+    }
+
+    for (uint32_t i = start; i <= len - other.len; i++) {
+        if (characters[i] == other.characters[0] && Address<uint32_t>(characters + i).compareRange(Address<uint32_t>(other.characters), other.len) == 0) {
+            return i;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+uint32_t StringView::lastIndexOf(char character) const {
+    for (uint32_t i = len; i > 0; i--) {
+        if (characters[i - 1] == character) {
+            return i - 1;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+StringView StringView::substring(uint32_t begin) const {
+    return substring(begin, len);
+}
+
+StringView StringView::substring(uint32_t begin, uint32_t end) const {
+    if (begin > end || begin >= len) {
+        return {};
+    }
+
+    if (end > len) {
+        end = len;
+    }
+
+    return {characters + begin, end - begin};
+}
+
+Array<StringView> StringView::split(const StringView &delimiter, uint32_t limit) const {
+    // Count the tokens first, so that the result can be filled without an intermediate list
+    auto result = Array<StringView>(tokenize(delimiter, limit, nullptr));
+    tokenize(delimiter, limit, result.begin());
+
+    return result;
+}
+
+uint32_t StringView::tokenize(const StringView &delimiter, uint32_t limit, StringView *tokens) const {
+    if (len == 0) {
+        return 0;
+    }
+
+    if (delimiter.isEmpty()) {
+        if (tokens != nullptr) {
+            tokens[0] = *this;
+        }
+
+        return 1;
+    }
+
+    uint32_t count = 0;
+    uint32_t start = 0;
+    uint32_t end = indexOf(delimiter);
+
+    while (end != UINT32_MAX && count + 1 != limit) {
+        if (end > start) {
+            if (tokens != nullptr) {
+                tokens[count] = StringView(characters + start, end - start);
+            }
+
+            count++;
+        }
+
+        start = end + delimiter.len;
+        end = indexOf(delimiter, start);
+    }
+
+    if (start < len) {
+        if (tokens != nullptr) {
+            tokens[count] = StringView(characters + start, len - start);
+        }
+
+        count++;
+    }
+
+    return count;
+}
+
+bool StringView::beginsWith(const StringView &other) const {
+    return other.len <= len && Address<uint32_t>(characters).compareRange(Address<uint32_t>(other.characters), other.len) == 0;
+}
+
+bool StringView::endsWith(const StringView &other) const {
+    return other.len <= len && Address<uint32_t>(characters + len - other.len).compareRange(Address<uint32_t>(other.characters), other.len) == 0;
+}
+
+String StringView::toString() const {
+    return String(*this);
+}
+
+bool StringView::operator==(const StringView &other) const {
+    return len == other.len && Address<uint32_t>(characters).compareRange(Address<uint32_t>(other.characters), len) == 0;
+}
+
+bool StringView::operator!=(const StringView &other) const {
+    return !(*this == other);
+}
+
+char StringView::operator[](uint32_t index) const {
+    return characters[index];
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_STRINGVIEW_H
+#define HHUOS_STRINGVIEW_H
+
+#include <cstdint>
+
+#include "lib/util/collection/Array.h"
+
+namespace Util {
+
+class String;
+
+/**
+ * Non-owning, read-only view of a sequence of characters.
+ * A view never allocates memory, so comparisons and searches on parts of a string do not create temporary strings.
+ * The referenced characters must outlive the view and are not necessarily null-terminated.
+ */
+class StringView {
+
+public:
+    /**
+     * Default Constructor (empty view).
+     */
+    StringView() = default;
+
+    /**
+     * Create a view of a null-terminated string.
+     */
+    StringView(const char *string);
+
+    /**
+     * Create a view of the first `length` characters at `data`.
+     */
+    StringView(const char *data, uint32_t length);
+
+    /**
+     * Create a view of the characters of a string.
+     */
+    StringView(const String &string);
+
+    /**
+     * Copy Constructor.
+     */
+    StringView(const StringView &other) = default;
+
+    /**
+     * Assignment operator.
+     */
+    StringView &operator=(const StringView &other) = default;
+
+    /**
+     * Destructor.
+     */
+    ~StringView() = default;
+
+    [[nodiscard]] const char* data() const;
+
+    [[nodiscard]] uint32_t length() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] uint32_t indexOf(char character, uint32_t start = 0) const;
+
+    [[nodiscard]] uint32_t indexOf(const StringView &other, uint32_t start = 0) const;
+
+    [[nodiscard]] uint32_t lastIndexOf(char character) const;
+
+    [[nodiscard]] StringView substring(uint32_t begin) const;
+
+    [[nodiscard]] StringView substring(uint32_t begin, uint32_t end) const;
+
+    /**
+     * Split the view at each occurrence of `delimiter`. Empty tokens are skipped, like in String::split().
+     * The returned views reference the characters of this view.
+     */
+    [[nodiscard]] Array<StringView> split(const StringView &delimiter, uint32_t limit = 0) const;
+
+    [[nodiscard]] bool beginsWith(const StringView &other) const;
+
+    [[nodiscard]] bool endsWith(const StringView &other) const;
+
+    /**
+     * Copy the viewed characters into a new string.
+     */
+    [[nodiscard]] String toString() const;
+
+    bool operator==(const StringView &other) const;
+
+    bool operator!=(const StringView &other) const;
+
+    char operator[](uint32_t index) const;
+
+private:
+
+    uint32_t tokenize(const StringView &delimiter, uint32_t limit, StringView *tokens) const;
+
+    const char *characters = "";
+    uint32_t len = 0;
+};
+
+}
+
+#endif
@@ -22,6 +22,7 @@
 #include "lib/util/io/stream/FileInputStream.h"
 #include "lib/util/io/stream/FileOutputStream.h"
 #include "lib/util/io/stream/PrintStream.h"
+#include "lib/util/hardware/CpuId.h"
 
 namespace Util {
 
@@ -35,6 +36,7 @@ Io::FileOutputStream System::errorStream(2);
 Io::BufferedOutputStream System::bufferedErrorStream(errorStream);
 Io::PrintStream System::error(bufferedErrorStream);
 const char *System::errorMessage = "";
+System::EntryMethod System::entryMethod = UNKNOWN;
 
 bool System::call(System::Code code, uint32_t paramCount...) {
     va_list args;
@@ -52,6 +54,23 @@ void System::call(Code code, bool &result, uint32_t paramCount, va_list args) {
     auto ebxValue = reinterpret_cast<uint32_t>(args);
     auto ecxValue = reinterpret_cast<uint32_t>(&result);
 
+    if (getEntryMethod() == SYSENTER) {
+        // 'sysenter' does not save the return address and user stack pointer, so they are passed in edx and ecx.
+        // The kernel restores all other registers.
+        asm volatile (
+                "mov %%esp, %%ecx;"
+                "mov $1f, %%edx;"
+                "sysenter;"
+                "1:"
+                : :
+                "a"(eaxValue),
+                "b"(ebxValue),
+                "S"(ecxValue)
+                : "ecx", "edx", "memory");
+
+        return;
+    }
+
     asm volatile (
             "push %%eax;"
             "push %%ebx;"
@@ -72,4 +91,29 @@ void System::call(Code code, bool &result, uint32_t paramCount, va_list args) {
             : "eax", "ebx", "ecx");
 }
 
+System::EntryMethod System::getEntryMethod() {
+    if (entryMethod == UNKNOWN) {
+        entryMethod = isSysenterUsable() ? SYSENTER : INTERRUPT;
+    }
+
+    return entryMethod;
+}
+
+System::EntryMethod System::setEntryMethod(EntryMethod method) {
+    entryMethod = (method == SYSENTER && !isSysenterUsable()) ? INTERRUPT : method;
+    return getEntryMethod();
+}
+
+bool System::isSysenterUsable() {
+    // The kernel itself (which shares this library) must not use 'sysenter', since 'sysexit' always returns to ring 3
+    uint16_t codeSegment;
+    asm volatile ("mov %%cs, %0" : "=r"(codeSegment));
+    if ((codeSegment & 0x03) != 0x03) {
+        return false;
+    }
+
+    // The kernel programs the SYSENTER registers on all CPUs, that report support for 'sysenter'
+    return Hardware::CpuId::isAvailable() && (Hardware::CpuId::getCpuFeatureBits() & Hardware::CpuId::SEP) != 0;
+}
+
 }
\ No newline at end of file
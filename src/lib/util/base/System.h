@@ -70,7 +70,26 @@ public:
         GET_SYSTEM_TIME,
         SET_DATE,
         GET_CURRENT_DATE,
-        SHUTDOWN
+        SHUTDOWN,
+        ENTER_SYSTEM_CALL_RING,
+        NO_OPERATION,
+        SET_THREAD_PRIORITY,
+        FUTEX_WAIT,
+        FUTEX_WAKE,
+        WRITE_TO_FILE,
+        READ_FROM_FILE,
+        SEEK_FILE,
+        MAP_FILE,
+        UNMAP_FILE,
+        READ_FROM_FILE_VECTORED,
+        WRITE_TO_FILE_VECTORED,
+        CREATE_PIPE
+    };
+
+    enum EntryMethod : uint8_t {
+        UNKNOWN,
+        INTERRUPT,
+        SYSENTER
     };
 
     /**
@@ -96,6 +115,20 @@ public:
 
     static bool call(Code code, uint32_t paramCount...);
 
+    /**
+     * Get the instruction used to enter the kernel.
+     * 'sysenter' is used in user space, if the CPU supports it. Otherwise, 'int 0x86' is used.
+     */
+    [[nodiscard]] static EntryMethod getEntryMethod();
+
+    /**
+     * Select the instruction used to enter the kernel (e.g. to compare both methods).
+     * Selecting SYSENTER has no effect, if 'sysenter' is not usable.
+     *
+     * @return The entry method, which is used from now on
+     */
+    static EntryMethod setEntryMethod(EntryMethod method);
+
     static Io::InputStream &in;
     static Io::PrintStream out;
     static Io::PrintStream error;
@@ -106,6 +139,10 @@ private:
 
     static void call(Code code, bool &result, uint32_t paramCount, va_list args);
 
+    [[nodiscard]] static bool isSysenterUsable();
+
+    static EntryMethod entryMethod;
+
     static Io::FileInputStream inStream;
     static Io::BufferedInputStream bufferedInStream;
 
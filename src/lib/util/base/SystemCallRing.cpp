@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "SystemCallRing.h"
+
+#include "lib/util/base/Exception.h"
+
+namespace Util {
+
+SystemCallRing::SystemCallRing(uint32_t size) {
+    uint32_t entries = 1;
+    while (entries < size) {
+        entries <<= 1;
+    }
+
+    header.mask = entries - 1;
+    header.submissions = new Submission[entries];
+    header.completions = new Completion[entries];
+}
+
+SystemCallRing::~SystemCallRing() {
+    delete[] header.submissions;
+    delete[] header.completions;
+}
+
+uint32_t SystemCallRing::enter() {
+    uint32_t executed = 0;
+    System::call(System::ENTER_SYSTEM_CALL_RING, 2, &header, &executed);
+    return executed;
+}
+
+bool SystemCallRing::reap(Completion &completion) {
+    if (header.completionHead == header.completionTail) {
+        return false;
+    }
+
+    completion = header.completions[header.completionHead & header.mask];
+    header.completionHead = header.completionHead + 1;
+    return true;
+}
+
+uint32_t SystemCallRing::getSize() const {
+    return header.mask + 1;
+}
+
+uint32_t SystemCallRing::getQueuedSubmissions() const {
+    return header.submissionTail - header.submissionHead;
+}
+
+uint32_t SystemCallRing::getAvailableCompletions() const {
+    return header.completionTail - header.completionHead;
+}
+
+void SystemCallRing::pack(Submission &submission, int32_t argument) {
+    pack(submission, static_cast<uint32_t>(argument));
+}
+
+void SystemCallRing::pack(Submission &submission, uint32_t argument) {
+    if (submission.argumentWords >= MAX_ARGUMENT_WORDS) {
+        Exception::throwException(Exception::OUT_OF_BOUNDS, "SystemCallRing: Too many arguments!");
+    }
+
+    submission.arguments[submission.argumentWords++] = argument;
+}
+
+void SystemCallRing::pack(Submission &submission, int64_t argument) {
+    pack(submission, static_cast<uint64_t>(argument));
+}
+
+void SystemCallRing::pack(Submission &submission, uint64_t argument) {
+    // 64 bit arguments occupy two stack slots (lower half first)
+    pack(submission, static_cast<uint32_t>(argument));
+    pack(submission, static_cast<uint32_t>(argument >> 32));
+}
+
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SYSTEMCALLRING_H
+#define HHUOS_SYSTEMCALLRING_H
+
+#include <cstdint>
+
+#include "lib/util/base/System.h"
+
+namespace Util {
+
+/**
+ * A ring of system call submissions and completions, shared between a program and the kernel.
+ * A program queues any number of system calls (e.g. file and socket operations or sleeping) and hands them
+ * to the kernel with a single trap. The kernel executes them in order and posts a completion for each one.
+ * Results, which are returned via pointer parameters (e.g. the amount of bytes read), are written as usual.
+ *
+ * Arguments are stored as they would be laid out on the stack for a variadic function call,
+ * so the kernel dispatches each submission through the regular system call table.
+ * The ring is meant to be used by a single thread.
+ */
+class SystemCallRing {
+
+public:
+
+    static const constexpr uint32_t MAX_ARGUMENT_WORDS = 8;
+
+    struct Submission {
+        System::Code code;
+        uint8_t paramCount;
+        uint8_t argumentWords;
+        uint32_t arguments[MAX_ARGUMENT_WORDS];
+        uint32_t userData;
+    };
+
+    struct Completion {
+        uint32_t userData;
+        bool result;
+    };
+
+    /**
+     * The shared part of the ring. Positions are free running and masked on access.
+     * The kernel consumes submissions and produces completions, the program does the opposite.
+     */
+    struct Header {
+        volatile uint32_t submissionHead;
+        volatile uint32_t submissionTail;
+        volatile uint32_t completionHead;
+        volatile uint32_t completionTail;
+        uint32_t mask;
+        Submission *submissions;
+        Completion *completions;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param size The amount of entries (rounded up to a power of two)
+     */
+    explicit SystemCallRing(uint32_t size);
+
+    /**
+     * Copy Constructor.
+     */
+    SystemCallRing(const SystemCallRing &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SystemCallRing &operator=(const SystemCallRing &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SystemCallRing();
+
+    /**
+     * Queue a system call. Arguments must be 32 bit or 64 bit integers, pointers or unscoped enums.
+     *
+     * @param userData An arbitrary value, which is passed back with the completion
+     * @param code The system call code
+     * @param paramCount The parameter count, as passed to System::call()
+     *
+     * @return false, if the ring is full
+     */
+    template<typename ...Arguments>
+    bool submit(uint32_t userData, System::Code code, uint32_t paramCount, Arguments... arguments);
+
+    /**
+     * Hand all queued submissions to the kernel. This is the only trap needed for the whole batch.
+     * Submissions, for which there is no space in the completion queue yet, stay queued.
+     *
+     * @return The amount of executed submissions
+     */
+    uint32_t enter();
+
+    /**
+     * Take the next completion.
+     *
+     * @return false, if no completion is available
+     */
+    bool reap(Completion &completion);
+
+    [[nodiscard]] uint32_t getSize() const;
+
+    [[nodiscard]] uint32_t getQueuedSubmissions() const;
+
+    [[nodiscard]] uint32_t getAvailableCompletions() const;
+
+private:
+
+    static void pack(Submission &submission, int32_t argument);
+
+    static void pack(Submission &submission, uint32_t argument);
+
+    static void pack(Submission &submission, int64_t argument);
+
+    static void pack(Submission &submission, uint64_t argument);
+
+    template<typename T>
+    static void pack(Submission &submission, T *argument) {
+        pack(submission, reinterpret_cast<uint32_t>(argument));
+    }
+
+    Header header{};
+};
+
+template<typename ...Arguments>
+bool SystemCallRing::submit(uint32_t userData, System::Code code, uint32_t paramCount, Arguments... arguments) {
+    if (header.submissionTail - header.submissionHead > header.mask) {
+        return false;
+    }
+
+    auto &submission = header.submissions[header.submissionTail & header.mask];
+    submission.code = code;
+    submission.paramCount = paramCount;
+    submission.argumentWords = 0;
+    submission.userData = userData;
+    (pack(submission, arguments), ...);
+
+    header.submissionTail = header.submissionTail + 1;
+    return true;
+}
+
+}
+
+#endif
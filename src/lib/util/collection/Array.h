@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <initializer_list>
 #include "lib/util/base/Exception.h"
+#include "lib/util/base/Move.h"
 
 namespace Util {
 
@@ -42,8 +43,12 @@ public:
 
     Array(const Array<T> &other);
 
+    Array(Array<T> &&other) noexcept;
+
     Array<T> &operator=(const Array<T> &other);
 
+    Array<T> &operator=(Array<T> &&other) noexcept;
+
     T &operator[](uint32_t index);
 
     const T &operator[](uint32_t index) const;
@@ -70,7 +75,8 @@ private:
 
 template <class T>
 Array<T>::Array(uint32_t capacity) noexcept : capacity(capacity) {
-    this->array = new T[capacity];
+    // Empty arrays are common as return values, so they do not allocate memory
+    this->array = capacity == 0 ? nullptr : new T[capacity];
 }
 
 template<typename T>
@@ -80,7 +86,7 @@ Array<T>::~Array() {
 
 template <class T>
 Array<T>::Array(std::initializer_list<T> list) noexcept : capacity(list.size()) {
-    this->array = new T[list.size()];
+    this->array = capacity == 0 ? nullptr : new T[capacity];
     const T *source = list.begin();
     for (uint32_t i = 0; i < capacity; i++) {
         this->array[i] = source[i];
@@ -90,18 +96,30 @@ Array<T>::Array(std::initializer_list<T> list) noexcept : capacity(list.size())
 template <class T>
 Array<T>::Array(const Array<T> &other) {
     capacity = other.capacity;
-    array = new T[capacity];
+    array = capacity == 0 ? nullptr : new T[capacity];
 
     for (uint32_t i = 0; i < capacity; i++) {
         array[i] = other.array[i];
     }
 }
 
+template <class T>
+Array<T>::Array(Array<T> &&other) noexcept : array(other.array), capacity(other.capacity) {
+    other.array = nullptr;
+    other.capacity = 0;
+}
+
 template <class T>
 Array<T> &Array<T>::operator=(const Array<T> &other) {
-    delete[] array;
-    capacity = other.capacity;
-    array = new T[capacity];
+    if (&other == this) {
+        return *this;
+    }
+
+    if (capacity != other.capacity) {
+        delete[] array;
+        capacity = other.capacity;
+        array = capacity == 0 ? nullptr : new T[capacity];
+    }
 
     for (uint32_t i = 0; i < capacity; i++) {
         array[i] = other.array[i];
@@ -110,6 +128,21 @@ Array<T> &Array<T>::operator=(const Array<T> &other) {
     return *this;
 }
 
+template <class T>
+Array<T> &Array<T>::operator=(Array<T> &&other) noexcept {
+    if (&other == this) {
+        return *this;
+    }
+
+    delete[] array;
+    array = other.array;
+    capacity = other.capacity;
+    other.array = nullptr;
+    other.capacity = 0;
+
+    return *this;
+}
+
 template <class T>
 T &Array<T>::operator[](uint32_t index) {
     if (index >= capacity) {
@@ -140,13 +173,14 @@ T *Array<T>::begin() const {
 
 template <class T>
 T *Array<T>::end() const {
-    return &array[capacity];
+    return array + capacity;
 }
 
 template <class T>
 void Array<T>::clear() {
-    delete[] array;
-    array = new T[capacity];
+    for (uint32_t i = 0; i < capacity; i++) {
+        array[i] = T();
+    }
 }
 
 template <class T>
@@ -169,9 +203,7 @@ void Array<T>::sort(Array<T> &array) {
         hasChanged = false;
         for (uint32_t i = 0; i < length - 1; i++) {
             if (array[i] > array[i + 1]) {
-                T tmp = array[i];
-                array[i] = array[i + 1];
-                array[i + 1] = tmp;
+                Util::swap(array[i], array[i + 1]);
                 hasChanged = true;
             }
         }
@@ -19,9 +19,16 @@
 #define HHUOS_ARRAYQUEUE_H
 
 #include "Queue.h"
+#include "lib/util/base/Move.h"
+#include "lib/util/base/operators.h"
 
 namespace Util {
 
+/**
+ * A queue with a fixed capacity, backed by a ring buffer.
+ * The buffer is allocated as raw memory. Elements are constructed when they are offered
+ * and moved out and destroyed when they are polled.
+ */
 template <typename T>
 class ArrayBlockingQueue : public Queue<T> {
 
@@ -39,12 +46,24 @@ public:
 
     bool offer(const T &element) override;
 
+    bool offer(T &&element) override;
+
+    /**
+     * Construct a new element at the end of the queue from the given arguments.
+     *
+     * @return false, if the queue is full
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args);
+
     T poll() override;
 
     T peek() override;
 
     bool add(const T &element) override;
 
+    bool add(T &&element) override;
+
     bool addAll(const Collection<T> &other) override;
 
     bool remove(const T &element) override;
@@ -73,31 +92,41 @@ private:
     uint32_t capacity;
 
     uint32_t head = 0;
-    uint32_t tail = -1;
     uint32_t length = 0;
 
     static const uint32_t DEFAULT_CAPACITY = 16;
 };
 
 template<class T>
-ArrayBlockingQueue<T>::ArrayBlockingQueue() : elements(new T[DEFAULT_CAPACITY]), capacity(DEFAULT_CAPACITY) {}
+ArrayBlockingQueue<T>::ArrayBlockingQueue() : ArrayBlockingQueue(DEFAULT_CAPACITY) {}
 
 template<class T>
-ArrayBlockingQueue<T>::ArrayBlockingQueue(uint32_t capacity) : elements(new T[capacity]), capacity(capacity) {}
+ArrayBlockingQueue<T>::ArrayBlockingQueue(uint32_t capacity) : elements(static_cast<T*>(::operator new(capacity * sizeof(T)))), capacity(capacity) {}
 
 template<typename T>
 ArrayBlockingQueue<T>::~ArrayBlockingQueue() {
-    delete[] elements;
+    clear();
+    ::operator delete(elements);
 }
 
 template<class T>
 bool ArrayBlockingQueue<T>::offer(const T &element) {
+    return emplace(element);
+}
+
+template<class T>
+bool ArrayBlockingQueue<T>::offer(T &&element) {
+    return emplace(Util::move(element));
+}
+
+template<class T>
+template<typename... Args>
+bool ArrayBlockingQueue<T>::emplace(Args&&... args) {
     if (length == capacity) {
         return false;
     }
 
-    tail = (tail + 1) % capacity;
-    elements[tail] = element;
+    new (&elements[(head + length) % capacity]) T(Util::forward<Args>(args)...);
     length++;
 
     return true;
@@ -107,7 +136,8 @@ template<class T>
 T ArrayBlockingQueue<T>::poll() {
     while (length == 0) {}
 
-    auto &element = elements[head];
+    T element = Util::move(elements[head]);
+    elements[head].~T();
     head = (head + 1) % capacity;
     length--;
 
@@ -126,6 +156,12 @@ bool ArrayBlockingQueue<T>::add(const T &element) {
     return true;
 }
 
+template<class T>
+bool ArrayBlockingQueue<T>::add(T &&element) {
+    while (length == capacity) {}
+    return offer(Util::move(element));
+}
+
 template<class T>
 bool ArrayBlockingQueue<T>::addAll(const Collection<T> &other) {
     for (const auto &element : other) {
@@ -147,8 +183,8 @@ bool ArrayBlockingQueue<T>::removeAll(const Collection<T> &other) {
 
 template<class T>
 bool ArrayBlockingQueue<T>::contains(const T &element) const {
-    for (uint32_t i = head; i < tail; i++) {
-        if (elements[i] == element) {
+    for (uint32_t i = 0; i < length; i++) {
+        if (elements[(head + i) % capacity] == element) {
             return true;
         }
     }
@@ -174,8 +210,11 @@ bool ArrayBlockingQueue<T>::isEmpty() const {
 
 template<class T>
 void ArrayBlockingQueue<T>::clear() {
+    for (uint32_t i = 0; i < length; i++) {
+        elements[(head + i) % capacity].~T();
+    }
+
     head = 0;
-    tail = -1;
     length = 0;
 }
 
@@ -186,7 +225,8 @@ Iterator<T> ArrayBlockingQueue<T>::begin() const {
 
 template<class T>
 Iterator<T> ArrayBlockingQueue<T>::end() const {
-    return Iterator<T>(toArray(), length);
+    // Iterators are only compared by index, so the end iterator does not need a copy of the elements
+    return Iterator<T>(Array<T>(0), length);
 }
 
 template<class T>
@@ -197,8 +237,8 @@ uint32_t ArrayBlockingQueue<T>::size() const {
 template<class T>
 Array<T> ArrayBlockingQueue<T>::toArray() const {
     Array<T> array(length);
-    for (uint32_t i = head; i < tail; i++) {
-        array[i] = elements[i];
+    for (uint32_t i = 0; i < length; i++) {
+        array[i] = elements[(head + i) % capacity];
     }
 
     return array;
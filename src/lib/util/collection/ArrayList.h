@@ -22,12 +22,17 @@
 #include "List.h"
 #include "lib/util/base/Address.h"
 #include "lib/util/base/MmxAddress.h"
+#include "lib/util/base/Move.h"
 #include "lib/util/base/SseAddress.h"
+#include "lib/util/base/operators.h"
 
 namespace Util {
 
 /**
  * An implementation of the List interface backed by a dynamically growing array of elements.
+ * The array is allocated as raw memory and elements are only constructed when they are added,
+ * so reserving capacity does not default-construct any elements. When the array grows, its capacity
+ * is doubled and the elements are moved (not copied) into the new array.
  *
  * @author Filip Krakowski
  */
@@ -50,14 +55,27 @@ public:
 
     bool add(const T &element) override;
 
+    bool add(T &&element) override;
+
     void add(uint32_t index, const T &element) override;
 
+    void add(uint32_t index, T &&element) override;
+
+    /**
+     * Construct a new element at the end of the list from the given arguments,
+     * without creating a temporary element, that is copied or moved into the list.
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args);
+
     bool addAll(const Collection<T> &other) override;
 
     [[nodiscard]] T get(uint32_t index) const override;
 
     void set(uint32_t index, const T &element) override;
 
+    void set(uint32_t index, T &&element) override;
+
     bool remove(const T &element) override;
 
     bool removeAll(const Collection<T> &other) override;
@@ -86,6 +104,14 @@ private:
 
     void ensureCapacity(uint32_t newCapacity) override;
 
+    /**
+     * Make room for a new element at the given index by moving the following elements one slot to the back.
+     * Afterwards, the slot at `index` is unconstructed memory.
+     */
+    void openGap(uint32_t index);
+
+    static T* allocateElements(uint32_t capacity);
+
     T *elements = nullptr;
     uint32_t capacity = 0;
     uint32_t length = 0;
@@ -104,19 +130,23 @@ template <class T>
 ArrayList<T>::ArrayList(uint32_t capacity) noexcept {
     this->length = 0;
     this->capacity = capacity;
-    this->elements = new T[capacity];
+    this->elements = capacity == 0 ? nullptr : allocateElements(capacity);
 }
 
 template<typename T>
 ArrayList<T>::ArrayList(Array<T> elements) noexcept : ArrayList(elements.length()) {
-    for(const auto &element : elements)  {
-        add(element);
+    for (auto &element : elements) {
+        add(Util::move(element));
     }
 }
 
 template <class T>
 ArrayList<T>::~ArrayList() {
-    delete[] elements;
+    clear();
+
+    if (elements != nullptr) {
+        ::operator delete(elements);
+    }
 }
 
 template <class T>
@@ -131,7 +161,26 @@ T ArrayList<T>::get(uint32_t index) const {
 template <class T>
 bool ArrayList<T>::add(const T &element) {
     ensureCapacity(length + 1);
-    elements[length] = element;
+    new (&elements[length]) T(element);
+    length++;
+
+    return true;
+}
+
+template <class T>
+bool ArrayList<T>::add(T &&element) {
+    ensureCapacity(length + 1);
+    new (&elements[length]) T(Util::move(element));
+    length++;
+
+    return true;
+}
+
+template <class T>
+template <typename... Args>
+bool ArrayList<T>::emplace(Args&&... args) {
+    ensureCapacity(length + 1);
+    new (&elements[length]) T(Util::forward<Args>(args)...);
     length++;
 
     return true;
@@ -139,6 +188,8 @@ bool ArrayList<T>::add(const T &element) {
 
 template <class T>
 bool ArrayList<T>::addAll(const Collection<T> &other) {
+    ensureCapacity(length + other.size());
+
     for (const T &element : other) {
         add(element);
     }
@@ -152,23 +203,37 @@ void ArrayList<T>::add(uint32_t index, const T &element) {
         return;
     }
 
+    openGap(index);
+    new (&elements[index]) T(element);
+    length++;
+}
+
+template <class T>
+void ArrayList<T>::add(uint32_t index, T &&element) {
+    if (index > length) {
+        return;
+    }
+
+    openGap(index);
+    new (&elements[index]) T(Util::move(element));
+    length++;
+}
+
+template <class T>
+void ArrayList<T>::openGap(uint32_t index) {
     ensureCapacity(length + 1);
 
-    for(uint32_t i = length; i > index; i--) {
-        elements[i] = elements[i - 1];
+    if (index == length) {
+        return;
     }
 
-    // bool mmx;
-    // Util::Address<uint32_t> *target = Util::Address<uint32_t>::createAcceleratedAddress(reinterpret_cast<uint32_t>(&elements[index + 1]), mmx);
-    // Util::Address source = Util::Address(reinterpret_cast<uint32_t>(&elements[index]));
-    // target->moveRange(source, (length - index) * sizeof(T));
-    // if (mmx) {
-    //     // NOTE: Can't include Util::Math here
-    //     asm volatile ("emms");
-    // }
+    // The last slot is unconstructed, so the last element is move-constructed into it
+    new (&elements[length]) T(Util::move(elements[length - 1]));
+    for (uint32_t i = length - 1; i > index; i--) {
+        elements[i] = Util::move(elements[i - 1]);
+    }
 
-    elements[index] = element;
-    length++;
+    elements[index].~T();
 }
 
 template <class T>
@@ -189,16 +254,14 @@ T ArrayList<T>::removeIndex(uint32_t index) {
         Exception::throwException(Exception::OUT_OF_BOUNDS, "ArrayList: Trying to access an element out of bounds!");
     }
 
-    T tmp = elements[index];
-    uint32_t numMoved = length - index - 1;
-
-    if (numMoved != 0) {
-        for(uint32_t i = 0; i < numMoved; i++) {
-            elements[index + i] = elements[index + i + 1];
-        }
+    T tmp = Util::move(elements[index]);
+    for (uint32_t i = index; i < length - 1; i++) {
+        elements[i] = Util::move(elements[i + 1]);
     }
 
+    elements[length - 1].~T();
     length--;
+
     return tmp;
 }
 
@@ -241,6 +304,10 @@ bool ArrayList<T>::containsAll(const Collection<T> &other) const {
 
 template <class T>
 void ArrayList<T>::clear() {
+    for (uint32_t i = 0; i < length; i++) {
+        elements[i].~T();
+    }
+
     length = 0;
 }
 
@@ -251,28 +318,34 @@ uint32_t ArrayList<T>::size() const {
 
 template <class T>
 void ArrayList<T>::ensureCapacity(uint32_t newCapacity) {
-    if (capacity == 0) {
-        capacity = DEFAULT_CAPACITY;
-        elements = new T[capacity];
-    }
-
     if (newCapacity <= capacity) {
         return;
     }
 
-    uint32_t oldCapacity = capacity;
+    if (capacity < DEFAULT_CAPACITY) {
+        capacity = DEFAULT_CAPACITY;
+    }
+
     while (capacity < newCapacity) {
         capacity *= 2;
     }
 
-    T* tmp = elements;
-    elements = new T[capacity];
+    T *tmp = elements;
+    elements = allocateElements(capacity);
 
-    for (uint32_t i = 0; i < oldCapacity; i++) {
-        elements[i] = tmp[i];
+    for (uint32_t i = 0; i < length; i++) {
+        new (&elements[i]) T(Util::move(tmp[i]));
+        tmp[i].~T();
+    }
+
+    if (tmp != nullptr) {
+        ::operator delete(tmp);
     }
+}
 
-    delete[] tmp;
+template <class T>
+T* ArrayList<T>::allocateElements(uint32_t capacity) {
+    return static_cast<T*>(::operator new(capacity * sizeof(T)));
 }
 
 template <class T>
@@ -282,7 +355,8 @@ Iterator<T> ArrayList<T>::begin() const {
 
 template <class T>
 Iterator<T> ArrayList<T>::end() const {
-    return Iterator<T>(toArray(), length);
+    // Iterators are only compared by index, so the end iterator does not need a copy of the elements
+    return Iterator<T>(Array<T>(0), length);
 }
 
 template <class T>
@@ -299,6 +373,15 @@ void ArrayList<T>::set(uint32_t index, const T &element) {
     elements[index] = element;
 }
 
+template <class T>
+void ArrayList<T>::set(uint32_t index, T &&element) {
+    if (index >= length) {
+        return;
+    }
+
+    elements[index] = Util::move(element);
+}
+
 template <class T>
 Array<T> ArrayList<T>::toArray() const {
     Array<T> array(length);
@@ -19,6 +19,7 @@
 
 #include "Queue.h"
 #include "ArrayList.h"
+#include "lib/util/base/Move.h"
 
 namespace Util {
 
@@ -44,12 +45,22 @@ public:
 
     bool offer(const T &element) override;
 
+    bool offer(T &&element) override;
+
+    /**
+     * Construct a new element at the end of the queue from the given arguments.
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args);
+
     T poll() override;
 
     T peek() override;
 
     bool add(const T &element) override;
 
+    bool add(T &&element) override;
+
     bool addAll(const Collection<T> &other) override;
 
     bool remove(const T &element) override;
@@ -91,6 +102,17 @@ bool ArrayListBlockingQueue<T>::offer(const T &element) {
     return elements.add(element);
 }
 
+template<class T>
+bool ArrayListBlockingQueue<T>::offer(T &&element) {
+    return elements.add(Util::move(element));
+}
+
+template<class T>
+template<typename... Args>
+bool ArrayListBlockingQueue<T>::emplace(Args&&... args) {
+    return elements.emplace(Util::forward<Args>(args)...);
+}
+
 template<class T>
 T ArrayListBlockingQueue<T>::poll() {
     while (isEmpty()) {}
@@ -108,6 +130,11 @@ bool ArrayListBlockingQueue<T>::add(const T &element) {
     return elements.add(element);
 }
 
+template<class T>
+bool ArrayListBlockingQueue<T>::add(T &&element) {
+    return elements.add(Util::move(element));
+}
+
 template<class T>
 bool ArrayListBlockingQueue<T>::addAll(const Collection<T> &other) {
     return elements.addAll(other);
@@ -36,6 +36,8 @@ public:
 
     virtual bool add(const T &element) = 0;
 
+    virtual bool add(T &&element) = 0;
+
     virtual bool addAll(const Collection<T> &other) = 0;
 
     virtual bool remove(const T &element) = 0;
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_HASH_H
+#define HHUOS_HASH_H
+
+#include <cstdint>
+
+namespace Util {
+
+/**
+ * Computes hash codes for the keys of hash based collections.
+ * Class types are hashed via their hashCode() method, if they provide one, or via their conversion to uint32_t.
+ * Integers and pointers are hashed by their value. All hash codes are scrambled afterwards,
+ * so that keys with regular patterns (e.g. aligned pointers or consecutive ids) are spread across the whole table.
+ */
+class Hash {
+
+public:
+    /**
+     * Default Constructor.
+     * Deleted, as this class has only static members.
+     */
+    Hash() = delete;
+
+    /**
+     * Copy Constructor.
+     */
+    Hash(const Hash &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    Hash &operator=(const Hash &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~Hash() = default;
+
+    template<typename T>
+    static uint32_t hashCode(const T &value) {
+        return scramble(rawHashCode(value, 0));
+    }
+
+    template<typename T>
+    static uint32_t hashCode(T *const &pointer) {
+        return scramble(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pointer)));
+    }
+
+    /**
+     * Finalization step of MurmurHash3, which lets every input bit affect every output bit.
+     */
+    static uint32_t scramble(uint32_t hash) {
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6b;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35;
+        hash ^= hash >> 16;
+
+        return hash;
+    }
+
+private:
+
+    template<typename T>
+    static auto rawHashCode(const T &value, int) -> decltype(static_cast<uint32_t>(value.hashCode())) {
+        return value.hashCode();
+    }
+
+    template<typename T>
+    static uint32_t rawHashCode(const T &value, long) {
+        return static_cast<uint32_t>(value);
+    }
+};
+
+}
+
+#endif
@@ -18,20 +18,24 @@
 #ifndef __HashMap_include__
 #define __HashMap_include__
 
-#include "HashNode.h"
+#include <cstdint>
+
 #include "Array.h"
-#include "ArrayList.h"
+#include "Hash.h"
 #include "Map.h"
 #include "Pair.h"
-
-#include <cstdint>
+#include "lib/util/base/Exception.h"
+#include "lib/util/base/Move.h"
+#include "lib/util/base/operators.h"
 
 namespace Util {
 
 /**
- * An implementation of the Map interface utilizing a hash table.
- *
- * @author Filip Krakowski
+ * An implementation of the Map interface utilizing an open addressing hash table with Robin Hood hashing.
+ * Entries are stored inline in the table, so inserting does not allocate memory (except when the table grows).
+ * Keys and values are only constructed in occupied slots, so allocating a table does not construct any of them.
+ * When the table is filled to 3/4, it doubles in size. Entries are moved to the new table incrementally
+ * with every following put() or remove(), so that no single operation has to rehash the whole map.
  */
 template<typename K, typename V>
 class HashMap : public Map<K, V> {
@@ -40,7 +44,7 @@ public:
 
     HashMap() noexcept;
 
-    explicit HashMap(uint32_t tableSize) noexcept;
+    explicit HashMap(uint32_t initialCapacity) noexcept;
 
     HashMap(std::initializer_list<Pair<K, V>> list);
 
@@ -52,6 +56,12 @@ public:
 
     void put(const K &key, const V &value) override;
 
+    void put(K &&key, V &&value);
+
+    void put(const K &key, V &&value);
+
+    void put(K &&key, const V &value);
+
     [[nodiscard]] V get(const K &key) const override;
 
     V remove(const K &key) override;
@@ -68,24 +78,64 @@ public:
 
 private:
 
-    void initialize() const;
+    struct Slot {
+        Slot() {}
+
+        ~Slot() {}
+
+        uint32_t hash;
+        // Distance to the slot, the hash points to, plus 1 (or EMPTY/DELETED)
+        uint32_t distance;
+        // Key and value are only alive, while the slot is occupied
+        union { K key; };
+        union { V value; };
+    };
+
+    template<typename KeyArgument, typename ValueArgument>
+    void putEntry(KeyArgument &&key, ValueArgument &&value);
+
+    static Slot* allocateTable(uint32_t capacity);
+
+    static void freeTable(Slot *table, uint32_t capacity);
+
+    static Slot* find(Slot *table, uint32_t capacity, uint32_t hash, const K &key);
 
-    mutable HashNode <K, V> **table;
-    mutable bool isInitialized = false;
-    const uint32_t tableSize;
-    uint32_t count;
+    static void insert(Slot *table, uint32_t capacity, uint32_t hash, K &&key, V &&value);
 
-    static const constexpr uint32_t DEFAULT_TABLE_SIZE = 47;
+    static void destroy(Slot &slot, uint32_t marker);
+
+    static void removeWithBackwardShift(Slot *table, uint32_t capacity, Slot *slot);
+
+    static uint32_t roundUpToPowerOfTwo(uint32_t value);
+
+    void startResize();
+
+    void migrate(uint32_t slotCount);
+
+    Slot *table = nullptr;
+    uint32_t capacity;
+    uint32_t count = 0;
+
+    // Table, which is being migrated after a resize. Its slots are marked as DELETED instead of being
+    // shifted back when they are removed or migrated, so that lookups can still probe through them.
+    Slot *oldTable = nullptr;
+    uint32_t oldCapacity = 0;
+    uint32_t migrationIndex = 0;
+
+    static const constexpr uint32_t EMPTY = 0;
+    static const constexpr uint32_t DELETED = UINT32_MAX;
+    static const constexpr uint32_t DEFAULT_CAPACITY = 16;
+    static const constexpr uint32_t MIGRATION_STEP = 8;
 };
 
 template<class K, class V>
-HashMap<K, V>::HashMap() noexcept : tableSize(DEFAULT_TABLE_SIZE), count(0) {}
+HashMap<K, V>::HashMap() noexcept : capacity(DEFAULT_CAPACITY) {}
 
 template<class K, class V>
-HashMap<K, V>::HashMap(uint32_t tableSize) noexcept : tableSize(tableSize), count(0) {}
+HashMap<K, V>::HashMap(uint32_t initialCapacity) noexcept : capacity(roundUpToPowerOfTwo(initialCapacity < DEFAULT_CAPACITY ? DEFAULT_CAPACITY : initialCapacity)) {}
 
 template<class K, class V>
-HashMap<K, V>::HashMap(std::initializer_list<Pair<K, V>> list) : tableSize(DEFAULT_TABLE_SIZE), count(list.size()) {
+HashMap<K, V>::HashMap(std::initializer_list<Pair<K, V>> list) : capacity(DEFAULT_CAPACITY) {
     for (auto &pair : list) {
         put(pair.first, pair.second);
     }
@@ -93,188 +143,323 @@ HashMap<K, V>::HashMap(std::initializer_list<Pair<K, V>> list) : tableSize(DEFAU
 
 template<class K, class V>
 HashMap<K, V>::~HashMap() {
-    clear();
-    delete[] table;
+    freeTable(table, capacity);
+    freeTable(oldTable, oldCapacity);
 }
 
 template<class K, class V>
 void HashMap<K, V>::put(const K &key, const V &value) {
-    if (!isInitialized) {
-        initialize();
-    }
+    putEntry(key, value);
+}
+
+template<class K, class V>
+void HashMap<K, V>::put(K &&key, V &&value) {
+    putEntry(Util::move(key), Util::move(value));
+}
+
+template<class K, class V>
+void HashMap<K, V>::put(const K &key, V &&value) {
+    putEntry(key, Util::move(value));
+}
 
-    const uint32_t hash = (uint32_t) key % tableSize;
-    HashNode <K, V> *previous = nullptr;
-    HashNode <K, V> *entry = table[hash];
+template<class K, class V>
+void HashMap<K, V>::put(K &&key, const V &value) {
+    putEntry(Util::move(key), value);
+}
 
-    while (entry != nullptr && entry->getKey() != key) {
-        previous = entry;
-        entry = entry->getNext();
+template<class K, class V>
+template<typename KeyArgument, typename ValueArgument>
+void HashMap<K, V>::putEntry(KeyArgument &&key, ValueArgument &&value) {
+    // The table is allocated lazily, because static maps may be constructed before the heap is available
+    if (table == nullptr) {
+        table = allocateTable(capacity);
     }
 
-    if (entry == nullptr) {
-        entry = new HashNode<K, V>(key, value);
+    migrate(MIGRATION_STEP);
+
+    auto hash = Hash::hashCode(key);
+    auto *slot = find(table, capacity, hash, key);
+    if (slot != nullptr) {
+        slot->value = Util::forward<ValueArgument>(value);
+        return;
+    }
 
-        if (previous == nullptr) {
-            table[hash] = entry;
-        } else {
-            previous->setNext(entry);
+    if (oldTable != nullptr) {
+        slot = find(oldTable, oldCapacity, hash, key);
+        if (slot != nullptr) {
+            // Move the entry to the new table right away
+            destroy(*slot, DELETED);
+            count--;
         }
+    }
 
-        count++;
-    } else {
-        entry->setValue(value);
+    if ((count + 1) * 4 > capacity * 3) {
+        startResize();
     }
+
+    insert(table, capacity, hash, K(Util::forward<KeyArgument>(key)), V(Util::forward<ValueArgument>(value)));
+    count++;
 }
 
 template<class K, class V>
 V HashMap<K, V>::get(const K &key) const {
-    if (!isInitialized) {
-        initialize();
+    auto hash = Hash::hashCode(key);
+    auto *slot = table == nullptr ? nullptr : find(table, capacity, hash, key);
+    if (slot == nullptr && oldTable != nullptr) {
+        slot = find(oldTable, oldCapacity, hash, key);
     }
 
-    uint32_t hash = (uint32_t) key % tableSize;
-    HashNode <K, V> *entry = table[hash];
-
-    while (entry != nullptr) {
-        if (entry->getKey() == key) {
-            return entry->getValue();
-        }
-
-        entry = entry->getNext();
+    if (slot == nullptr) {
+        Exception::throwException(Exception::KEY_NOT_FOUND, "HashMap: Key does not exist!");
     }
 
-    Exception::throwException(Exception::KEY_NOT_FOUND, "HashMap: Key does not exist!");
+    return slot->value;
 }
 
 template<class K, class V>
 V HashMap<K, V>::remove(const K &key) {
-    if (!isInitialized) {
-        initialize();
-    }
-
-    uint32_t hash = (uint32_t) key % tableSize;
-    HashNode <K, V> *previous = nullptr;
-    HashNode <K, V> *entry = table[hash];
-
-    while (entry != nullptr && entry->getKey() != key) {
-        previous = entry;
-        entry = entry->getNext();
+    auto hash = Hash::hashCode(key);
+    auto *slot = table == nullptr ? nullptr : find(table, capacity, hash, key);
+    if (slot != nullptr) {
+        V value = Util::move(slot->value);
+        removeWithBackwardShift(table, capacity, slot);
+        count--;
+        migrate(MIGRATION_STEP);
+
+        return value;
     }
 
-    if (entry == nullptr) {
+    slot = oldTable == nullptr ? nullptr : find(oldTable, oldCapacity, hash, key);
+    if (slot == nullptr) {
         Exception::throwException(Exception::KEY_NOT_FOUND, "HashMap: Key does not exist!");
     }
 
-    V tmp = entry->getValue();
+    V value = Util::move(slot->value);
+    destroy(*slot, DELETED);
+    count--;
+    migrate(MIGRATION_STEP);
 
-    if (previous == nullptr) {
-        table[hash] = entry->getNext();
-    } else {
-        previous->setNext(entry->getNext());
+    return value;
+}
+
+template<class K, class V>
+bool HashMap<K, V>::containsKey(const K &key) const {
+    if (table == nullptr) {
+        return false;
     }
 
-    count--;
-    delete entry;
-    return tmp;
+    auto hash = Hash::hashCode(key);
+    return find(table, capacity, hash, key) != nullptr || (oldTable != nullptr && find(oldTable, oldCapacity, hash, key) != nullptr);
 }
 
 template<class K, class V>
-void HashMap<K, V>::initialize() const {
-    table = new HashNode <K, V> *[tableSize];
+uint32_t HashMap<K, V>::size() const {
+    return count;
+}
 
-    for (uint32_t i = 0; i < tableSize; i++) {
-        table[i] = nullptr;
-    }
+template<class K, class V>
+void HashMap<K, V>::clear() {
+    freeTable(table, capacity);
+    freeTable(oldTable, oldCapacity);
 
-    isInitialized = true;
+    table = nullptr;
+    oldTable = nullptr;
+    oldCapacity = 0;
+    migrationIndex = 0;
+    count = 0;
 }
 
 template<class K, class V>
-bool HashMap<K, V>::containsKey(const K &key) const {
-    if (!isInitialized) {
-        return false;
+Array<K> HashMap<K, V>::keys() const {
+    Array<K> keys(count);
+    uint32_t index = 0;
+
+    for (uint32_t i = 0; table != nullptr && i < capacity; i++) {
+        if (table[i].distance != EMPTY) {
+            keys[index++] = table[i].key;
+        }
     }
 
-    const uint32_t hash = (uint32_t) key % tableSize;
-    HashNode <K, V> *entry = table[hash];
+    for (uint32_t i = 0; oldTable != nullptr && i < oldCapacity; i++) {
+        if (oldTable[i].distance != EMPTY && oldTable[i].distance != DELETED) {
+            keys[index++] = oldTable[i].key;
+        }
+    }
+
+    return keys;
+}
+
+template<typename K, typename V>
+Array<V> HashMap<K, V>::values() const {
+    Array<V> values(count);
+    uint32_t index = 0;
+
+    for (uint32_t i = 0; table != nullptr && i < capacity; i++) {
+        if (table[i].distance != EMPTY) {
+            values[index++] = table[i].value;
+        }
+    }
 
-    while (entry != nullptr && entry->getKey() != key) {
-        entry = entry->getNext();
+    for (uint32_t i = 0; oldTable != nullptr && i < oldCapacity; i++) {
+        if (oldTable[i].distance != EMPTY && oldTable[i].distance != DELETED) {
+            values[index++] = oldTable[i].value;
+        }
     }
 
-    return entry != nullptr;
+    return values;
 }
 
 template<class K, class V>
-uint32_t HashMap<K, V>::size() const {
-    return count;
+typename HashMap<K, V>::Slot* HashMap<K, V>::allocateTable(uint32_t capacity) {
+    auto *table = new Slot[capacity];
+    for (uint32_t i = 0; i < capacity; i++) {
+        table[i].distance = EMPTY;
+    }
+
+    return table;
 }
 
 template<class K, class V>
-void HashMap<K, V>::clear() {
-    if (!isInitialized) {
-        initialize();
+void HashMap<K, V>::freeTable(Slot *table, uint32_t capacity) {
+    if (table == nullptr) {
+        return;
     }
 
-    HashNode<K, V> *current;
-    HashNode<K, V> *tmp;
+    for (uint32_t i = 0; i < capacity; i++) {
+        if (table[i].distance != EMPTY && table[i].distance != DELETED) {
+            destroy(table[i], EMPTY);
+        }
+    }
 
-    for (uint32_t i = 0; i < tableSize; i++) {
-        current = table[i];
+    delete[] table;
+}
 
-        while (current != nullptr) {
-            tmp = current->getNext();
-            delete current;
-            current = tmp;
+template<class K, class V>
+typename HashMap<K, V>::Slot* HashMap<K, V>::find(Slot *table, uint32_t capacity, uint32_t hash, const K &key) {
+    auto mask = capacity - 1;
+    auto index = hash & mask;
+
+    for (uint32_t distance = 1; distance <= capacity; distance++) {
+        auto &slot = table[index];
+        if (slot.distance == EMPTY) {
+            return nullptr;
         }
 
-        table[i] = nullptr;
+        if (slot.distance != DELETED) {
+            // Robin Hood invariant: The key would have displaced this entry, if it was in the table
+            if (slot.distance < distance) {
+                return nullptr;
+            }
+
+            if (slot.hash == hash && slot.key == key) {
+                return &slot;
+            }
+        }
+
+        index = (index + 1) & mask;
     }
 
-    count = 0;
+    return nullptr;
 }
 
 template<class K, class V>
-Array<K> HashMap<K, V>::keys() const {
-    if (!isInitialized) {
-        initialize();
-    }
+void HashMap<K, V>::insert(Slot *table, uint32_t capacity, uint32_t hash, K &&key, V &&value) {
+    auto mask = capacity - 1;
+    auto index = hash & mask;
+    uint32_t distance = 1;
+
+    while (true) {
+        auto &slot = table[index];
+        if (slot.distance == EMPTY) {
+            new (&slot.key) K(Util::move(key));
+            new (&slot.value) V(Util::move(value));
+            slot.hash = hash;
+            slot.distance = distance;
+            return;
+        }
 
-    ArrayList<K> keyList;
-    HashNode<K, V> *current;
+        // Take the slot from entries, that are closer to their home slot, to keep probe sequences short
+        if (slot.distance < distance) {
+            Util::swap(slot.key, key);
+            Util::swap(slot.value, value);
+            Util::swap(slot.hash, hash);
+            Util::swap(slot.distance, distance);
+        }
 
-    for (uint32_t i = 0; i < tableSize; i++) {
-        current = table[i];
+        index = (index + 1) & mask;
+        distance++;
+    }
+}
 
-        while (current != nullptr) {
-            keyList.add(current->getKey());
-            current = current->getNext();
-        }
+template<class K, class V>
+void HashMap<K, V>::destroy(Slot &slot, uint32_t marker) {
+    slot.key.~K();
+    slot.value.~V();
+    slot.distance = marker;
+}
+
+template<class K, class V>
+void HashMap<K, V>::removeWithBackwardShift(Slot *table, uint32_t capacity, Slot *slot) {
+    auto mask = capacity - 1;
+    auto index = static_cast<uint32_t>(slot - table);
+    auto next = (index + 1) & mask;
+
+    // Shift the following entries back by one slot, until one is at its home slot (or the slot is empty)
+    while (table[next].distance > 1) {
+        table[index].key = Util::move(table[next].key);
+        table[index].value = Util::move(table[next].value);
+        table[index].hash = table[next].hash;
+        table[index].distance = table[next].distance - 1;
+        index = next;
+        next = (next + 1) & mask;
     }
 
-    return keyList.toArray();
+    destroy(table[index], EMPTY);
 }
 
-template<typename K, typename V>
-Array<V> HashMap<K, V>::values() const {
-    if (!isInitialized) {
-        initialize();
+template<class K, class V>
+uint32_t HashMap<K, V>::roundUpToPowerOfTwo(uint32_t value) {
+    uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
     }
 
-    ArrayList<V> valueList;
-    HashNode<K, V> *current;
+    return result;
+}
+
+template<class K, class V>
+void HashMap<K, V>::startResize() {
+    // Only one migration at a time (this only happens, if the map grows faster than it is migrated)
+    migrate(UINT32_MAX);
 
-    for (uint32_t i = 0; i < tableSize; i++) {
-        current = table[i];
+    oldTable = table;
+    oldCapacity = capacity;
+    migrationIndex = 0;
 
-        while (current != nullptr) {
-            valueList.add(current->getValue());
-            current = current->getNext();
+    capacity *= 2;
+    table = allocateTable(capacity);
+}
+
+template<class K, class V>
+void HashMap<K, V>::migrate(uint32_t slotCount) {
+    if (oldTable == nullptr) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < slotCount && migrationIndex < oldCapacity; i++, migrationIndex++) {
+        auto &slot = oldTable[migrationIndex];
+        if (slot.distance != EMPTY && slot.distance != DELETED) {
+            insert(table, capacity, slot.hash, Util::move(slot.key), Util::move(slot.value));
+            destroy(slot, DELETED);
         }
     }
 
-    return valueList.toArray();
+    if (migrationIndex == oldCapacity) {
+        freeTable(oldTable, oldCapacity);
+        oldTable = nullptr;
+        oldCapacity = 0;
+        migrationIndex = 0;
+    }
 }
 
 }
@@ -19,6 +19,7 @@
 #define __Iterator_include__
 
 #include "Array.h"
+#include "lib/util/base/Move.h"
 
 namespace Util {
 
@@ -36,8 +37,12 @@ public:
 
     Iterator(const Iterator<T> &other);
 
+    Iterator(Iterator<T> &&other) noexcept;
+
     Iterator<T> &operator=(const Iterator<T> &other);
 
+    Iterator<T> &operator=(Iterator<T> &&other) noexcept;
+
     ~Iterator() = default;
 
     bool operator!=(const Iterator<T> &other);
@@ -57,11 +62,14 @@ private:
 };
 
 template <class T>
-Iterator<T>::Iterator(Array<T> array, uint32_t index) : array(array), index(index) {}
+Iterator<T>::Iterator(Array<T> array, uint32_t index) : array(Util::move(array)), index(index) {}
 
 template <class T>
 Iterator<T>::Iterator(const Iterator<T> &other) : array(other.array), index(other.index) {}
 
+template <class T>
+Iterator<T>::Iterator(Iterator<T> &&other) noexcept : array(Util::move(other.array)), index(other.index) {}
+
 template <class T>
 Iterator<T> &Iterator<T>::operator=(const Iterator<T> &other) {
     array = other.array;
@@ -70,6 +78,14 @@ Iterator<T> &Iterator<T>::operator=(const Iterator<T> &other) {
     return *this;
 }
 
+template <class T>
+Iterator<T> &Iterator<T>::operator=(Iterator<T> &&other) noexcept {
+    array = Util::move(other.array);
+    index = other.index;
+
+    return *this;
+}
+
 template <class T>
 T &Iterator<T>::operator*() {
     return array[index];
@@ -38,14 +38,20 @@ public:
 
     virtual bool add(const T &element) = 0;
 
+    virtual bool add(T &&element) = 0;
+
     virtual void add(uint32_t index, const T &element) = 0;
 
+    virtual void add(uint32_t index, T &&element) = 0;
+
     virtual bool addAll(const Collection<T> &other) = 0;
 
     [[nodiscard]] virtual T get(uint32_t index) const = 0;
 
     virtual void set(uint32_t index, const T &element) = 0;
 
+    virtual void set(uint32_t index, T &&element) = 0;
+
     virtual bool remove(const T &element) = 0;
 
     virtual bool removeAll(const Collection<T> &other) = 0;
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_MPSCRINGBUFFER_H
+#define HHUOS_MPSCRINGBUFFER_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+
+namespace Util {
+
+/**
+ * A bounded lock-free queue for any number of producers and exactly one consumer.
+ * Producers reserve a slot by advancing the tail with compare-and-swap. Each slot carries a sequence number,
+ * which tells the consumer when the slot's element has been written and the producers when it has been read.
+ * Neither side ever blocks: offer() fails if the buffer is full and poll() fails if no element is ready yet.
+ * The capacity is rounded up to a power of two.
+ */
+template <typename T>
+class MpscRingBuffer {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit MpscRingBuffer(uint32_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * Copy Constructor.
+     */
+    MpscRingBuffer(const MpscRingBuffer<T> &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    MpscRingBuffer<T> &operator=(const MpscRingBuffer<T> &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~MpscRingBuffer();
+
+    /**
+     * Append an element. May be called by multiple producers concurrently.
+     *
+     * @return false, if the buffer is full
+     */
+    bool offer(const T &element);
+
+    /**
+     * Remove the oldest element. May only be called by the consumer.
+     *
+     * @return false, if the buffer is empty
+     */
+    bool poll(T &element);
+
+    /**
+     * Remove up to 'maxCount' of the oldest elements at once. May only be called by the consumer.
+     *
+     * @return The amount of removed elements
+     */
+    uint32_t poll(T *targetElements, uint32_t maxCount);
+
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] uint32_t getCapacity() const;
+
+    static const constexpr uint32_t DEFAULT_CAPACITY = 16;
+    static const constexpr uint32_t CACHE_LINE_SIZE = 64;
+
+private:
+
+    struct Slot {
+        uint32_t sequence;
+        T element;
+    };
+
+    static uint32_t roundUpToPowerOfTwo(uint32_t value);
+
+    Slot *slots;
+    uint32_t capacity;
+    uint32_t mask;
+
+    // Written by the consumer only
+    uint32_t head = 0;
+    Async::Atomic<uint32_t> headWrapper;
+    uint8_t consumerPadding[CACHE_LINE_SIZE]{};
+
+    // Shared by all producers
+    uint32_t tail = 0;
+    Async::Atomic<uint32_t> tailWrapper;
+    uint8_t producerPadding[CACHE_LINE_SIZE]{};
+};
+
+template<typename T>
+MpscRingBuffer<T>::MpscRingBuffer(uint32_t capacity) : capacity(roundUpToPowerOfTwo(capacity)), mask(this->capacity - 1), headWrapper(head), tailWrapper(tail) {
+    slots = new Slot[this->capacity];
+    for (uint32_t i = 0; i < this->capacity; i++) {
+        slots[i].sequence = i;
+    }
+}
+
+template<typename T>
+MpscRingBuffer<T>::~MpscRingBuffer() {
+    delete[] slots;
+}
+
+template<typename T>
+bool MpscRingBuffer<T>::offer(const T &element) {
+    auto position = tailWrapper.get();
+    while (true) {
+        auto &slot = slots[position & mask];
+        auto difference = static_cast<int32_t>(Async::Atomic<uint32_t>(slot.sequence).get() - position);
+
+        if (difference == 0) {
+            // The slot is free -> Try to reserve it
+            if (tailWrapper.compareAndSet(position, position + 1)) {
+                slot.element = element;
+                Async::Atomic<uint32_t>(slot.sequence).set(position + 1);
+                return true;
+            }
+        } else if (difference < 0) {
+            // The slot has not been read since the last round -> The buffer is full
+            return false;
+        }
+
+        // Another producer has been faster
+        position = tailWrapper.get();
+    }
+}
+
+template<typename T>
+bool MpscRingBuffer<T>::poll(T &element) {
+    return poll(&element, 1) == 1;
+}
+
+template<typename T>
+uint32_t MpscRingBuffer<T>::poll(T *targetElements, uint32_t maxCount) {
+    uint32_t count = 0;
+    while (count < maxCount) {
+        auto &slot = slots[head & mask];
+        if (Async::Atomic<uint32_t>(slot.sequence).get() != head + 1) {
+            // The next element has not been published yet
+            break;
+        }
+
+        targetElements[count++] = slot.element;
+        Async::Atomic<uint32_t>(slot.sequence).set(head + capacity);
+        headWrapper.set(head + 1);
+    }
+
+    return count;
+}
+
+template<typename T>
+bool MpscRingBuffer<T>::isEmpty() const {
+    return size() == 0;
+}
+
+template<typename T>
+uint32_t MpscRingBuffer<T>::size() const {
+    return tailWrapper.get() - headWrapper.get();
+}
+
+template<typename T>
+uint32_t MpscRingBuffer<T>::getCapacity() const {
+    return capacity;
+}
+
+template<typename T>
+uint32_t MpscRingBuffer<T>::roundUpToPowerOfTwo(uint32_t value) {
+    uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+}
+
+#endif
@@ -20,6 +20,8 @@
 
 #include <cstdint>
 
+#include "lib/util/base/Move.h"
+
 namespace Util {
 
 /**
@@ -38,8 +40,12 @@ public:
 
     Pair(const Pair &other) = default;
 
+    Pair(Pair &&other) noexcept = default;
+
     Pair &operator=(const Pair &other) = default;
 
+    Pair &operator=(Pair &&other) noexcept = default;
+
     bool operator!=(const Pair &other) const;
 
     bool operator==(const Pair &other) const;
@@ -53,7 +59,7 @@ public:
 };
 
 template<typename T, typename U>
-Pair<T, U>::Pair(T first, U second) : first(first), second(second) {}
+Pair<T, U>::Pair(T first, U second) : first(Util::move(first)), second(Util::move(second)) {}
 
 template<typename T, typename U>
 bool Pair<T, U>::operator!=(const Pair &other) const {
@@ -34,12 +34,16 @@ public:
 
     virtual bool offer(const T &element) = 0;
 
+    virtual bool offer(T &&element) = 0;
+
     virtual T poll() = 0;
 
     virtual T peek() = 0;
 
     virtual bool add(const T &element) = 0;
 
+    virtual bool add(T &&element) = 0;
+
     virtual bool addAll(const Collection<T> &other) = 0;
 
     virtual bool remove(const T &element) = 0;
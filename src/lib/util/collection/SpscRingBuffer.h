@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_SPSCRINGBUFFER_H
+#define HHUOS_SPSCRINGBUFFER_H
+
+#include <cstdint>
+
+#include "lib/util/async/Atomic.h"
+
+namespace Util {
+
+/**
+ * A bounded lock-free queue for exactly one producer and one consumer (e.g. an interrupt handler and a thread).
+ * Neither side ever blocks: offer() fails if the buffer is full and poll() fails if it is empty.
+ * Head and tail reside on different cache lines and each side caches the other side's index,
+ * so that producer and consumer only touch each other's cache line when the buffer seems full or empty.
+ * The capacity is rounded up to a power of two.
+ */
+template <typename T>
+class SpscRingBuffer {
+
+public:
+    /**
+     * Constructor.
+     */
+    explicit SpscRingBuffer(uint32_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * Copy Constructor.
+     */
+    SpscRingBuffer(const SpscRingBuffer<T> &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    SpscRingBuffer<T> &operator=(const SpscRingBuffer<T> &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~SpscRingBuffer();
+
+    /**
+     * Append an element. May only be called by the producer.
+     *
+     * @return false, if the buffer is full
+     */
+    bool offer(const T &element);
+
+    /**
+     * Append either all or none of the given elements. May only be called by the producer.
+     *
+     * @return false, if there is not enough space for all elements
+     */
+    bool offer(const T *sourceElements, uint32_t count);
+
+    /**
+     * Remove the oldest element. May only be called by the consumer.
+     *
+     * @return false, if the buffer is empty
+     */
+    bool poll(T &element);
+
+    /**
+     * Remove up to 'maxCount' of the oldest elements at once. May only be called by the consumer.
+     *
+     * @return The amount of removed elements
+     */
+    uint32_t poll(T *targetElements, uint32_t maxCount);
+
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] uint32_t getCapacity() const;
+
+    static const constexpr uint32_t DEFAULT_CAPACITY = 16;
+    static const constexpr uint32_t CACHE_LINE_SIZE = 64;
+
+private:
+
+    static uint32_t roundUpToPowerOfTwo(uint32_t value);
+
+    T *elements;
+    uint32_t capacity;
+    uint32_t mask;
+
+    // Written by the consumer only
+    uint32_t head = 0;
+    uint32_t cachedTail = 0;
+    Async::Atomic<uint32_t> headWrapper;
+    uint8_t consumerPadding[CACHE_LINE_SIZE]{};
+
+    // Written by the producer only
+    uint32_t tail = 0;
+    uint32_t cachedHead = 0;
+    Async::Atomic<uint32_t> tailWrapper;
+    uint8_t producerPadding[CACHE_LINE_SIZE]{};
+};
+
+template<typename T>
+SpscRingBuffer<T>::SpscRingBuffer(uint32_t capacity) : capacity(roundUpToPowerOfTwo(capacity)), mask(this->capacity - 1), headWrapper(head), tailWrapper(tail) {
+    elements = new T[this->capacity];
+}
+
+template<typename T>
+SpscRingBuffer<T>::~SpscRingBuffer() {
+    delete[] elements;
+}
+
+template<typename T>
+bool SpscRingBuffer<T>::offer(const T &element) {
+    return offer(&element, 1);
+}
+
+template<typename T>
+bool SpscRingBuffer<T>::offer(const T *sourceElements, uint32_t count) {
+    auto currentTail = tail;
+    if (capacity - (currentTail - cachedHead) < count) {
+        cachedHead = headWrapper.get();
+        if (capacity - (currentTail - cachedHead) < count) {
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        elements[(currentTail + i) & mask] = sourceElements[i];
+    }
+
+    // Publish the elements only after they have been written
+    tailWrapper.set(currentTail + count);
+    return true;
+}
+
+template<typename T>
+bool SpscRingBuffer<T>::poll(T &element) {
+    return poll(&element, 1) == 1;
+}
+
+template<typename T>
+uint32_t SpscRingBuffer<T>::poll(T *targetElements, uint32_t maxCount) {
+    auto currentHead = head;
+    if (cachedTail == currentHead) {
+        cachedTail = tailWrapper.get();
+        if (cachedTail == currentHead) {
+            return 0;
+        }
+    }
+
+    auto count = cachedTail - currentHead < maxCount ? cachedTail - currentHead : maxCount;
+    for (uint32_t i = 0; i < count; i++) {
+        targetElements[i] = elements[(currentHead + i) & mask];
+    }
+
+    // Release the slots only after they have been read
+    headWrapper.set(currentHead + count);
+    return count;
+}
+
+template<typename T>
+bool SpscRingBuffer<T>::isEmpty() const {
+    return size() == 0;
+}
+
+template<typename T>
+uint32_t SpscRingBuffer<T>::size() const {
+    return tailWrapper.get() - headWrapper.get();
+}
+
+template<typename T>
+uint32_t SpscRingBuffer<T>::getCapacity() const {
+    return capacity;
+}
+
+template<typename T>
+uint32_t SpscRingBuffer<T>::roundUpToPowerOfTwo(uint32_t value) {
+    uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+}
+
+#endif
@@ -56,8 +56,8 @@ void Engine::run() {
     Graphic::Ansi::prepareGraphicalApplication(true);
     initializeNextScene();
 
-    Async::Thread::createThread("Key-Listener", new KeyListenerRunnable(*this));
-    Async::Thread::createThread("Mouse-Listener", new MouseListenerRunnable(*this));
+    Async::Thread::createThread("Key-Listener", new KeyListenerRunnable(*this)).setPriority(Async::Thread::HIGH);
+    Async::Thread::createThread("Mouse-Listener", new MouseListenerRunnable(*this)).setPriority(Async::Thread::HIGH);
 
     while (game.isRunning()) {
         statistics.startFrameTime();
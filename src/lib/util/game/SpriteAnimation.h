@@ -46,11 +46,21 @@ public:
      */
     SpriteAnimation(const SpriteAnimation &other) = default;
 
+    /**
+     * Move Constructor.
+     */
+    SpriteAnimation(SpriteAnimation &&other) noexcept = default;
+
     /**
      * Assignment operator.
      */
     SpriteAnimation &operator=(const SpriteAnimation &other) = default;
 
+    /**
+     * Move assignment operator.
+     */
+    SpriteAnimation &operator=(SpriteAnimation &&other) noexcept = default;
+
     /**
      * Destructor.
      */
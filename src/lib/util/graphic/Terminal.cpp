@@ -120,7 +120,7 @@ void Terminal::handleTab() {
 }
 
 void Terminal::parseColorEscapeSequence(const Util::String &escapeSequence) {
-    const auto codes = escapeSequence.split(';');
+    const auto codes = escapeSequence.split(";");
 
     for (uint32_t i = 0; i < codes.length(); i++) {
         int32_t code = Util::String::parseInt(codes[i]);
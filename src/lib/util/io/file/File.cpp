@@ -16,7 +16,7 @@
  */
 
 #include "lib/interface.h"
-#include "lib/util/collection/ArrayList.h"
+#include "lib/util/base/StringView.h"
 #include "lib/util/graphic/Ansi.h"
 #include "lib/util/io/file/File.h"
 #include "lib/util/base/Exception.h"
@@ -84,8 +84,10 @@ uint32_t Io::File::getLength() {
 }
 
 String File::getName() const {
-    const auto splitPath = getCanonicalPath(path).split("/");
-    return splitPath.length() == 0 ? "" : splitPath[splitPath.length() - 1];
+    const auto canonicalPath = getCanonicalPath(path);
+    const auto view = StringView(canonicalPath);
+
+    return String(view.substring(view.lastIndexOf('/') + 1));
 }
 
 String File::getCanonicalPath() const {
@@ -137,27 +139,41 @@ Util::String File::getCanonicalPath(const Util::String &path) {
         return "";
     }
 
-    auto absolutePath = path[0] == '/' ? path : getCurrentWorkingDirectory().getCanonicalPath() + SEPARATOR + path;
-    Util::Array<Util::String> token = absolutePath.split(Util::Io::File::SEPARATOR);
-    Util::ArrayList<Util::String> parsedToken;
+    Util::String absolutePath;
+    if (path[0] != '/') {
+        absolutePath = getCurrentWorkingDirectory().getCanonicalPath() + SEPARATOR + path;
+    }
+
+    // Resolve '.' and '..' on views into the path and compact the remaining tokens in place
+    auto token = Util::StringView(path[0] == '/' ? path : absolutePath).split(Util::Io::File::SEPARATOR);
+    uint32_t count = 0;
+    uint32_t length = 0;
 
-    for (const Util::String &string : token) {
-        if (string == ".") {
+    for (uint32_t i = 0; i < token.length(); i++) {
+        if (token[i] == ".") {
             continue;
-        } else if (string == "..") {
-            if (!parsedToken.isEmpty()) {
-                parsedToken.removeIndex(parsedToken.size() - 1);
+        } else if (token[i] == "..") {
+            if (count > 0) {
+                length -= token[--count].length() + 1;
             }
         } else {
-            parsedToken.add(string);
+            length += token[i].length() + 1;
+            token[count++] = token[i];
         }
     }
 
-    if (parsedToken.isEmpty()) {
+    if (count == 0) {
         return "";
     }
 
-    Util::String parsedPath = Util::Io::File::SEPARATOR + Util::String::join(Util::Io::File::SEPARATOR, parsedToken.toArray());
+    Util::String parsedPath;
+    parsedPath.ensureCapacity(length);
+
+    for (uint32_t i = 0; i < count; i++) {
+        parsedPath += Util::Io::File::SEPARATOR;
+        parsedPath += token[i];
+    }
+
     return parsedPath;
 }
 
@@ -187,6 +203,10 @@ void File::close(int32_t fileDescriptor) {
     return ::closeFile(fileDescriptor);
 }
 
+int32_t File::createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor) {
+    return ::createPipe(readFileDescriptor, writeFileDescriptor);
+}
+
 bool File::changeDirectory(const Util::String &path) {
     return ::changeDirectory(path);
 }
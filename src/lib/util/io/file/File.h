@@ -37,6 +37,32 @@ public:
         CHARACTER
     };
 
+    /**
+     * Reference points for moving the position of an open file.
+     */
+    enum SeekMode : uint8_t {
+        SET,
+        CURRENT,
+        END
+    };
+
+    /**
+     * Ways to map a file into memory. Changes to copy-on-write mappings stay private to the process
+     * and are never written back to the file.
+     */
+    enum MapMode : uint8_t {
+        READ_ONLY,
+        COPY_ON_WRITE
+    };
+
+    /**
+     * A buffer for vectored reads and writes, which transfer several buffers with a single system call.
+     */
+    struct IoVector {
+        uint8_t *buffer;
+        uint32_t length;
+    };
+
     /**
      * Constructor.
      */
@@ -95,6 +121,14 @@ public:
 
     void static close(int32_t fileDescriptor);
 
+    /**
+     * Create a pipe and open both of its ends. The ends can also be opened by other processes
+     * via '/pipe/<id>/read' and '/pipe/<id>/write'. Once all ends are closed, the pipe is deleted.
+     *
+     * @return The pipe's id (or -1 on failure)
+     */
+    int32_t static createPipe(int32_t &readFileDescriptor, int32_t &writeFileDescriptor);
+
     static bool mount(const Util::String &device, const Util::String &targetPath, const Util::String &driverName);
 
     static bool unmount(const Util::String &path);
@@ -60,6 +60,12 @@ enum class ProgramHeaderType : uint32_t {
     PHDR = 0x06,
 };
 
+enum class ProgramHeaderFlag : uint32_t {
+    EXECUTABLE = 0x01,
+    WRITABLE = 0x02,
+    READABLE = 0x04
+};
+
 enum class MachineType : uint16_t {
     X86 = 0x03
 };
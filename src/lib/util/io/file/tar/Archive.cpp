@@ -70,6 +70,23 @@ Util::Array<Archive::Header> Archive::getFileHeaders() {
     return fileHeaders;
 }
 
+Util::Array<const Archive::Header*> Archive::getFileHeaderReferences() {
+    Util::Array<const Header*> fileHeaders(fileCount);
+    uint32_t arrayIndex = 0;
+
+    for (const auto *header : headers) {
+        if (header->typeFlag == LF_OLDNORMAL) {
+            fileHeaders[arrayIndex++] = header;
+        }
+    }
+
+    return fileHeaders;
+}
+
+const uint8_t* Archive::getFileData(const Header &header) {
+    return reinterpret_cast<const uint8_t*>(&header) + BLOCKSIZE;
+}
+
 uint8_t *Archive::getFile(const Util::String &path) {
     for (auto *header : headers) {
         if (path == header->filename) {
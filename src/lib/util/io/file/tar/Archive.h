@@ -60,6 +60,14 @@ public:
      */
     Util::Array<Header> getFileHeaders();
 
+    /**
+     * Returns pointers to all file headers within this archive.
+     * In contrast to getFileHeaders(), the headers are not copied, but point directly into the archive's memory.
+     *
+     * @return Pointers to all file headers.
+     */
+    Util::Array<const Header*> getFileHeaderReferences();
+
     /**
      * Returns the specified file within this archive.
      *
@@ -76,6 +84,14 @@ public:
      */
     static uint32_t calculateFileSize(const Header &header);
 
+    /**
+     * Returns the data of a file, which directly follows its header inside the archive.
+     *
+     * @param header The file's header (must point into the archive)
+     * @return The file's data
+     */
+    static const uint8_t* getFileData(const Header &header);
+
 private:
 
     uint32_t fileCount = 0;
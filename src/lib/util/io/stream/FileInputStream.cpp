@@ -52,16 +52,8 @@ int16_t FileInputStream::read() {
 }
 
 int32_t FileInputStream::read(uint8_t *targetBuffer, uint32_t offset, uint32_t length) {
-    auto fileType = getFileType(fileDescriptor);
-    auto fileLength = getFileLength(fileDescriptor);
-
-    if (fileType == Io::File::REGULAR && pos >= fileLength) {
-        return -1;
-    }
-
-    uint32_t count = readFile(fileDescriptor, targetBuffer + offset, pos, length);
-    pos += count;
-
+    // The kernel keeps track of the position and stops at the end of regular files
+    uint32_t count = readFromFile(fileDescriptor, targetBuffer + offset, length);
     return count > 0 ? count : -1;
 }
 
@@ -49,8 +49,7 @@ void FileOutputStream::write(uint8_t c) {
 }
 
 void FileOutputStream::write(const uint8_t *sourceBuffer, uint32_t offset, uint32_t length) {
-    uint32_t count = writeFile(fileDescriptor, sourceBuffer + offset, pos, length);
-    pos += count;
+    writeToFile(fileDescriptor, sourceBuffer + offset, length);
 }
 
 }
\ No newline at end of file
@@ -53,7 +53,6 @@ public:
 
 private:
 
-    uint32_t pos = 0;
     int32_t fileDescriptor;
 
 };
@@ -19,13 +19,13 @@
 #include "lib/util/base/Exception.h"
 #include "PipedOutputStream.h"
 #include "PipedInputStream.h"
-#include "lib/util/async/Thread.h"
+#include "lib/interface.h"
 
 namespace Util::Io {
 
-PipedInputStream::PipedInputStream() : buffer(new uint8_t[BUFFER_SIZE]) {}
+PipedInputStream::PipedInputStream() : buffer(new uint8_t[BUFFER_SIZE]), readSequenceWrapper(readSequence), writeSequenceWrapper(writeSequence) {}
 
-PipedInputStream::PipedInputStream(PipedOutputStream &outputStream) : buffer(new uint8_t[BUFFER_SIZE]) {
+PipedInputStream::PipedInputStream(PipedOutputStream &outputStream) : buffer(new uint8_t[BUFFER_SIZE]), readSequenceWrapper(readSequence), writeSequenceWrapper(writeSequence) {
     connect(outputStream);
 }
 
@@ -57,9 +57,16 @@ int32_t PipedInputStream::read(uint8_t *targetBuffer, uint32_t offset, uint32_t
         return 0;
     }
 
-    // Block while buffer is empty
-    while (inPosition < 0) {
-        Async::Thread::yield();
+    // Block while buffer is empty (the lock is kept, once data is available)
+    while (true) {
+        auto sequence = writeSequenceWrapper.get();
+        lock.acquire();
+        if (inPosition >= 0) {
+            break;
+        }
+
+        lock.release();
+        futexWait(&writeSequence, sequence);
     }
 
     uint32_t remaining = length;
@@ -97,6 +104,9 @@ int32_t PipedInputStream::read(uint8_t *targetBuffer, uint32_t offset, uint32_t
 
         // Check if we have copied the requested amount of bytes or if the internal buffer is empty
         if (remaining == 0 || inPosition == -1) {
+            lock.release();
+            readSequenceWrapper.inc();
+            futexWake(&readSequence, 1);
             return ret;
         }
     }
@@ -111,9 +121,16 @@ void PipedInputStream::write(const uint8_t *sourceBuffer, uint32_t offset, uint3
     uint32_t remaining = length;
 
     while (remaining > 0) {
-        // Block while buffer is full
-        while (inPosition == outPosition) {
-            Async::Thread::yield();
+        // Block while buffer is full (the lock is kept, once there is free space)
+        while (true) {
+            auto sequence = readSequenceWrapper.get();
+            lock.acquire();
+            if (inPosition != outPosition) {
+                break;
+            }
+
+            lock.release();
+            futexWait(&readSequence, sequence);
         }
 
         if (inPosition < 0) { // Buffer is empty
@@ -141,6 +158,10 @@ void PipedInputStream::write(const uint8_t *sourceBuffer, uint32_t offset, uint3
         if (inPosition == BUFFER_SIZE) {
             inPosition = 0;
         }
+
+        lock.release();
+        writeSequenceWrapper.inc();
+        futexWake(&writeSequence, 1);
     }
 }
 
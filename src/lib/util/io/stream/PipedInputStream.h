@@ -21,6 +21,8 @@
 #include <cstdint>
 
 #include "InputStream.h"
+#include "lib/util/async/Atomic.h"
+#include "lib/util/async/Spinlock.h"
 
 namespace Util::Io {
 
@@ -57,6 +59,15 @@ private:
     uint8_t *buffer;
     int32_t inPosition = -1;
     int32_t outPosition = 0;
+    // Protects the positions, which are updated by both the reader and the writer
+    Async::Spinlock lock;
+
+    // Futexes for blocking the reader on an empty buffer and the writer on a full buffer.
+    // Each side increments its sequence number after making progress, so that a concurrent wait returns immediately.
+    uint32_t readSequence = 0;
+    uint32_t writeSequence = 0;
+    Async::Atomic<uint32_t> readSequenceWrapper;
+    Async::Atomic<uint32_t> writeSequenceWrapper;
 
     static const constexpr uint32_t BUFFER_SIZE = 1024;
 
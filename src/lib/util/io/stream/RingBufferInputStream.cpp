@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "RingBufferInputStream.h"
+
+namespace Util::Io {
+
+RingBufferInputStream::RingBufferInputStream(uint32_t capacity) : buffer(capacity) {}
+
+int16_t RingBufferInputStream::read() {
+    uint8_t c;
+    int32_t count = read(&c, 0, 1);
+
+    return count > 0 ? c : -1;
+}
+
+int32_t RingBufferInputStream::read(uint8_t *targetBuffer, uint32_t offset, uint32_t length) {
+    if (length == 0) {
+        return 0;
+    }
+
+    // The producer may be an interrupt handler, which can only signal an interrupt event
+    auto sequence = dataAvailable.getSequence();
+    auto count = buffer.poll(targetBuffer + offset, length);
+    while (count == 0) {
+        dataAvailable.wait(sequence);
+        sequence = dataAvailable.getSequence();
+        count = buffer.poll(targetBuffer + offset, length);
+    }
+
+    return static_cast<int32_t>(count);
+}
+
+bool RingBufferInputStream::write(uint8_t c) {
+    if (!buffer.offer(c)) {
+        return false;
+    }
+
+    dataAvailable.signal();
+    return true;
+}
+
+bool RingBufferInputStream::write(const uint8_t *sourceBuffer, uint32_t offset, uint32_t length) {
+    if (!buffer.offer(sourceBuffer + offset, length)) {
+        return false;
+    }
+
+    dataAvailable.signal();
+    return true;
+}
+
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_RINGBUFFERINPUTSTREAM_H
+#define HHUOS_RINGBUFFERINPUTSTREAM_H
+
+#include <cstdint>
+
+#include "InputStream.h"
+#include "lib/util/collection/SpscRingBuffer.h"
+#include "lib/util/async/InterruptEvent.h"
+
+namespace Util::Io {
+
+/**
+ * An input stream, which is fed by a single producer via a lock-free ring buffer.
+ * Writing never blocks (data is dropped if the buffer is full), so it is safe to write from an interrupt handler.
+ * Reading blocks, until at least one byte is available (the writer wakes up the reader via an interrupt event).
+ */
+class RingBufferInputStream : public InputStream {
+
+public:
+
+    explicit RingBufferInputStream(uint32_t capacity = DEFAULT_CAPACITY);
+
+    RingBufferInputStream(const RingBufferInputStream &copy) = delete;
+
+    RingBufferInputStream &operator=(const RingBufferInputStream &copy) = delete;
+
+    ~RingBufferInputStream() override = default;
+
+    int16_t read() override;
+
+    int32_t read(uint8_t *targetBuffer, uint32_t offset, uint32_t length) override;
+
+    /**
+     * Append a byte without blocking.
+     *
+     * @return false, if the buffer is full and the byte has been dropped
+     */
+    bool write(uint8_t c);
+
+    /**
+     * Append either all or none of the given bytes without blocking (e.g. a complete mouse packet).
+     *
+     * @return false, if the buffer is full and the bytes have been dropped
+     */
+    bool write(const uint8_t *sourceBuffer, uint32_t offset, uint32_t length);
+
+    static const constexpr uint32_t DEFAULT_CAPACITY = 1024;
+
+private:
+
+    SpscRingBuffer<uint8_t> buffer;
+    Async::InterruptEvent dataAvailable;
+};
+
+}
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "TimePage.h"
+
+namespace Util::Time {
+
+TimePage::TimePage(bool useTimestampCounter) : useTimestampCounter(useTimestampCounter) {}
+
+void TimePage::update(const Timestamp &time) {
+    auto interval = time.toNanoseconds() - systemTime.toNanoseconds(); // Correct, even if the nanoseconds wrap around
+    auto cycles = useTimestampCounter ? readTimestampCounter() : 0;
+    auto calibrated = nanosecondsPerCycle;
+
+    if (useTimestampCounter && sequence != 0 && cycles > tickCycles && cycles - tickCycles <= UINT32_MAX) {
+        auto elapsedCycles = static_cast<uint32_t>(cycles - tickCycles);
+        // (interval << FRACTIONAL_BITS) / elapsedCycles must fit into 32 bits (at most 256 nanoseconds per cycle, which holds for every TSC running at 4 MHz or faster)
+        if ((interval >> (32 - FRACTIONAL_BITS)) < elapsedCycles) {
+            // 64/32 bit division (64-bit divisions are not available without libgcc)
+            uint32_t quotient, remainder;
+            asm volatile ("divl %4"
+                    : "=a"(quotient), "=d"(remainder)
+                    : "a"(interval << FRACTIONAL_BITS), "d"(interval >> (32 - FRACTIONAL_BITS)), "rm"(elapsedCycles));
+
+            // Smooth out jitter caused by the interrupt latency
+            calibrated = calibrated == 0 ? quotient : calibrated - calibrated / 8 + quotient / 8;
+        }
+    }
+
+    sequence = sequence + 1;
+    asm volatile ("" ::: "memory");
+
+    systemTime = time;
+    tickCycles = cycles;
+    tickInterval = interval;
+    nanosecondsPerCycle = calibrated;
+
+    asm volatile ("" ::: "memory");
+    sequence = sequence + 1;
+}
+
+bool TimePage::read(Timestamp &time) const {
+    uint32_t currentSequence;
+    uint64_t cycles;
+    uint32_t scale;
+    uint32_t interval;
+
+    do {
+        currentSequence = sequence;
+        asm volatile ("" ::: "memory");
+
+        time = systemTime;
+        cycles = tickCycles;
+        scale = nanosecondsPerCycle;
+        interval = tickInterval;
+
+        asm volatile ("" ::: "memory");
+    } while ((currentSequence & 0x01) != 0 || currentSequence != sequence);
+
+    if (currentSequence == 0) {
+        return false;
+    }
+
+    if (scale != 0 && interval != 0) {
+        // Other CPUs' time stamp counters may lag behind -> Never go back before the last tick
+        auto now = readTimestampCounter();
+        if (now > cycles) {
+            auto elapsedCycles = now - cycles > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(now - cycles);
+            auto offset = (static_cast<uint64_t>(elapsedCycles) * scale) >> FRACTIONAL_BITS;
+            time.addNanoseconds(offset >= interval ? interval - 1 : static_cast<uint32_t>(offset));
+        }
+    }
+
+    return true;
+}
+
+uint64_t TimePage::readTimestampCounter() {
+    uint64_t cycles;
+    asm volatile ("rdtsc" : "=A"(cycles));
+    return cycles;
+}
+
+}
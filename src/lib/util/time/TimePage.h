@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2018-2023 Heinrich-Heine-Universitaet Duesseldorf,
+ * Institute of Computer Science, Department Operating Systems
+ * Burak Akguel, Christian Gesse, Fabian Ruhland, Filip Krakowski, Michael Schoettner
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HHUOS_TIMEPAGE_H
+#define HHUOS_TIMEPAGE_H
+
+#include <cstdint>
+
+#include "Timestamp.h"
+
+namespace Util::Time {
+
+/**
+ * Holds the current system time on a page, which the kernel maps read-only into every process
+ * (at USER_SPACE_TIME_PAGE_ADDRESS). The kernel updates it on every timer tick, so that reading
+ * the system time does not need a system call.
+ *
+ * Updates are protected by a sequence counter, which is odd while an update is in progress.
+ * Readers retry until they have read a consistent snapshot (even and unchanged counter).
+ * If the CPU has a time stamp counter, the page also holds its calibration data,
+ * so that readers can interpolate the time between two ticks.
+ */
+class TimePage {
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param useTimestampCounter Calibrate the time stamp counter on every update (only if the CPU supports it)
+     */
+    explicit TimePage(bool useTimestampCounter);
+
+    /**
+     * Copy Constructor.
+     */
+    TimePage(const TimePage &other) = delete;
+
+    /**
+     * Assignment operator.
+     */
+    TimePage &operator=(const TimePage &other) = delete;
+
+    /**
+     * Destructor.
+     */
+    ~TimePage() = default;
+
+    /**
+     * Publish a new system time. There must only be a single writer (the timer interrupt handler).
+     */
+    void update(const Timestamp &time);
+
+    /**
+     * Read the system time. The time between two ticks is interpolated, if the time stamp counter has been calibrated.
+     *
+     * @param time Is set to the current system time
+     * @return false, if no time has been published yet
+     */
+    bool read(Timestamp &time) const;
+
+private:
+
+    [[nodiscard]] static uint64_t readTimestampCounter();
+
+    volatile uint32_t sequence = 0;
+    Timestamp systemTime;
+
+    // Time stamp counter value at the last tick and nanoseconds per cycle as fixed point number with 24 fractional bits
+    uint64_t tickCycles = 0;
+    uint32_t nanosecondsPerCycle = 0;
+    // Nanoseconds between the last two ticks; Interpolation never exceeds the next tick
+    uint32_t tickInterval = 0;
+
+    const bool useTimestampCounter;
+
+    static const constexpr uint32_t FRACTIONAL_BITS = 24;
+};
+
+}
+
+#endif